@@ -0,0 +1,174 @@
+// Copyright (c) 2021, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// @dart=2.9
+
+// Measures dart:io throughput on the socket, file and TLS stacks. The
+// configurations below are pinned to what our production services use, so a
+// regression in runtime/bin (eventhandler, io_service, secure_socket_filter)
+// shows up here before release rather than in the field:
+//
+//  * 4 KB echo round trips over loopback TCP at 1, 8 and 64 connections.
+//  * Whole-file read and write passes at 4 KB, 64 KB and 1 MB block sizes.
+//  * TLS handshakes and 64 KB bulk round trips over a secure loopback socket.
+
+import 'dart:async';
+import 'dart:io';
+import 'dart:typed_data';
+
+const int echoMessageSize = 4 * 1024;
+const List<int> echoConnectionCounts = [1, 8, 64];
+
+const int fileSize = 8 * 1024 * 1024;
+const List<int> fileBlockSizes = [4 * 1024, 64 * 1024, 1024 * 1024];
+
+const int tlsMessageSize = 64 * 1024;
+
+String blockLabel(int size) =>
+    size >= 1024 * 1024 ? '${size ~/ (1024 * 1024)}MB' : '${size ~/ 1024}KB';
+
+String localFile(String path) => Platform.script.resolve(path).toFilePath();
+
+SecurityContext serverContext() => SecurityContext()
+  ..useCertificateChain(localFile('../certificates/server_chain.pem'))
+  ..usePrivateKey(localFile('../certificates/server_key.pem'),
+      password: 'dartdart');
+
+SecurityContext clientContext() => SecurityContext()
+  ..setTrustedCertificates(localFile('../certificates/trusted_certs.pem'));
+
+Future<double> measureFor(Future<void> Function() op, int minimumMillis) async {
+  final watch = Stopwatch()..start();
+  var ops = 0;
+  while (watch.elapsedMilliseconds < minimumMillis) {
+    await op();
+    ops++;
+  }
+  return watch.elapsedMicroseconds / ops;
+}
+
+Future<void> report(String name, Future<void> Function() op) async {
+  await measureFor(op, 500); // Warm-up.
+  final us = await measureFor(op, 2000);
+  print('IOBench.$name(RunTime): $us us.');
+}
+
+/// Sends a message on an established socket and completes once the peer has
+/// echoed all of it back.
+class RoundTripper {
+  RoundTripper(this.socket, this.message) {
+    socket.listen(_onData);
+  }
+
+  final Socket socket;
+  final Uint8List message;
+  int _pending = 0;
+  Completer<void> _done = Completer<void>();
+
+  Future<void> roundTrip() {
+    _pending = message.length;
+    _done = Completer<void>();
+    socket.add(message);
+    return _done.future;
+  }
+
+  void _onData(List<int> data) {
+    _pending -= data.length;
+    if (_pending <= 0) {
+      _done.complete();
+    }
+  }
+}
+
+Future<void> benchEcho() async {
+  final server = await ServerSocket.bind(InternetAddress.loopbackIPv4, 0);
+  server.listen((socket) {
+    socket.setOption(SocketOption.tcpNoDelay, true);
+    socket.listen(socket.add);
+  });
+
+  final message = Uint8List(echoMessageSize);
+  for (final connections in echoConnectionCounts) {
+    final trippers = <RoundTripper>[];
+    for (var i = 0; i < connections; i++) {
+      final socket =
+          await Socket.connect(InternetAddress.loopbackIPv4, server.port);
+      socket.setOption(SocketOption.tcpNoDelay, true);
+      trippers.add(RoundTripper(socket, message));
+    }
+    // One op is a message round trip on every connection concurrently.
+    await report('Echo.c$connections', () async {
+      await Future.wait([for (final t in trippers) t.roundTrip()]);
+    });
+    for (final t in trippers) {
+      t.socket.destroy();
+    }
+  }
+  await server.close();
+}
+
+Future<void> benchFile() async {
+  final dir = await Directory.systemTemp.createTemp('io_bench');
+  final path = '${dir.path}/data';
+  try {
+    for (final blockSize in fileBlockSizes) {
+      final block = Uint8List(blockSize);
+      final blocks = fileSize ~/ blockSize;
+
+      // One op writes the whole file through one io_service request per
+      // block.
+      await report('FileWrite.${blockLabel(blockSize)}', () async {
+        final file = await File(path).open(mode: FileMode.write);
+        for (var i = 0; i < blocks; i++) {
+          await file.writeFrom(block);
+        }
+        await file.close();
+      });
+
+      // One op reads the whole file back at the same granularity.
+      await report('FileRead.${blockLabel(blockSize)}', () async {
+        final file = await File(path).open();
+        for (var i = 0; i < blocks; i++) {
+          await file.read(blockSize);
+        }
+        await file.close();
+      });
+    }
+  } finally {
+    await dir.delete(recursive: true);
+  }
+}
+
+Future<void> benchTls() async {
+  final server = await SecureServerSocket.bind(
+      InternetAddress.loopbackIPv4, 0, serverContext());
+  server.listen((socket) {
+    socket.listen(socket.add, onError: (e) {});
+  });
+  final context = clientContext();
+
+  // One op is a full handshake: connect, then tear the connection down.
+  await report('TlsHandshake', () async {
+    final socket = await SecureSocket.connect(
+        InternetAddress.loopbackIPv4, server.port,
+        context: context);
+    socket.destroy();
+  });
+
+  // One op pushes a 64 KB message through the filter in both directions.
+  final socket = await SecureSocket.connect(
+      InternetAddress.loopbackIPv4, server.port,
+      context: context);
+  final tripper = RoundTripper(socket, Uint8List(tlsMessageSize));
+  await report('TlsThroughput', tripper.roundTrip);
+  socket.destroy();
+
+  await server.close();
+}
+
+Future<void> main() async {
+  await benchEcho();
+  await benchFile();
+  await benchTls();
+}
@@ -0,0 +1,36 @@
+// Copyright (c) 2021, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+// Measures the latency of Process.start from a parent with a large resident
+// set. fork-based spawning duplicates the parent's page tables, so its cost
+// grows with the parent's heap; a vfork/posix_spawn based implementation
+// should be insensitive to it.
+
+import 'dart:io';
+import 'dart:typed_data';
+
+const int ballastMB = 512;
+
+// Touched, retained memory keeping the parent's resident set large for the
+// duration of the measurement.
+final List<Uint8List> ballast =
+    List.generate(ballastMB, (i) => Uint8List(1024 * 1024)..fillRange(0, 1024 * 1024, i));
+
+Future<double> measureFor(int minimumMillis) async {
+  final watch = Stopwatch()..start();
+  var spawns = 0;
+  while (watch.elapsedMilliseconds < minimumMillis) {
+    final process = await Process.start('true', const []);
+    await process.exitCode;
+    spawns++;
+  }
+  return watch.elapsedMicroseconds / spawns;
+}
+
+Future<void> main() async {
+  await measureFor(500); // Warm-up.
+  final us = await measureFor(2000);
+  if (ballast.length != ballastMB) throw 'ballast was collected';
+  print('ProcessSpawn.LargeHeap(RunTime): $us us.');
+}
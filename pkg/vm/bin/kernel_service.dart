@@ -192,6 +192,14 @@ abstract class Compiler {
         errors);
   }
 
+  /// Identifies this compiler's front-end configuration. Compilers with equal
+  /// keys target the same package config, platform and flags, so one can seed
+  /// a new session via [IncrementalCompilerWrapper.clone] and share parsed
+  /// summaries.
+  String get configurationKey => _configurationKey(packageConfig,
+      platformKernelPath, suppressWarnings, enableAsserts, nullSafety,
+      experimentalFlags);
+
   Future<CompilerResult> compile(Uri script) {
     return runWithPrintToStderr(() async {
       final CompilerResult compilerResult = await compileInternal(script);
@@ -326,8 +334,15 @@ class IncrementalCompilerWrapper extends Compiler {
   void invalidate(Uri uri) => generator.invalidate(uri);
 
   Future<IncrementalCompilerWrapper> clone(int isolateId) async {
+    FileSystem cloneFileSystem = fileSystem;
+    if (cloneFileSystem is! HybridFileSystem) {
+      // A clone seeded from a compiler reading straight from disk needs a
+      // memory layer to receive the initialization dill.
+      cloneFileSystem = new HybridFileSystem(
+          new MemoryFileSystem(Uri.parse('file:///')), fileSystem);
+    }
     IncrementalCompilerWrapper clone = IncrementalCompilerWrapper(
-        isolateId, fileSystem, platformKernelPath,
+        isolateId, cloneFileSystem, platformKernelPath,
         suppressWarnings: suppressWarnings,
         enableAsserts: enableAsserts,
         nullSafety: nullSafety,
@@ -337,9 +352,8 @@ class IncrementalCompilerWrapper extends Compiler {
     generator.resetDeltaState();
     Component fullComponent = await generator.compile();
 
-    // Assume fileSystem is HybridFileSystem because that is the setup where
-    // clone should be used for.
-    MemoryFileSystem memoryFileSystem = (fileSystem as HybridFileSystem).memory;
+    MemoryFileSystem memoryFileSystem =
+        (cloneFileSystem as HybridFileSystem).memory;
 
     String filename = 'full-component-$isolateId.dill';
     Sink sink = FileSink(memoryFileSystem.entityForUri(Uri.file(filename)));
@@ -396,6 +410,26 @@ IncrementalCompilerWrapper lookupIncrementalCompiler(int isolateId) {
   return isolateCompilers[isolateId];
 }
 
+String _configurationKey(String packageConfig, Uri platformKernelPath,
+        bool suppressWarnings, bool enableAsserts, int nullSafety,
+        List<String> experimentalFlags) =>
+    '$packageConfig|$platformKernelPath|$suppressWarnings|$enableAsserts'
+    '|$nullSafety|${experimentalFlags?.join(',')}';
+
+/// Returns a warm compiler that can seed a session for the given
+/// configuration, or null. Only compilers with an initialized generator are
+/// candidates; cloning one shares its parsed platform and package summaries.
+IncrementalCompilerWrapper _lookupSeedCompiler(String configurationKey) {
+  for (IncrementalCompilerWrapper candidate in isolateCompilers.values) {
+    if (candidate != null &&
+        candidate.generator != null &&
+        candidate.configurationKey == configurationKey) {
+      return candidate;
+    }
+  }
+  return null;
+}
+
 Future<Compiler> lookupOrBuildNewIncrementalCompiler(int isolateId,
     List sourceFiles, Uri platformKernelPath, List<int> platformKernel,
     {bool suppressWarnings: false,
@@ -420,20 +454,37 @@ Future<Compiler> lookupOrBuildNewIncrementalCompiler(int isolateId,
       var source = isolateCompilers.entries.first;
       compiler = await source.value.clone(isolateId);
     } else {
-      FileSystem fileSystem = _buildFileSystem(
-          sourceFiles, platformKernel, multirootFilepaths, multirootScheme);
-
-      // TODO(aam): IncrementalCompilerWrapper instance created below have to be
-      // destroyed when corresponding isolate is shut down. To achieve that kernel
-      // isolate needs to receive a message indicating that particular
-      // isolate was shut down. Message should be handled here in this script.
-      compiler = new IncrementalCompilerWrapper(
-          isolateId, fileSystem, platformKernelPath,
-          suppressWarnings: suppressWarnings,
-          enableAsserts: enableAsserts,
-          nullSafety: nullSafety,
-          experimentalFlags: experimentalFlags,
-          packageConfig: packageConfig);
+      // Back-to-back compiles against the same package config and flags
+      // (e.g. a test runner spawning sibling entry points) can seed the new
+      // session from a warm compiler instead of re-parsing the platform and
+      // package summaries. Only safe when this request carries no in-memory
+      // source or platform overrides of its own.
+      IncrementalCompilerWrapper seed = null;
+      if ((sourceFiles == null || sourceFiles.isEmpty) &&
+          platformKernel == null &&
+          multirootFilepaths == null) {
+        seed = _lookupSeedCompiler(_configurationKey(packageConfig,
+            platformKernelPath, suppressWarnings, enableAsserts, nullSafety,
+            experimentalFlags));
+      }
+      if (seed != null) {
+        compiler = await seed.clone(isolateId);
+      } else {
+        FileSystem fileSystem = _buildFileSystem(
+            sourceFiles, platformKernel, multirootFilepaths, multirootScheme);
+
+        // TODO(aam): IncrementalCompilerWrapper instance created below have to
+        // be destroyed when corresponding isolate is shut down. To achieve that
+        // kernel isolate needs to receive a message indicating that particular
+        // isolate was shut down. Message should be handled here in this script.
+        compiler = new IncrementalCompilerWrapper(
+            isolateId, fileSystem, platformKernelPath,
+            suppressWarnings: suppressWarnings,
+            enableAsserts: enableAsserts,
+            nullSafety: nullSafety,
+            experimentalFlags: experimentalFlags,
+            packageConfig: packageConfig);
+      }
     }
     isolateCompilers[isolateId] = compiler;
   }
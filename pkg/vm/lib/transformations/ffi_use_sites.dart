@@ -174,6 +174,7 @@ class _FfiUseSiteTransformer extends FfiTransformer {
         _ensureNativeTypeValid(nativeType, node, allowStructs: false);
         _ensureNativeTypeToDartType(nativeType, dartType, node,
             allowStructs: false);
+        _ensureIsLeafIsConst(node);
         return _replaceLookupFunction(node);
       } else if (target == asFunctionMethod) {
         final DartType dartType = node.arguments.types[1];
@@ -186,10 +187,12 @@ class _FfiUseSiteTransformer extends FfiTransformer {
 
         final DartType nativeSignature =
             (nativeType as InterfaceType).typeArguments[0];
+        _ensureIsLeafIsConst(node);
+        final bool isLeaf = _getIsLeafBoolean(node);
         // Inline function body to make all type arguments instatiated.
         return StaticInvocation(
             asFunctionInternal,
-            Arguments([node.arguments.positional[0]],
+            Arguments([node.arguments.positional[0], BoolLiteral(isLeaf)],
                 types: [dartType, nativeSignature]));
       } else if (target == fromFunctionMethod) {
         final DartType nativeType = InterfaceType(
@@ -293,7 +296,8 @@ class _FfiUseSiteTransformer extends FfiTransformer {
   Expression _replaceLookupFunction(StaticInvocation node) {
     // The generated code looks like:
     //
-    // _asFunctionInternal<DS, NS>(lookup<NativeFunction<NS>>(symbolName))
+    // _asFunctionInternal<DS, NS>(
+    //     lookup<NativeFunction<NS>>(symbolName), isLeaf)
 
     final DartType nativeSignature = node.arguments.types[0];
     final DartType dartSignature = node.arguments.types[1];
@@ -310,8 +314,11 @@ class _FfiUseSiteTransformer extends FfiTransformer {
         args,
         libraryLookupMethod);
 
-    return StaticInvocation(asFunctionInternal,
-        Arguments([lookupResult], types: [dartSignature, nativeSignature]));
+    final bool isLeaf = _getIsLeafBoolean(node);
+    return StaticInvocation(
+        asFunctionInternal,
+        Arguments([lookupResult, BoolLiteral(isLeaf)],
+            types: [dartSignature, nativeSignature]));
   }
 
   // We need to rewrite calls to 'fromFunction' into two calls, representing the
@@ -433,6 +440,34 @@ class _FfiUseSiteTransformer extends FfiTransformer {
         null;
   }
 
+  /// Returns the value of the `isLeaf` argument, `false` if the argument is
+  /// omitted, and `null` if it is not a constant boolean.
+  bool _getIsLeafBoolean(StaticInvocation node) {
+    for (final named in node.arguments.named) {
+      if (named.name == 'isLeaf') {
+        final Expression value = named.value;
+        if (value is BoolLiteral) {
+          return value.value;
+        }
+        if (value is ConstantExpression && value.constant is BoolConstant) {
+          return (value.constant as BoolConstant).value;
+        }
+        // The 'isLeaf' argument is some invalid expression.
+        return null;
+      }
+    }
+    // The 'isLeaf' argument defaults to false.
+    return false;
+  }
+
+  void _ensureIsLeafIsConst(StaticInvocation node) {
+    if (_getIsLeafBoolean(node) == null) {
+      diagnosticReporter.report(messageFfiExpectedConstant, node.fileOffset, 1,
+          node.location.file);
+      throw _FfiStaticTypeError();
+    }
+  }
+
   void _ensureIsStaticFunction(Expression node) {
     if ((node is StaticGet && node.target is Procedure) ||
         (node is ConstantExpression && node.constant is TearOffConstant)) {
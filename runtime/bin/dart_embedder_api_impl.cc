@@ -6,6 +6,7 @@
 
 #include "bin/dartutils.h"
 #include "bin/eventhandler.h"
+#include "bin/io_buffer.h"
 #include "bin/isolate_data.h"
 #include "bin/process.h"
 #include "bin/secure_socket_filter.h"
@@ -39,6 +40,7 @@ bool InitOnce(char** error) {
     return false;
   }
   bin::TimerUtils::InitOnce();
+  bin::IOBuffer::Init();
   bin::Process::Init();
 #if !defined(DART_IO_SECURE_SOCKET_DISABLED)
   bin::SSLFilter::Init();
@@ -55,6 +57,7 @@ void Cleanup() {
   bin::SSLFilter::Cleanup();
 #endif
   bin::Process::Cleanup();
+  bin::IOBuffer::Cleanup();
 }
 
 Dart_Isolate CreateKernelServiceIsolate(const IsolateCreationData& data,
@@ -7,6 +7,7 @@
 #include "bin/crypto.h"
 #include "bin/directory.h"
 #include "bin/eventhandler.h"
+#include "bin/io_buffer.h"
 #include "bin/io_natives.h"
 #include "bin/platform.h"
 #include "bin/process.h"
@@ -20,6 +21,7 @@ namespace bin {
 void BootstrapDartIo() {
   // Bootstrap 'dart:io' event handler.
   TimerUtils::InitOnce();
+  IOBuffer::Init();
   Process::Init();
 #if !defined(DART_IO_SECURE_SOCKET_DISABLED)
   SSLFilter::Init();
@@ -33,6 +35,7 @@ void CleanupDartIo() {
   SSLFilter::Cleanup();
 #endif
   Process::Cleanup();
+  IOBuffer::Cleanup();
 }
 
 void SetSystemTempDirectory(const char* system_temp) {
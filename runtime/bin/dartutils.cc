@@ -52,6 +52,9 @@ const char* const DartUtils::kVMServiceLibURL = "dart:vmservice";
 dart::SimpleHashMap* DartUtils::environment_ = NULL;
 
 MagicNumberData appjit_magic_number = {8, {0xdc, 0xdc, 0xf6, 0xf6, 0, 0, 0, 0}};
+MagicNumberData appjit_gzip_magic_number = {8,
+                                            {0xdc, 0xdc, 0xf6, 0xf7, 0, 0, 0,
+                                             0}};
 MagicNumberData kernel_magic_number = {4, {0x90, 0xab, 0xcd, 0xef}};
 MagicNumberData kernel_list_magic_number = {
     7,
@@ -445,6 +448,10 @@ DartUtils::MagicNumber DartUtils::SniffForMagicNumber(const uint8_t* buffer,
     return kAppJITMagicNumber;
   }
 
+  if (CheckMagicNumber(buffer, buffer_length, appjit_gzip_magic_number)) {
+    return kAppJITMagicNumber;
+  }
+
   if (CheckMagicNumber(buffer, buffer_length, kernel_magic_number)) {
     return kKernelMagicNumber;
   }
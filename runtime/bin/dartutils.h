@@ -597,6 +597,7 @@ struct MagicNumberData {
 };
 
 extern MagicNumberData appjit_magic_number;
+extern MagicNumberData appjit_gzip_magic_number;
 extern MagicNumberData kernel_magic_number;
 extern MagicNumberData kernel_list_magic_number;
 extern MagicNumberData gzip_magic_number;
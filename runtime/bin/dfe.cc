@@ -9,9 +9,13 @@
 #include "bin/error_exit.h"
 #include "bin/exe_utils.h"
 #include "bin/file.h"
+#include "bin/lockers.h"
 #include "bin/platform.h"
+#include "bin/thread.h"
 #include "bin/utils.h"
 #include "include/dart_tools_api.h"
+#include "platform/growable_array.h"
+#include "platform/text_buffer.h"
 #include "platform/utils.h"
 
 extern "C" {
@@ -64,6 +68,7 @@ DFE::DFE()
     : use_dfe_(false),
       use_incremental_compiler_(false),
       frontend_filename_(nullptr),
+      kernel_cache_path_(nullptr),
       application_kernel_buffer_(nullptr),
       application_kernel_buffer_size_(0) {
 }
@@ -74,6 +79,11 @@ DFE::~DFE() {
   }
   frontend_filename_ = nullptr;
 
+  if (kernel_cache_path_ != nullptr) {
+    free(kernel_cache_path_);
+  }
+  kernel_cache_path_ = nullptr;
+
   free(application_kernel_buffer_);
   application_kernel_buffer_ = nullptr;
   application_kernel_buffer_size_ = 0;
@@ -180,6 +190,214 @@ const char* PathSanitizer::sanitized_uri() const {
 #endif  // defined(HOST_OS_WINDOWS)
 }
 
+// Defined with the kernel file readers below.
+static bool TryReadFile(const char* script_uri,
+                        uint8_t** buffer,
+                        intptr_t* size);
+
+// The on-disk kernel cache. Each entry records the SDK version, the script
+// and package config it was compiled for, and a content hash of every file
+// the compilation depended on, followed by the kernel binary itself. An entry
+// is only used when all of the recorded hashes still match, so any edit to
+// the program's sources invalidates it.
+static const char kKernelCacheMagic[] = "dartkernelcache";
+
+static bool HashSourceFile(const char* path, uint32_t* hash) {
+  uint8_t* buffer = nullptr;
+  intptr_t size = 0;
+  if (!TryReadFile(path, &buffer, &size)) {
+    return false;
+  }
+  *hash = Utils::StringHash(reinterpret_cast<const char*>(buffer), size);
+  free(buffer);
+  return true;
+}
+
+// Consumes the next '\n'-terminated line, NUL-terminating it in place.
+// Returns nullptr if there is no further line.
+static char* NextLine(char** cursor, char* limit) {
+  char* line = *cursor;
+  char* newline = reinterpret_cast<char*>(memchr(line, '\n', limit - line));
+  if (newline == nullptr) {
+    return nullptr;
+  }
+  *newline = '\0';
+  *cursor = newline + 1;
+  return line;
+}
+
+static bool ConsumeExpectedLine(char** cursor, char* limit,
+                                const char* expected) {
+  char* line = NextLine(cursor, limit);
+  return (line != nullptr) && (strcmp(line, expected) == 0);
+}
+
+static bool ParseInt64Line(char* line, int64_t* value) {
+  if ((line == nullptr) || (*line == '\0')) {
+    return false;
+  }
+  char* end = nullptr;
+  *value = strtoll(line, &end, 10);
+  return (end != nullptr) && (*end == '\0');
+}
+
+char* DFE::KernelCachePathFor(const char* script_uri,
+                              const char* package_config) {
+  if (kernel_cache_path_ == nullptr) {
+    return nullptr;
+  }
+  // The entry name covers everything apart from the source contents that
+  // selects a compilation: the script, the package resolution and the SDK
+  // version. The sources themselves are validated against the hashes
+  // recorded inside the entry.
+  uint32_t hash = Utils::StringHash(script_uri, strlen(script_uri));
+  if (package_config != nullptr) {
+    hash = (hash * 31) +
+           Utils::StringHash(package_config, strlen(package_config));
+  }
+  const char* version = Dart_VersionString();
+  hash = (hash * 31) + Utils::StringHash(version, strlen(version));
+  return Utils::SCreate("%s%s%08x.dill", kernel_cache_path_,
+                        File::PathSeparator(), hash);
+}
+
+bool DFE::TryLoadCachedKernel(const char* script_uri,
+                              const char* package_config,
+                              uint8_t** kernel_buffer,
+                              intptr_t* kernel_buffer_size) {
+  char* cache_path = KernelCachePathFor(script_uri, package_config);
+  if (cache_path == nullptr) {
+    return false;
+  }
+
+  uint8_t* buffer = nullptr;
+  intptr_t size = 0;
+  const bool loaded = TryReadFile(cache_path, &buffer, &size);
+  free(cache_path);
+  if (!loaded) {
+    return false;
+  }
+
+  char* cursor = reinterpret_cast<char*>(buffer);
+  char* limit = cursor + size;
+  bool valid =
+      ConsumeExpectedLine(&cursor, limit, kKernelCacheMagic) &&
+      ConsumeExpectedLine(&cursor, limit, Dart_VersionString()) &&
+      ConsumeExpectedLine(&cursor, limit, script_uri) &&
+      ConsumeExpectedLine(&cursor, limit,
+                          package_config != nullptr ? package_config : "-");
+
+  int64_t num_deps = 0;
+  if (valid) {
+    valid = ParseInt64Line(NextLine(&cursor, limit), &num_deps);
+  }
+  for (int64_t i = 0; valid && (i < num_deps); i++) {
+    char* line = NextLine(&cursor, limit);
+    char* space = (line != nullptr) ? strchr(line, ' ') : nullptr;
+    if (space == nullptr) {
+      valid = false;
+      break;
+    }
+    *space = '\0';
+    const uint32_t recorded_hash =
+        static_cast<uint32_t>(strtoul(line, nullptr, 16));
+    uint32_t current_hash = 0;
+    valid = HashSourceFile(space + 1, &current_hash) &&
+            (current_hash == recorded_hash);
+  }
+
+  int64_t kernel_size = 0;
+  if (valid) {
+    valid = ParseInt64Line(NextLine(&cursor, limit), &kernel_size) &&
+            ((limit - cursor) == kernel_size);
+  }
+  valid = valid &&
+          (DartUtils::SniffForMagicNumber(reinterpret_cast<uint8_t*>(cursor),
+                                          kernel_size) ==
+           DartUtils::kKernelMagicNumber);
+  if (!valid) {
+    free(buffer);
+    return false;
+  }
+
+  memmove(buffer, cursor, kernel_size);
+  *kernel_buffer = buffer;
+  *kernel_buffer_size = kernel_size;
+  return true;
+}
+
+void DFE::StoreKernelInCache(const char* script_uri,
+                             const char* package_config,
+                             const uint8_t* kernel_buffer,
+                             intptr_t kernel_buffer_size) {
+  char* cache_path = KernelCachePathFor(script_uri, package_config);
+  if (cache_path == nullptr) {
+    return;
+  }
+
+  // The kernel service tracked every file the compilation read.
+  Dart_KernelCompilationResult deps_result = Dart_KernelListDependencies();
+  if (deps_result.status != Dart_KernelCompilationStatus_Ok) {
+    free(cache_path);
+    return;
+  }
+
+  // The dependency list is a space-separated list of paths.
+  TextBuffer dep_lines(1 * KB);
+  intptr_t num_deps = 0;
+  bool hashed = true;
+  char* deps_cursor = reinterpret_cast<char*>(deps_result.kernel);
+  char* deps_limit = deps_cursor + deps_result.kernel_size;
+  while (hashed && (deps_cursor < deps_limit)) {
+    char* space = reinterpret_cast<char*>(
+        memchr(deps_cursor, ' ', deps_limit - deps_cursor));
+    char* end = (space != nullptr) ? space : deps_limit;
+    if (end != deps_cursor) {
+      char* path = Utils::StrNDup(deps_cursor, end - deps_cursor);
+      uint32_t hash = 0;
+      hashed = HashSourceFile(path, &hash);
+      if (hashed) {
+        dep_lines.Printf("%08x %s\n", hash, path);
+        num_deps++;
+      }
+      free(path);
+    }
+    deps_cursor = end + 1;
+  }
+  free(deps_result.kernel);
+  if (!hashed) {
+    free(cache_path);
+    return;
+  }
+
+  File* file = File::Open(nullptr, cache_path, File::kWriteTruncate);
+  if (file == nullptr) {
+    // The cache directory might not exist yet.
+    Directory::Create(nullptr, kernel_cache_path_);
+    file = File::Open(nullptr, cache_path, File::kWriteTruncate);
+  }
+  if (file == nullptr) {
+    free(cache_path);
+    return;
+  }
+
+  TextBuffer header(1 * KB);
+  header.Printf("%s\n%s\n%s\n%s\n%" Pd "\n", kKernelCacheMagic,
+                Dart_VersionString(), script_uri,
+                package_config != nullptr ? package_config : "-", num_deps);
+  bool success = file->WriteFully(header.buffer(), header.length()) &&
+                 file->WriteFully(dep_lines.buffer(), dep_lines.length());
+  header.Clear();
+  header.Printf("%" Pd "\n", kernel_buffer_size);
+  success = success && file->WriteFully(header.buffer(), header.length()) &&
+            file->WriteFully(kernel_buffer, kernel_buffer_size);
+  file->Release();
+  if (!success) {
+    File::Delete(nullptr, cache_path);
+  }
+  free(cache_path);
+}
+
 Dart_KernelCompilationResult DFE::CompileScript(const char* script_uri,
                                                 bool incremental,
                                                 const char* package_config) {
@@ -199,6 +417,12 @@ void DFE::CompileAndReadScript(const char* script_uri,
                                char** error,
                                int* exit_code,
                                const char* package_config) {
+  if (TryLoadCachedKernel(script_uri, package_config, kernel_buffer,
+                          kernel_buffer_size)) {
+    *error = nullptr;
+    *exit_code = 0;
+    return;
+  }
   Dart_KernelCompilationResult result =
       CompileScript(script_uri, use_incremental_compiler(), package_config);
   switch (result.status) {
@@ -207,6 +431,8 @@ void DFE::CompileAndReadScript(const char* script_uri,
       *kernel_buffer_size = result.kernel_size;
       *error = nullptr;
       *exit_code = 0;
+      StoreKernelInCache(script_uri, package_config, *kernel_buffer,
+                         *kernel_buffer_size);
       break;
     case Dart_KernelCompilationStatus_Error:
       free(result.kernel);
@@ -344,18 +570,6 @@ class KernelIRNode {
   DISALLOW_COPY_AND_ASSIGN(KernelIRNode);
 };
 
-class StringPointer {
- public:
-  explicit StringPointer(char* c_str) : c_str_(c_str) {}
-  ~StringPointer() { free(c_str_); }
-
-  const char* c_str() { return c_str_; }
-
- private:
-  char* c_str_;
-  DISALLOW_COPY_AND_ASSIGN(StringPointer);
-};
-
 // Supports "kernel list" files as input.
 // Those are text files that start with '#@dill' on new line, followed
 // by absolute paths to kernel files or relative paths, that are relative
@@ -366,6 +580,30 @@ class StringPointer {
 // /projects/mytest/build/bin/main.vm.dill
 // /projects/mytest/build/packages/mytest/lib.vm.dill
 // ```
+// One file from a kernel list, read on its own thread. The list names the
+// program's full dependency closure, and the reads are independent, so they
+// are issued in parallel instead of one at a time.
+struct KernelListEntry {
+  Monitor* monitor;
+  intptr_t* pending;
+  char* filename;
+  uint8_t* kernel_ir;
+  intptr_t kernel_size;
+  bool success;
+};
+
+static void ReadKernelListEntry(uword parameter) {
+  KernelListEntry* entry = reinterpret_cast<KernelListEntry*>(parameter);
+  uint8_t* buffer = nullptr;
+  entry->success =
+      TryReadFile(entry->filename, &buffer, &entry->kernel_size) &&
+      TryReadSimpleKernelBuffer(buffer, &entry->kernel_ir,
+                                &entry->kernel_size);
+  MonitorLocker ml(entry->monitor);
+  (*entry->pending)--;
+  ml.Notify();
+}
+
 static bool TryReadKernelListBuffer(const char* script_uri,
                                     uint8_t* buffer,
                                     intptr_t buffer_size,
@@ -375,44 +613,73 @@ static bool TryReadKernelListBuffer(const char* script_uri,
   if (strcmp(kernel_list_dirname, script_uri) == 0) {
     kernel_list_dirname = "";
   }
-  KernelIRNode* kernel_ir_head = nullptr;
-  KernelIRNode* kernel_ir_tail = nullptr;
-  // Add all kernels to the linked list
+
+  // Collect the resolved filenames first, then fetch them in parallel.
+  MallocGrowableArray<KernelListEntry*> entries;
+  Monitor monitor;
+  intptr_t pending = 0;
   char* filename =
       reinterpret_cast<char*>(buffer + kernel_list_magic_number.length);
   intptr_t filename_size = buffer_size - kernel_list_magic_number.length;
   char* tail = reinterpret_cast<char*>(memchr(filename, '\n', filename_size));
   while (tail != nullptr) {
     *tail = '\0';
-    intptr_t this_kernel_size;
-    uint8_t* this_buffer;
-
-    StringPointer resolved_filename(
-        File::IsAbsolutePath(filename)
-            ? Utils::StrDup(filename)
-            : Utils::SCreate("%s%s", kernel_list_dirname, filename));
-    if (!TryReadFile(resolved_filename.c_str(), &this_buffer,
-                     &this_kernel_size)) {
-      return false;
-    }
-
-    uint8_t* this_kernel_ir;
-    if (!TryReadSimpleKernelBuffer(this_buffer, &this_kernel_ir,
-                                   &this_kernel_size)) {
-      // Abandon read if any of the files in the list are invalid.
-      KernelIRNode::Delete(kernel_ir_head);
-      *kernel_ir = nullptr;
-      *kernel_ir_size = -1;
-      return false;
-    }
-    KernelIRNode::Add(&kernel_ir_head, &kernel_ir_tail,
-                      new KernelIRNode(this_kernel_ir, this_kernel_size));
+    KernelListEntry* entry = new KernelListEntry();
+    entry->monitor = &monitor;
+    entry->pending = &pending;
+    entry->filename = File::IsAbsolutePath(filename)
+                          ? Utils::StrDup(filename)
+                          : Utils::SCreate("%s%s", kernel_list_dirname,
+                                           filename);
+    entry->kernel_ir = nullptr;
+    entry->kernel_size = -1;
+    entry->success = false;
+    entries.Add(entry);
     filename_size -= tail + 1 - filename;
     filename = tail + 1;
     tail = reinterpret_cast<char*>(memchr(filename, '\n', filename_size));
   }
   free(buffer);
 
+  pending = entries.length();
+  for (intptr_t i = 0; i < entries.length(); i++) {
+    if (Thread::Start("kernel-list-reader", ReadKernelListEntry,
+                      reinterpret_cast<uword>(entries[i])) != 0) {
+      // Thread creation failed; read on this thread instead.
+      ReadKernelListEntry(reinterpret_cast<uword>(entries[i]));
+    }
+  }
+  {
+    MonitorLocker ml(&monitor);
+    while (pending > 0) {
+      ml.Wait();
+    }
+  }
+
+  // Abandon the read if any of the files in the list are invalid.
+  bool success = true;
+  KernelIRNode* kernel_ir_head = nullptr;
+  KernelIRNode* kernel_ir_tail = nullptr;
+  for (intptr_t i = 0; i < entries.length(); i++) {
+    KernelListEntry* entry = entries[i];
+    if (success && entry->success) {
+      // The node takes ownership of the kernel buffer.
+      KernelIRNode::Add(&kernel_ir_head, &kernel_ir_tail,
+                        new KernelIRNode(entry->kernel_ir, entry->kernel_size));
+    } else {
+      success = false;
+      free(entry->kernel_ir);
+    }
+    free(entry->filename);
+    delete entry;
+  }
+  if (!success) {
+    KernelIRNode::Delete(kernel_ir_head);
+    *kernel_ir = nullptr;
+    *kernel_ir_size = -1;
+    return false;
+  }
+
   KernelIRNode::Merge(kernel_ir_head, kernel_ir, kernel_ir_size);
   KernelIRNode::Delete(kernel_ir_head);
   return true;
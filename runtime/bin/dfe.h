@@ -42,6 +42,16 @@ class DFE {
   }
   bool use_incremental_compiler() const { return use_incremental_compiler_; }
 
+  // Directory used to cache kernel binaries between runs, or nullptr if
+  // caching is disabled.
+  void set_kernel_cache(const char* path) {
+    if (kernel_cache_path_ != nullptr) {
+      free(kernel_cache_path_);
+    }
+    kernel_cache_path_ = Utils::StrDup(path);
+  }
+  const char* kernel_cache() const { return kernel_cache_path_; }
+
   // Returns the platform binary file name if the path to
   // kernel binaries was set using SetKernelBinaries.
   const char* GetPlatformBinaryFilename();
@@ -107,6 +117,7 @@ class DFE {
   bool use_dfe_;
   bool use_incremental_compiler_;
   char* frontend_filename_;
+  char* kernel_cache_path_;
 
   // Kernel binary specified on the cmd line.
   uint8_t* application_kernel_buffer_;
@@ -114,6 +125,25 @@ class DFE {
 
   void InitKernelServiceAndPlatformDills();
 
+  // Returns the path of the cache entry for [script_uri], allocated with
+  // malloc, or nullptr if caching is disabled.
+  char* KernelCachePathFor(const char* script_uri, const char* package_config);
+
+  // Tries to satisfy a compilation from the on-disk kernel cache. Returns
+  // true and a malloc'ed kernel buffer if a cache entry exists and all the
+  // source files it was compiled from are unchanged.
+  bool TryLoadCachedKernel(const char* script_uri,
+                           const char* package_config,
+                           uint8_t** kernel_buffer,
+                           intptr_t* kernel_buffer_size);
+
+  // Writes a compilation result and the content hashes of its dependencies
+  // to the on-disk kernel cache. Best effort.
+  void StoreKernelInCache(const char* script_uri,
+                          const char* package_config,
+                          const uint8_t* kernel_buffer,
+                          intptr_t kernel_buffer_size);
+
   DISALLOW_COPY_AND_ASSIGN(DFE);
 };
 
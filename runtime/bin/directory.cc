@@ -396,7 +396,11 @@ CObject* Directory::ListNextRequest(const CObjectArray& request) {
   if (dir_listing->IsEmpty()) {
     return new CObjectArray(CObject::NewArray(0));
   }
-  const int kArraySize = 128;
+  // Each entry takes two slots (type and name). Large batches amortize the
+  // message hop to the IO service over many dirents, which matters when
+  // scanning big trees; the names are posted as external typed data, so a
+  // bigger batch does not copy more, it just defers the reply.
+  const int kArraySize = 1024;
   CObjectArray* response = new CObjectArray(CObject::NewArray(kArraySize));
   dir_listing->SetArray(response, kArraySize);
   Directory::List(dir_listing);
@@ -9,50 +9,170 @@
 #include "bin/lockers.h"
 #include "bin/socket.h"
 #include "bin/thread.h"
+#include "bin/utils.h"
 
 #include "include/dart_api.h"
 
 namespace dart {
 namespace bin {
 
-void TimeoutQueue::UpdateTimeout(Dart_Port port, int64_t timeout) {
-  // Find port if present.
-  Timeout* last = NULL;
-  Timeout* current = timeouts_;
-  while (current != NULL) {
-    if (current->port() == port) {
-      // Found.
-      if (timeout < 0) {
-        // Remove from list and delete existing.
-        if (last != NULL) {
-          last->set_next(current->next());
-        } else {
-          timeouts_ = current->next();
-        }
-        delete current;
-      } else {
-        // Update timeout.
-        current->set_timeout(timeout);
-      }
+TimeoutQueue::TimeoutQueue()
+    : heap_(new Timeout*[kInitialCapacity]),
+      heap_used_(0),
+      heap_capacity_(kInitialCapacity),
+      map_(new Timeout*[kInitialCapacity]()),
+      map_live_(0),
+      map_deleted_(0),
+      map_capacity_(kInitialCapacity) {}
+
+TimeoutQueue::~TimeoutQueue() {
+  for (intptr_t i = 0; i < heap_used_; i++) {
+    delete heap_[i];
+  }
+  delete[] heap_;
+  delete[] map_;
+}
+
+uint32_t TimeoutQueue::HashPort(Dart_Port port) {
+  uint64_t hash = static_cast<uint64_t>(port);
+  hash ^= hash >> 32;
+  return static_cast<uint32_t>(hash) * 2654435761u;
+}
+
+intptr_t TimeoutQueue::FindSlot(Dart_Port port) const {
+  const intptr_t mask = map_capacity_ - 1;
+  intptr_t index = HashPort(port) & mask;
+  while (map_[index] != NULL) {
+    Timeout* entry = map_[index];
+    if ((entry != DeletedSlot()) && (entry->port == port)) {
+      return index;
+    }
+    index = (index + 1) & mask;
+  }
+  return -1;
+}
+
+void TimeoutQueue::InsertIntoMap(Timeout* timeout) {
+  // Keep at least a quarter of the slots empty so probes stay short and
+  // always hit an empty slot.
+  if (((map_live_ + map_deleted_ + 1) * 4) >= (map_capacity_ * 3)) {
+    GrowMap();
+  }
+  const intptr_t mask = map_capacity_ - 1;
+  intptr_t index = HashPort(timeout->port) & mask;
+  while ((map_[index] != NULL) && (map_[index] != DeletedSlot())) {
+    index = (index + 1) & mask;
+  }
+  if (map_[index] == DeletedSlot()) {
+    map_deleted_--;
+  }
+  map_[index] = timeout;
+  map_live_++;
+}
+
+void TimeoutQueue::GrowMap() {
+  const intptr_t old_capacity = map_capacity_;
+  Timeout** old_map = map_;
+  map_capacity_ = old_capacity * 2;
+  map_ = new Timeout*[map_capacity_]();
+  map_live_ = 0;
+  map_deleted_ = 0;
+  const intptr_t mask = map_capacity_ - 1;
+  for (intptr_t i = 0; i < old_capacity; i++) {
+    Timeout* entry = old_map[i];
+    if ((entry == NULL) || (entry == DeletedSlot())) {
+      continue;
+    }
+    intptr_t index = HashPort(entry->port) & mask;
+    while (map_[index] != NULL) {
+      index = (index + 1) & mask;
+    }
+    map_[index] = entry;
+    map_live_++;
+  }
+  delete[] old_map;
+}
+
+void TimeoutQueue::HeapAdd(Timeout* timeout) {
+  if (heap_used_ == heap_capacity_) {
+    heap_capacity_ *= 2;
+    Timeout** new_heap = new Timeout*[heap_capacity_];
+    for (intptr_t i = 0; i < heap_used_; i++) {
+      new_heap[i] = heap_[i];
+    }
+    delete[] heap_;
+    heap_ = new_heap;
+  }
+  timeout->heap_index = heap_used_;
+  heap_[heap_used_++] = timeout;
+  HeapSift(timeout->heap_index);
+}
+
+void TimeoutQueue::HeapRemove(Timeout* timeout) {
+  const intptr_t index = timeout->heap_index;
+  heap_used_--;
+  if (index != heap_used_) {
+    heap_[index] = heap_[heap_used_];
+    heap_[index]->heap_index = index;
+    HeapSift(index);
+  }
+}
+
+void TimeoutQueue::HeapSift(intptr_t index) {
+  Timeout* entry = heap_[index];
+  while (index > 0) {
+    const intptr_t parent = (index - 1) / 2;
+    if (heap_[parent]->deadline <= entry->deadline) {
+      break;
+    }
+    heap_[index] = heap_[parent];
+    heap_[index]->heap_index = index;
+    index = parent;
+  }
+  while (true) {
+    intptr_t child = (2 * index) + 1;
+    if (child >= heap_used_) {
+      break;
+    }
+    if (((child + 1) < heap_used_) &&
+        (heap_[child + 1]->deadline < heap_[child]->deadline)) {
+      child++;
+    }
+    if (heap_[child]->deadline >= entry->deadline) {
       break;
     }
-    last = current;
-    current = current->next();
-  }
-  if (current == NULL && timeout >= 0) {
-    // Not found, create a new.
-    timeouts_ = new Timeout(port, timeout, timeouts_);
-  }
-  // Clear and find next timeout.
-  next_timeout_ = NULL;
-  current = timeouts_;
-  while (current != NULL) {
-    if ((next_timeout_ == NULL) ||
-        (current->timeout() < next_timeout_->timeout())) {
-      next_timeout_ = current;
+    heap_[index] = heap_[child];
+    heap_[index]->heap_index = index;
+    index = child;
+  }
+  heap_[index] = entry;
+  entry->heap_index = index;
+}
+
+void TimeoutQueue::UpdateTimeout(Dart_Port port, int64_t timeout) {
+  const intptr_t slot = FindSlot(port);
+  if (slot >= 0) {
+    Timeout* entry = map_[slot];
+    if (timeout < 0) {
+      map_[slot] = DeletedSlot();
+      map_live_--;
+      map_deleted_++;
+      HeapRemove(entry);
+      delete entry;
+    } else {
+      entry->deadline = timeout;
+      HeapSift(entry->heap_index);
     }
-    current = current->next();
+    return;
   }
+  if (timeout < 0) {
+    return;
+  }
+  Timeout* entry = new Timeout();
+  entry->port = port;
+  entry->deadline = timeout;
+  HeapAdd(entry);
+  InsertIntoMap(entry);
 }
 
 static EventHandler* event_handler = NULL;
@@ -61,6 +181,7 @@ static Monitor* shutdown_monitor = NULL;
 void EventHandler::Start() {
   // Initialize global socket registry.
   ListeningSocketRegistry::Initialize();
+  LookupCache::Initialize();
 
   ASSERT(event_handler == NULL);
   shutdown_monitor = new Monitor();
@@ -97,7 +218,8 @@ void EventHandler::Stop() {
   delete shutdown_monitor;
   shutdown_monitor = NULL;
 
-  // Destroy the global socket registry.
+  // Destroy the global socket registry and lookup cache.
+  LookupCache::Cleanup();
   ListeningSocketRegistry::Cleanup();
 }
 
@@ -112,6 +234,16 @@ void EventHandler::SendFromNative(intptr_t id, Dart_Port port, int64_t data) {
   event_handler->SendData(id, port, data);
 }
 
+void EventHandler::HintIdle(int64_t timeout_millis) {
+  if (timeout_millis < 0) {
+    // No pending timers; keep the VM's default idle deadline rather than
+    // claiming an unbounded window, since socket events can arrive anytime.
+    return;
+  }
+  Dart_HintIdle(TimerUtils::GetCurrentMonotonicMicros() +
+                timeout_millis * 1000);
+}
+
 /*
  * Send data to the EventHandler thread to register for a given instance
  * args[0] a ReceivePort args[1] with a notification event args[2].
@@ -56,57 +56,69 @@ enum MessageFlags {
 #define TOKEN_COUNT(data) (data & ((1 << kCloseCommand) - 1))
 // clang-format on
 
+// Per-port timeouts for the event handler. Entries are kept in a binary
+// min-heap ordered by deadline, with a port-indexed hash map into the heap,
+// so resetting an active connection's idle timer updates one heap entry
+// instead of walking every pending timeout.
 class TimeoutQueue {
- private:
-  class Timeout {
-   public:
-    Timeout(Dart_Port port, int64_t timeout, Timeout* next)
-        : port_(port), timeout_(timeout), next_(next) {}
-
-    Dart_Port port() const { return port_; }
-
-    int64_t timeout() const { return timeout_; }
-    void set_timeout(int64_t timeout) {
-      ASSERT(timeout >= 0);
-      timeout_ = timeout;
-    }
-
-    Timeout* next() const { return next_; }
-    void set_next(Timeout* next) { next_ = next; }
-
-   private:
-    Dart_Port port_;
-    int64_t timeout_;
-    Timeout* next_;
-  };
-
  public:
-  TimeoutQueue() : next_timeout_(NULL), timeouts_(NULL) {}
+  TimeoutQueue();
+  ~TimeoutQueue();
 
-  ~TimeoutQueue() {
-    while (HasTimeout())
-      RemoveCurrent();
-  }
-
-  bool HasTimeout() const { return next_timeout_ != NULL; }
+  bool HasTimeout() const { return heap_used_ > 0; }
 
   int64_t CurrentTimeout() const {
-    ASSERT(next_timeout_ != NULL);
-    return next_timeout_->timeout();
+    ASSERT(heap_used_ > 0);
+    return heap_[0]->deadline;
   }
 
   Dart_Port CurrentPort() const {
-    ASSERT(next_timeout_ != NULL);
-    return next_timeout_->port();
+    ASSERT(heap_used_ > 0);
+    return heap_[0]->port;
   }
 
   void RemoveCurrent() { UpdateTimeout(CurrentPort(), -1); }
 
+  // Sets or updates the timeout for `port`, or removes it if `timeout` is
+  // negative.
   void UpdateTimeout(Dart_Port port, int64_t timeout);
 
  private:
-  Timeout* next_timeout_;
-  Timeout* timeouts_;
+  struct Timeout {
+    Dart_Port port;
+    int64_t deadline;
+    intptr_t heap_index;
+  };
+
+  static const intptr_t kInitialCapacity = 16;
+
+  // Marks a map slot whose entry was removed; probe sequences skip it but do
+  // not stop there.
+  static Timeout* DeletedSlot() { return reinterpret_cast<Timeout*>(1); }
+
+  static uint32_t HashPort(Dart_Port port);
+
+  // Returns the map slot holding the entry for `port`, or -1.
+  intptr_t FindSlot(Dart_Port port) const;
+  void InsertIntoMap(Timeout* timeout);
+  void GrowMap();
+
+  void HeapAdd(Timeout* timeout);
+  void HeapRemove(Timeout* timeout);
+  // Restores the heap order for the entry at `index` after its deadline
+  // changed or it was moved into a freed slot.
+  void HeapSift(intptr_t index);
+
+  Timeout** heap_;
+  intptr_t heap_used_;
+  intptr_t heap_capacity_;
+
+  // Open-addressed map from port to heap entry; the capacity is a power of
+  // two and grows before the free slots run out, so probes terminate.
+  Timeout** map_;
+  intptr_t map_live_;
+  intptr_t map_deleted_;
+  intptr_t map_capacity_;
 
   DISALLOW_COPY_AND_ASSIGN(TimeoutQueue);
 };
@@ -616,6 +628,12 @@ class DescriptorInfoMultipleMixin : public DI {
 namespace dart {
 namespace bin {
 
+// The event handler thread multiplexes readiness, timer and lifecycle
+// notifications for the whole process, so nothing running on it may block or
+// serialize bulk data: everything it posts to Dart is a fixed-size integer
+// or null message. Bulk payloads (file reads, directory listings, ...) are
+// produced on IO service worker threads and posted as external typed data,
+// which the message writer passes by pointer instead of copying.
 class EventHandler {
  public:
   EventHandler() {}
@@ -643,6 +661,14 @@ class EventHandler {
 
   static void SendFromNative(intptr_t id, Dart_Port port, int64_t data);
 
+  /**
+   * Called by the implementations before blocking, with the relative timeout
+   * in milliseconds until the next timer expires (or kInfinityTimeout). Until
+   * then no timer message will be posted to any isolate, so the VM can treat
+   * the window as an estimate of how much idle GC work fits in.
+   */
+  static void HintIdle(int64_t timeout_millis);
+
  private:
   friend class EventHandlerImplementation;
   EventHandlerImplementation delegate_;
@@ -381,6 +381,7 @@ void EventHandlerImplementation::Poll(uword args) {
   while (!handler_impl->shutdown_) {
     int64_t millis = handler_impl->GetTimeout();
     ASSERT((millis == kInfinityTimeout) || (millis >= 0));
+    EventHandler::HintIdle(millis);
     if (millis > kMaxInt32) {
       millis = kMaxInt32;
     }
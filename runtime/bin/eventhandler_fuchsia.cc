@@ -607,6 +607,7 @@ void EventHandlerImplementation::Poll(uword args) {
   while (!handler_impl->shutdown_) {
     int64_t millis = handler_impl->GetTimeout();
     ASSERT((millis == kInfinityTimeout) || (millis >= 0));
+    EventHandler::HintIdle(millis);
 
     LOG_INFO("zx_port_wait(millis = %ld)\n", millis);
     zx_status_t status = zx_port_wait(handler_impl->port_handle_,
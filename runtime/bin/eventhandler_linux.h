@@ -14,7 +14,7 @@
 #include <sys/socket.h>
 #include <unistd.h>
 
-#include "platform/hashmap.h"
+#include "platform/fd_table.h"
 #include "platform/signal_blocker.h"
 
 namespace dart {
@@ -77,13 +77,12 @@ class EventHandlerImplementation {
   static void Poll(uword args);
   void WakeupHandler(intptr_t id, Dart_Port dart_port, int64_t data);
   void HandleInterruptFd();
+  void HandleInterruptMessages(InterruptMessage* msg, ssize_t count);
   void UpdateTimerFd();
   void SetPort(intptr_t fd, Dart_Port dart_port, intptr_t mask);
   intptr_t GetPollEvents(intptr_t events, DescriptorInfo* di);
-  static void* GetHashmapKeyFromFd(intptr_t fd);
-  static uint32_t GetHashmapHashFromFd(intptr_t fd);
 
-  SimpleHashMap socket_map_;
+  FdTable<DescriptorInfo> socket_map_;
   TimeoutQueue timeout_queue_;
   bool shutdown_;
   int interrupt_fds_[2];
@@ -36,11 +36,15 @@ static bool IsFile(Dart_Handle file_obj) {
 // to pull it out of Dart as a 64-bit integer, cast it to an intptr_t and
 // from there to a File pointer.
 static File* GetFile(Dart_NativeArguments args) {
-  File* file;
   Dart_Handle dart_this = ThrowIfError(Dart_GetNativeArgument(args, 0));
   DEBUG_ASSERT(IsFile(dart_this));
+  return File::GetPeer(dart_this);
+}
+
+File* File::GetPeer(Dart_Handle handle) {
+  File* file;
   Dart_Handle result = Dart_GetNativeInstanceField(
-      dart_this, kFileNativeFieldIndex, reinterpret_cast<intptr_t*>(&file));
+      handle, kFileNativeFieldIndex, reinterpret_cast<intptr_t*>(&file));
   ASSERT(!Dart_IsError(result));
   if (file == NULL) {
     Dart_PropagateError(Dart_NewUnhandledExceptionError(
@@ -255,6 +259,37 @@ void FUNCTION_NAME(File_ReadInto)(Dart_NativeArguments args) {
   }
 }
 
+static void ReleaseSharedFileMapping(void* isolate_callback_data, void* peer) {
+  File::UnmapSharedReadOnly(peer);
+}
+
+void FUNCTION_NAME(File_ReadFileShared)(Dart_NativeArguments args) {
+  Namespace* namespc = Namespace::GetNamespace(args, 0);
+  Dart_Handle path_handle = Dart_GetNativeArgument(args, 1);
+  const uint8_t* data = NULL;
+  intptr_t length = 0;
+  void* token = NULL;
+  {
+    TypedDataScope path_data(path_handle);
+    ASSERT(path_data.type() == Dart_TypedData_kUint8);
+    const char* filename = path_data.GetCString();
+    data = File::MapSharedReadOnly(namespc, filename, &length, &token);
+  }
+  if (data == NULL) {
+    // The caller falls back to a plain read.
+    Dart_SetReturnValue(args, Dart_Null());
+    return;
+  }
+  Dart_Handle result = Dart_NewExternalTypedDataWithFinalizer(
+      Dart_TypedData_kUint8, const_cast<uint8_t*>(data), length, token, length,
+      ReleaseSharedFileMapping);
+  if (Dart_IsError(result)) {
+    File::UnmapSharedReadOnly(token);
+    Dart_PropagateError(result);
+  }
+  Dart_SetReturnValue(args, result);
+}
+
 void FUNCTION_NAME(File_WriteFrom)(Dart_NativeArguments args) {
   File* file = GetFile(args);
   ASSERT(file != NULL);
@@ -1510,6 +1545,65 @@ CObject* File::LockRequest(const CObjectArray& request) {
              : CObject::NewOSError();
 }
 
+CObject* File::ReadEntireFileRequest(const CObjectArray& request) {
+  if ((request.Length() < 1) || !request[0]->IsIntptr()) {
+    return CObject::IllegalArgumentError();
+  }
+  Namespace* namespc = CObjectToNamespacePointer(request[0]);
+  RefCntReleaseScope<Namespace> rs(namespc);
+  if ((request.Length() != 2) || !request[1]->IsUint8Array()) {
+    return CObject::IllegalArgumentError();
+  }
+  CObjectUint8Array filename(request[1]);
+  File* file = File::Open(
+      namespc, reinterpret_cast<const char*>(filename.Buffer()), kRead);
+  if (file == NULL) {
+    return CObject::NewOSError();
+  }
+  // The file was opened here and no reference escapes to Dart code, so
+  // releasing it below runs the destructor, which closes the file.
+  RefCntReleaseScope<File> rs2(file);
+  const int64_t length = file->Length();
+  if (length < 0) {
+    return CObject::NewOSError();
+  }
+  if (length == 0) {
+    // May be a character device or a pseudo file that reports a zero
+    // length; signal the caller to fall back to chunked reads.
+    CObjectArray* result = new CObjectArray(CObject::NewArray(2));
+    result->SetAt(0, new CObjectIntptr(CObject::NewInt32(0)));
+    result->SetAt(1, CObject::Null());
+    return result;
+  }
+  Dart_CObject* io_buffer = CObject::NewIOBuffer(length);
+  if (io_buffer == NULL) {
+    return CObject::NewOSError();
+  }
+  uint8_t* data = io_buffer->value.as_external_typed_data.data;
+  int64_t total_read = 0;
+  while (total_read < length) {
+    const int64_t bytes_read =
+        file->Read(data + total_read, length - total_read);
+    if (bytes_read < 0) {
+      CObject* error = CObject::NewOSError();
+      CObject::FreeIOBufferData(io_buffer);
+      return error;
+    }
+    if (bytes_read == 0) {
+      // The file shrank between the length query and the read.
+      break;
+    }
+    total_read += bytes_read;
+  }
+  CObjectExternalUint8Array* external_array =
+      new CObjectExternalUint8Array(io_buffer);
+  external_array->SetLength(total_read);
+  CObjectArray* result = new CObjectArray(CObject::NewArray(2));
+  result->SetAt(0, new CObjectIntptr(CObject::NewInt32(0)));
+  result->SetAt(1, external_array);
+  return result;
+}
+
 // Inspired by sdk/lib/core/uri.dart
 UriDecoder::UriDecoder(const char* uri) : uri_(uri) {
   const char* ch = uri;
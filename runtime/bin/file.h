@@ -221,6 +221,10 @@ class File : public ReferenceCounted<File> {
   // (stdin, stout or stderr).
   static File* OpenStdio(int fd);
 
+  // Retrieve the file object stored as the native peer of a Dart
+  // RandomAccessFile. Propagates an error if the peer has been closed.
+  static File* GetPeer(Dart_Handle handle);
+
 #if defined(HOST_OS_FUCHSIA) || defined(HOST_OS_LINUX)
   static File* OpenFD(int fd);
 #endif
@@ -244,6 +248,22 @@ class File : public ReferenceCounted<File> {
                    const char* new_path);
   static int64_t LengthFromPath(Namespace* namespc, const char* path);
   static void Stat(Namespace* namespc, const char* path, int64_t* data);
+
+  // Returns a read-only view of the file at 'path', backed by a memory
+  // mapping that is shared with every other caller asking for the same path.
+  // The mapping is created on first use and reused as long as the file's size
+  // and modification time are unchanged. On success stores the view's length
+  // in 'length' and an opaque token in 'token', which must be passed to
+  // UnmapSharedReadOnly exactly once when the view is no longer needed.
+  // Returns NULL on failure; callers should then fall back to a plain read.
+  static const uint8_t* MapSharedReadOnly(Namespace* namespc,
+                                          const char* path,
+                                          intptr_t* length,
+                                          void** token);
+
+  // Releases a view handed out by MapSharedReadOnly. A mapping that has
+  // become stale is removed once its last outstanding view is released.
+  static void UnmapSharedReadOnly(void* token);
   static time_t LastModified(Namespace* namespc, const char* path);
   static bool SetLastModified(Namespace* namespc,
                               const char* path,
@@ -318,6 +338,7 @@ class File : public ReferenceCounted<File> {
   static CObject* IdenticalRequest(const CObjectArray& request);
   static CObject* StatRequest(const CObjectArray& request);
   static CObject* LockRequest(const CObjectArray& request);
+  static CObject* ReadEntireFileRequest(const CObjectArray& request);
 
  private:
   explicit File(FileHandle* handle)
@@ -7,6 +7,8 @@
 #include "bin/builtin.h"
 #include "bin/dartutils.h"
 #include "bin/io_buffer.h"
+#include "bin/lockers.h"
+#include "bin/namespace.h"
 #include "bin/utils.h"
 
 #include "include/bin/dart_io_api.h"
@@ -84,6 +86,126 @@ bool File::WriteFully(const void* buffer, int64_t num_bytes) {
   return true;
 }
 
+// A shared read-only mapping of one version of one file. Entries stay in the
+// cache until the file changes on disk; a stale entry is unlinked from the
+// cache but kept alive until the last view over it has been released.
+class SharedFileMapping {
+ public:
+  SharedFileMapping(const char* path,
+                    int64_t size,
+                    int64_t mtime,
+                    MappedMemory* memory)
+      : path_(Utils::StrDup(path)),
+        size_(size),
+        mtime_(mtime),
+        memory_(memory),
+        // One reference for the cache itself.
+        ref_count_(1),
+        next_(NULL) {}
+
+  ~SharedFileMapping() {
+    delete memory_;
+    free(path_);
+  }
+
+  const char* path() const { return path_; }
+  const uint8_t* data() const {
+    return reinterpret_cast<const uint8_t*>(memory_->address());
+  }
+  int64_t size() const { return size_; }
+  SharedFileMapping* next() const { return next_; }
+  void set_next(SharedFileMapping* next) { next_ = next; }
+
+  bool Matches(int64_t size, int64_t mtime) const {
+    return (size_ == size) && (mtime_ == mtime);
+  }
+
+  // Both must be called with the cache mutex held.
+  void Retain() { ref_count_++; }
+  void Release() {
+    if (--ref_count_ == 0) {
+      delete this;
+    }
+  }
+
+ private:
+  char* path_;
+  int64_t size_;
+  int64_t mtime_;
+  MappedMemory* memory_;
+  intptr_t ref_count_;
+  SharedFileMapping* next_;
+
+  DISALLOW_COPY_AND_ASSIGN(SharedFileMapping);
+};
+
+static Mutex* shared_mappings_mutex = new Mutex();
+static SharedFileMapping* shared_mappings = NULL;
+
+const uint8_t* File::MapSharedReadOnly(Namespace* namespc,
+                                       const char* path,
+                                       intptr_t* length,
+                                       void** token) {
+  int64_t stat_data[File::kStatSize];
+  File::Stat(namespc, path, stat_data);
+  if (stat_data[File::kType] != File::kIsFile) {
+    return NULL;
+  }
+  const int64_t size = stat_data[File::kSize];
+  const int64_t mtime = stat_data[File::kModifiedTime];
+  if ((size <= 0) || (size > kIntptrMax)) {
+    return NULL;
+  }
+
+  MutexLocker ml(shared_mappings_mutex);
+  SharedFileMapping* previous = NULL;
+  SharedFileMapping* current = shared_mappings;
+  while (current != NULL) {
+    if (strcmp(current->path(), path) == 0) {
+      if (current->Matches(size, mtime)) {
+        current->Retain();
+        *length = static_cast<intptr_t>(current->size());
+        *token = current;
+        return current->data();
+      }
+      // The file changed on disk. Unlink the stale entry; outstanding views
+      // keep it alive until they are released.
+      if (previous == NULL) {
+        shared_mappings = current->next();
+      } else {
+        previous->set_next(current->next());
+      }
+      current->Release();
+      break;
+    }
+    previous = current;
+    current = current->next();
+  }
+
+  File* file = File::Open(namespc, path, File::kRead);
+  if (file == NULL) {
+    return NULL;
+  }
+  MappedMemory* memory = file->Map(File::kReadOnly, 0, size);
+  file->Release();
+  if (memory == NULL) {
+    return NULL;
+  }
+
+  SharedFileMapping* mapping = new SharedFileMapping(path, size, mtime, memory);
+  mapping->Retain();  // The caller's reference.
+  mapping->set_next(shared_mappings);
+  shared_mappings = mapping;
+  *length = static_cast<intptr_t>(size);
+  *token = mapping;
+  return mapping->data();
+}
+
+void File::UnmapSharedReadOnly(void* token) {
+  MutexLocker ml(shared_mappings_mutex);
+  reinterpret_cast<SharedFileMapping*>(token)->Release();
+}
+
 File::FileOpenMode File::DartModeToFileMode(DartFileOpenMode mode) {
   ASSERT((mode == File::kDartRead) || (mode == File::kDartWrite) ||
          (mode == File::kDartAppend) || (mode == File::kDartWriteOnly) ||
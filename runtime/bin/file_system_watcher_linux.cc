@@ -103,7 +103,12 @@ static int InotifyEventToMask(struct inotify_event* e) {
 Dart_Handle FileSystemWatcher::ReadEvents(intptr_t id, intptr_t path_id) {
   USE(path_id);
   const intptr_t kEventSize = sizeof(struct inotify_event);
-  const intptr_t kBufferSize = kEventSize + NAME_MAX + 1;
+  // Room for many events per read. A buffer that only fits one maximum-size
+  // event drains the kernel queue one event per wakeup, which floods the
+  // event handler when a busy tree changes; the kernel fills the buffer with
+  // as many complete events as fit, and they are returned as one list.
+  const intptr_t kBufferSize = 16 * 1024;
+  ASSERT(kBufferSize >= kEventSize + NAME_MAX + 1);
   uint8_t buffer[kBufferSize];
   intptr_t bytes =
       SocketBase::Read(id, buffer, kBufferSize, SocketBase::kAsync);
@@ -6,8 +6,11 @@
 
 #include "bin/dartutils.h"
 #include "bin/io_buffer.h"
+#include "bin/lockers.h"
+#include "bin/thread.h"
 
 #include "include/dart_api.h"
+#include "platform/utils.h"
 
 namespace dart {
 namespace bin {
@@ -285,6 +288,13 @@ Dart_Handle Filter::GetFilterNativeField(Dart_Handle filter,
 ZLibDeflateFilter::~ZLibDeflateFilter() {
   delete[] dictionary_;
   delete[] current_buffer_;
+  OutputChunk* chunk = output_head_;
+  while (chunk != NULL) {
+    OutputChunk* next = chunk->next;
+    delete[] chunk->data;
+    delete chunk;
+    chunk = next;
+  }
   if (initialized()) {
     deflateEnd(&stream_);
   }
@@ -328,7 +338,97 @@ bool ZLibDeflateFilter::Init() {
   return true;
 }
 
+// A single block of input deflated independently on a worker thread.
+struct DeflateBlockTask {
+  const uint8_t* in;
+  intptr_t in_length;
+  uint8_t* out;
+  intptr_t out_length;
+  uLong checksum;
+  bool ok;
+};
+
+// Work shared between ZLibDeflateFilter::ProcessParallel and its helper
+// threads.
+struct DeflateBlockBatch {
+  Monitor monitor;
+  DeflateBlockTask* tasks;
+  intptr_t num_tasks;
+  intptr_t next_task;  // Guarded by monitor.
+  intptr_t remaining;  // Guarded by monitor.
+  int32_t level;
+  int32_t window_bits;  // Negative: blocks are raw deflate data.
+  int32_t mem_level;
+  int32_t strategy;
+  bool crc;    // Compute crc32 of the input (gzip framing).
+  bool adler;  // Compute adler32 of the input (zlib framing).
+};
+
+static void DeflateBlock(DeflateBlockBatch* batch, DeflateBlockTask* task) {
+  z_stream strm;
+  strm.zalloc = Z_NULL;
+  strm.zfree = Z_NULL;
+  strm.opaque = Z_NULL;
+  if (deflateInit2(&strm, batch->level, Z_DEFLATED, batch->window_bits,
+                   batch->mem_level, batch->strategy) != Z_OK) {
+    task->ok = false;
+    return;
+  }
+  // A sync flush appends an empty stored block beyond what deflateBound
+  // accounts for.
+  const intptr_t bound = deflateBound(&strm, task->in_length) + 16;
+  task->out = new uint8_t[bound];
+  strm.next_in = const_cast<uint8_t*>(task->in);
+  strm.avail_in = task->in_length;
+  strm.next_out = task->out;
+  strm.avail_out = bound;
+  // With enough output space a single sync flush consumes all input and
+  // leaves the output on a byte boundary, so blocks from different workers
+  // concatenate into one valid deflate stream.
+  const int result = deflate(&strm, Z_SYNC_FLUSH);
+  task->ok = (result == Z_OK) && (strm.avail_in == 0);
+  task->out_length = bound - strm.avail_out;
+  deflateEnd(&strm);
+  if (batch->crc) {
+    task->checksum = crc32(crc32(0L, Z_NULL, 0), task->in, task->in_length);
+  } else if (batch->adler) {
+    task->checksum = adler32(adler32(0L, Z_NULL, 0), task->in, task->in_length);
+  }
+}
+
+static void DeflateBlockWorker(uword parameter) {
+  DeflateBlockBatch* batch = reinterpret_cast<DeflateBlockBatch*>(parameter);
+  while (true) {
+    DeflateBlockTask* task;
+    {
+      MonitorLocker ml(&batch->monitor);
+      if (batch->next_task >= batch->num_tasks) {
+        return;
+      }
+      task = &batch->tasks[batch->next_task++];
+    }
+    DeflateBlock(batch, task);
+    MonitorLocker ml(&batch->monitor);
+    if (--batch->remaining == 0) {
+      ml.Notify();
+    }
+  }
+}
+
 bool ZLibDeflateFilter::Process(uint8_t* data, intptr_t length) {
+  if (!mode_decided_) {
+    // Large first chunks take the parallel block path; everything else uses
+    // the plain streaming path. Preset dictionaries require shared history
+    // between blocks and always stream.
+    parallel_ = (dictionary_length_ == 0) && (length >= kParallelThreshold);
+    mode_decided_ = true;
+    if (parallel_) {
+      EmitParallelHeader();
+    }
+  }
+  if (parallel_) {
+    return ProcessParallel(data, length);
+  }
   if (current_buffer_ != NULL) {
     return false;
   }
@@ -337,10 +437,204 @@ bool ZLibDeflateFilter::Process(uint8_t* data, intptr_t length) {
   return true;
 }
 
+bool ZLibDeflateFilter::ProcessParallel(uint8_t* data, intptr_t length) {
+  const intptr_t num_tasks =
+      (length + kParallelBlockSize - 1) / kParallelBlockSize;
+  DeflateBlockTask* tasks = new DeflateBlockTask[num_tasks];
+  for (intptr_t i = 0; i < num_tasks; i++) {
+    tasks[i].in = data + i * kParallelBlockSize;
+    tasks[i].in_length =
+        Utils::Minimum(kParallelBlockSize, length - i * kParallelBlockSize);
+    tasks[i].out = NULL;
+    tasks[i].out_length = 0;
+    tasks[i].checksum = 0;
+    tasks[i].ok = false;
+  }
+
+  DeflateBlockBatch batch;
+  batch.tasks = tasks;
+  batch.num_tasks = num_tasks;
+  batch.next_task = 0;
+  batch.remaining = num_tasks;
+  batch.level = level_;
+  int32_t window_bits = window_bits_;
+  if (window_bits == 8) {
+    // deflate cannot produce raw data with a window size of 8 bits; see the
+    // comment in Init.
+    window_bits = 9;
+  }
+  batch.window_bits = -window_bits;
+  batch.mem_level = mem_level_;
+  batch.strategy = strategy_;
+  batch.crc = gzip_;
+  batch.adler = !gzip_ && !raw_;
+
+  // The calling thread compresses alongside the helpers, so failing to start
+  // a thread only loses parallelism.
+  const intptr_t helpers =
+      (num_tasks < kMaxParallelWorkers ? num_tasks : kMaxParallelWorkers) - 1;
+  for (intptr_t i = 0; i < helpers; i++) {
+    Thread::Start("dart:io Deflate", DeflateBlockWorker,
+                  reinterpret_cast<uword>(&batch));
+  }
+  DeflateBlockWorker(reinterpret_cast<uword>(&batch));
+  {
+    MonitorLocker ml(&batch.monitor);
+    while (batch.remaining > 0) {
+      ml.Wait();
+    }
+  }
+
+  for (intptr_t i = 0; i < num_tasks; i++) {
+    if (!tasks[i].ok) {
+      parallel_error_ = true;
+    }
+  }
+  if (!parallel_error_) {
+    for (intptr_t i = 0; i < num_tasks; i++) {
+      AppendOutput(tasks[i].out, tasks[i].out_length);
+      tasks[i].out = NULL;
+      if (batch.crc) {
+        checksum_ = crc32_combine(checksum_, tasks[i].checksum,
+                                  tasks[i].in_length);
+      } else if (batch.adler) {
+        checksum_ = adler32_combine(checksum_, tasks[i].checksum,
+                                    tasks[i].in_length);
+      }
+    }
+    total_in_ += length;
+  }
+  for (intptr_t i = 0; i < num_tasks; i++) {
+    delete[] tasks[i].out;  // NULL unless an error left it unconsumed.
+  }
+  delete[] tasks;
+  delete[] data;
+  return true;
+}
+
+void ZLibDeflateFilter::EmitParallelHeader() {
+  if (gzip_) {
+    checksum_ = crc32(0L, Z_NULL, 0);
+    uint8_t* header = new uint8_t[10];
+    header[0] = 0x1f;  // Magic.
+    header[1] = 0x8b;
+    header[2] = Z_DEFLATED;
+    header[3] = 0;                                      // No flags.
+    header[4] = header[5] = header[6] = header[7] = 0;  // No mtime.
+    header[8] = 0;                                      // No extra flags.
+    header[9] = 0xff;                                   // Unknown OS.
+    AppendOutput(header, 10);
+  } else if (!raw_) {
+    checksum_ = adler32(0L, Z_NULL, 0);
+    // CMF/FLG pair as deflate itself would emit it: window size, advisory
+    // compression level, and a check value making the pair divisible by 31.
+    const int32_t window_bits = (window_bits_ == 8) ? 9 : window_bits_;
+    const int32_t level =
+        (level_ == Z_DEFAULT_COMPRESSION) ? 6 : level_;
+    int32_t level_flags;
+    if ((strategy_ >= Z_HUFFMAN_ONLY) || (level < 2)) {
+      level_flags = 0;
+    } else if (level < 6) {
+      level_flags = 1;
+    } else if (level == 6) {
+      level_flags = 2;
+    } else {
+      level_flags = 3;
+    }
+    uint32_t pair = ((((window_bits - 8) << 4) | Z_DEFLATED) << 8) |
+                    (level_flags << 6);
+    if ((pair % 31) != 0) {
+      pair += 31 - (pair % 31);
+    }
+    uint8_t* header = new uint8_t[2];
+    header[0] = (pair >> 8) & 0xff;
+    header[1] = pair & 0xff;
+    AppendOutput(header, 2);
+  }
+}
+
+void ZLibDeflateFilter::EmitParallelTrailer() {
+  finished_ = true;
+  if (parallel_error_) {
+    return;
+  }
+  // Every parallel block ends sync-flushed on a byte boundary, so the stream
+  // is terminated by appending an empty static block with the final bit set
+  // (0x03 0x00), followed by the checksum trailer of the framing in use.
+  if (gzip_) {
+    uint8_t* trailer = new uint8_t[10];
+    trailer[0] = 0x03;
+    trailer[1] = 0x00;
+    for (int i = 0; i < 4; i++) {
+      trailer[2 + i] = (checksum_ >> (8 * i)) & 0xff;  // crc32, little-endian.
+      trailer[6 + i] = (total_in_ >> (8 * i)) & 0xff;  // isize, little-endian.
+    }
+    AppendOutput(trailer, 10);
+  } else if (!raw_) {
+    uint8_t* trailer = new uint8_t[6];
+    trailer[0] = 0x03;
+    trailer[1] = 0x00;
+    for (int i = 0; i < 4; i++) {
+      trailer[2 + i] = (checksum_ >> (8 * (3 - i))) & 0xff;  // adler32, BE.
+    }
+    AppendOutput(trailer, 6);
+  } else {
+    uint8_t* trailer = new uint8_t[2];
+    trailer[0] = 0x03;
+    trailer[1] = 0x00;
+    AppendOutput(trailer, 2);
+  }
+}
+
+void ZLibDeflateFilter::AppendOutput(uint8_t* data, intptr_t length) {
+  OutputChunk* chunk = new OutputChunk;
+  chunk->next = NULL;
+  chunk->length = length;
+  chunk->offset = 0;
+  chunk->data = data;
+  if (output_tail_ == NULL) {
+    output_head_ = output_tail_ = chunk;
+  } else {
+    output_tail_->next = chunk;
+    output_tail_ = chunk;
+  }
+}
+
+intptr_t ZLibDeflateFilter::DrainOutput(uint8_t* buffer, intptr_t length) {
+  intptr_t copied = 0;
+  while ((copied < length) && (output_head_ != NULL)) {
+    OutputChunk* chunk = output_head_;
+    const intptr_t to_copy =
+        Utils::Minimum(length - copied, chunk->length - chunk->offset);
+    memmove(buffer + copied, chunk->data + chunk->offset, to_copy);
+    copied += to_copy;
+    chunk->offset += to_copy;
+    if (chunk->offset == chunk->length) {
+      output_head_ = chunk->next;
+      if (output_head_ == NULL) {
+        output_tail_ = NULL;
+      }
+      delete[] chunk->data;
+      delete chunk;
+    }
+  }
+  return copied;
+}
+
 intptr_t ZLibDeflateFilter::Processed(uint8_t* buffer,
                                       intptr_t length,
                                       bool flush,
                                       bool end) {
+  if (parallel_) {
+    if (parallel_error_) {
+      return -1;
+    }
+    if (end && !finished_) {
+      EmitParallelTrailer();
+    }
+    // Parallel blocks are already sync-flushed, so flush needs no extra work.
+    return DrainOutput(buffer, length);
+  }
   stream_.avail_out = length;
   stream_.next_out = buffer;
   bool error = false;
@@ -70,7 +70,15 @@ class ZLibDeflateFilter : public Filter {
         dictionary_(dictionary),
         dictionary_length_(dictionary_length),
         raw_(raw),
-        current_buffer_(NULL) {}
+        current_buffer_(NULL),
+        mode_decided_(false),
+        parallel_(false),
+        parallel_error_(false),
+        finished_(false),
+        checksum_(0),
+        total_in_(0),
+        output_head_(NULL),
+        output_tail_(NULL) {}
   virtual ~ZLibDeflateFilter();
 
   virtual bool Init();
@@ -81,6 +89,33 @@ class ZLibDeflateFilter : public Filter {
                              bool end);
 
  private:
+  // Compressed output produced by the parallel deflate path, delivered to
+  // Processed in the order it was appended.
+  struct OutputChunk {
+    OutputChunk* next;
+    intptr_t length;
+    intptr_t offset;  // Bytes already handed out by DrainOutput.
+    uint8_t* data;
+  };
+
+  // Chunks at least this large are split into blocks and compressed on
+  // multiple threads.
+  static const intptr_t kParallelBlockSize = 1 * MB;
+  static const intptr_t kParallelThreshold = 2 * MB;
+  static const intptr_t kMaxParallelWorkers = 8;
+
+  // Compresses data as a sequence of independent deflate blocks, each ending
+  // on a byte boundary, using up to kMaxParallelWorkers threads. Takes
+  // ownership of data. Sets parallel_error_ on failure.
+  bool ProcessParallel(uint8_t* data, intptr_t length);
+  // Appends a chunk to the output queue. Takes ownership of data.
+  void AppendOutput(uint8_t* data, intptr_t length);
+  // Copies queued output into buffer, freeing exhausted chunks. Returns the
+  // number of bytes copied.
+  intptr_t DrainOutput(uint8_t* buffer, intptr_t length);
+  void EmitParallelHeader();
+  void EmitParallelTrailer();
+
   const bool gzip_;
   const int32_t level_;
   const int32_t window_bits_;
@@ -92,6 +127,18 @@ class ZLibDeflateFilter : public Filter {
   uint8_t* current_buffer_;
   z_stream stream_;
 
+  // Whether to use the streaming zlib path or the parallel block path is
+  // decided by the size of the first chunk; the two produce differently
+  // framed (but interchangeable) streams and cannot be mixed.
+  bool mode_decided_;
+  bool parallel_;
+  bool parallel_error_;
+  bool finished_;
+  uLong checksum_;  // crc32 (gzip) or adler32 (zlib) of the input so far.
+  int64_t total_in_;
+  OutputChunk* output_head_;
+  OutputChunk* output_tail_;
+
   DISALLOW_COPY_AND_ASSIGN(ZLibDeflateFilter);
 };
 
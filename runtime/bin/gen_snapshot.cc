@@ -305,6 +305,26 @@ static int ParseArguments(int argc,
     }
   }
 
+  if ((snapshot_kind != kCoreJIT) && (snapshot_kind != kAppJIT)) {
+    // Compilation traces and type feedback are keyed by the deopt ids and
+    // ICData of JIT-compiled code. The precompiler builds fresh graphs from
+    // kernel and specializes calls statically (see AotCallSpecializer), so
+    // it has no sound way to consume JIT profiles. Reject the flags instead
+    // of silently ignoring them.
+    if (load_compilation_trace_filename != NULL) {
+      Syslog::PrintErr(
+          "--load_compilation_trace can only be used when building a core JIT "
+          "or app JIT snapshot.\n\n");
+      return -1;
+    }
+    if (load_type_feedback_filename != NULL) {
+      Syslog::PrintErr(
+          "--load_type_feedback can only be used when building a core JIT "
+          "or app JIT snapshot.\n\n");
+      return -1;
+    }
+  }
+
   if (!obfuscate && obfuscation_map_filename != NULL) {
     Syslog::PrintErr(
         "--save-obfuscation_map=<...> should only be specified when "
@@ -4,11 +4,62 @@
 
 #include "bin/io_buffer.h"
 
+#include <string.h>
+
+#include "bin/lockers.h"
+#include "bin/thread.h"
 #include "platform/memory_sanitizer.h"
 
 namespace dart {
 namespace bin {
 
+Mutex* IOBuffer::mutex_ = NULL;
+IOBuffer::FreeBuffer* IOBuffer::free_lists_[kNumSizeClasses];
+intptr_t IOBuffer::free_counts_[kNumSizeClasses];
+
+void IOBuffer::Init() {
+  ASSERT(mutex_ == NULL);
+  for (intptr_t i = 0; i < kNumSizeClasses; i++) {
+    free_lists_[i] = NULL;
+    free_counts_[i] = 0;
+  }
+  mutex_ = new Mutex();
+}
+
+void IOBuffer::Cleanup() {
+  if (mutex_ == NULL) {
+    return;
+  }
+  Mutex* mutex = mutex_;
+  mutex->Lock();
+  // Buffers still owned by live Dart objects are released to malloc when
+  // their finalizers run after this point.
+  mutex_ = NULL;
+  for (intptr_t i = 0; i < kNumSizeClasses; i++) {
+    FreeBuffer* buffer = free_lists_[i];
+    while (buffer != NULL) {
+      FreeBuffer* next = buffer->next;
+      free(buffer);
+      buffer = next;
+    }
+    free_lists_[i] = NULL;
+    free_counts_[i] = 0;
+  }
+  mutex->Unlock();
+  delete mutex;
+}
+
+intptr_t IOBuffer::SizeClassFor(intptr_t size) {
+  if (size > (1 << kMaxSizeClass)) {
+    return kDirectSizeClass;
+  }
+  intptr_t size_class = kMinSizeClass;
+  while ((1 << size_class) < size) {
+    size_class++;
+  }
+  return size_class;
+}
+
 Dart_Handle IOBuffer::Allocate(intptr_t size, uint8_t** buffer) {
   uint8_t* data = Allocate(size);
   if (data == NULL) {
@@ -28,7 +79,52 @@ Dart_Handle IOBuffer::Allocate(intptr_t size, uint8_t** buffer) {
 }
 
 uint8_t* IOBuffer::Allocate(intptr_t size) {
-  return reinterpret_cast<uint8_t*>(calloc(size, sizeof(uint8_t)));
+  const intptr_t size_class = SizeClassFor(size);
+  uint8_t* raw = NULL;
+  if ((size_class != kDirectSizeClass) && (mutex_ != NULL)) {
+    MutexLocker locker(mutex_);
+    const intptr_t index = size_class - kMinSizeClass;
+    FreeBuffer* buffer = free_lists_[index];
+    if (buffer != NULL) {
+      free_lists_[index] = buffer->next;
+      free_counts_[index]--;
+      raw = reinterpret_cast<uint8_t*>(buffer);
+    }
+  }
+  const intptr_t data_size =
+      (size_class == kDirectSizeClass) ? size : (1 << size_class);
+  if (raw == NULL) {
+    raw = reinterpret_cast<uint8_t*>(malloc(kHeaderSize + data_size));
+    if (raw == NULL) {
+      return NULL;
+    }
+  }
+  reinterpret_cast<Header*>(raw)->size_class = size_class;
+  uint8_t* data = raw + kHeaderSize;
+  // Buffers were previously allocated with calloc; keep handing out zeroed
+  // memory so recycled buffer contents never leak into Dart.
+  memset(data, 0, data_size);
+  return data;
+}
+
+void IOBuffer::Free(void* buffer) {
+  if (buffer == NULL) {
+    return;
+  }
+  uint8_t* raw = reinterpret_cast<uint8_t*>(buffer) - kHeaderSize;
+  const intptr_t size_class = reinterpret_cast<Header*>(raw)->size_class;
+  if ((size_class != kDirectSizeClass) && (mutex_ != NULL)) {
+    MutexLocker locker(mutex_);
+    const intptr_t index = size_class - kMinSizeClass;
+    if (free_counts_[index] < kMaxFreeBuffersPerClass) {
+      FreeBuffer* node = reinterpret_cast<FreeBuffer*>(raw);
+      node->next = free_lists_[index];
+      free_lists_[index] = node;
+      free_counts_[index]++;
+      return;
+    }
+  }
+  free(raw);
 }
 
 }  // namespace bin
@@ -11,8 +11,13 @@
 namespace dart {
 namespace bin {
 
+class Mutex;
+
 class IOBuffer {
  public:
+  static void Init();
+  static void Cleanup();
+
   // Allocate an IO buffer dart object (of type Uint8List) backed by
   // an external byte array.
   static Dart_Handle Allocate(intptr_t size, uint8_t** buffer);
@@ -22,7 +27,7 @@ class IOBuffer {
 
   // Function for disposing of IO buffer storage. All backing storage
   // for IO buffers must be freed using this function.
-  static void Free(void* buffer) { free(buffer); }
+  static void Free(void* buffer);
 
   // Function for finalizing external byte arrays used as IO buffers.
   static void Finalizer(void* isolate_callback_data, void* buffer) {
@@ -30,6 +35,36 @@ class IOBuffer {
   }
 
  private:
+  // Each buffer is prefixed by a header recording its size class, so that
+  // Free can return the storage to the matching free list.
+  struct Header {
+    intptr_t size_class;
+  };
+  struct FreeBuffer {
+    FreeBuffer* next;
+  };
+
+  // Buffers are handed out rounded up to power-of-two size classes between
+  // 1 << kMinSizeClass and 1 << kMaxSizeClass bytes; larger requests bypass
+  // the pool and are served by malloc directly.
+  static const intptr_t kMinSizeClass = 10;
+  static const intptr_t kMaxSizeClass = 16;
+  static const intptr_t kNumSizeClasses = kMaxSizeClass - kMinSizeClass + 1;
+  static const intptr_t kDirectSizeClass = -1;
+
+  // At most this many free buffers are retained per size class; beyond that
+  // Free releases the storage to malloc.
+  static const intptr_t kMaxFreeBuffersPerClass = 16;
+
+  // Keeps the data area as aligned as malloc would.
+  static const intptr_t kHeaderSize = 16;
+
+  static intptr_t SizeClassFor(intptr_t size);
+
+  static Mutex* mutex_;
+  static FreeBuffer* free_lists_[kNumSizeClasses];
+  static intptr_t free_counts_[kNumSizeClasses];
+
   DISALLOW_ALLOCATION();
   DISALLOW_IMPLICIT_CONSTRUCTORS(IOBuffer);
 };
@@ -58,6 +58,7 @@ namespace bin {
   V(File_Position, 1)                                                          \
   V(File_Read, 2)                                                              \
   V(File_ReadByte, 1)                                                          \
+  V(File_ReadFileShared, 2)                                                    \
   V(File_ReadInto, 4)                                                          \
   V(File_Rename, 3)                                                            \
   V(File_RenameLink, 3)                                                        \
@@ -154,12 +155,16 @@ namespace bin {
   V(Socket_JoinMulticast, 4)                                                   \
   V(Socket_LeaveMulticast, 4)                                                  \
   V(Socket_Read, 2)                                                            \
+  V(Socket_ReceiveMessages, 3)                                                 \
   V(Socket_RecvFrom, 1)                                                        \
+  V(Socket_SendFile, 4)                                                        \
   V(Socket_SendTo, 6)                                                          \
+  V(Socket_SetCork, 2)                                                         \
   V(Socket_SetOption, 4)                                                       \
   V(Socket_SetRawOption, 4)                                                    \
   V(Socket_SetSocketId, 3)                                                     \
   V(Socket_WriteList, 4)                                                       \
+  V(Socket_WriteVec, 2)                                                        \
   V(Stdin_ReadByte, 1)                                                         \
   V(Stdin_GetEchoMode, 1)                                                      \
   V(Stdin_SetEchoMode, 2)                                                      \
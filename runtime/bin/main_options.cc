@@ -77,6 +77,8 @@ CB_OPTIONS_LIST(CB_OPTION_DEFINITION)
 DFE* Options::dfe_ = NULL;
 
 DEFINE_STRING_OPTION_CB(dfe, { Options::dfe()->set_frontend_filename(value); });
+DEFINE_STRING_OPTION_CB(kernel_cache,
+                        { Options::dfe()->set_kernel_cache(value); });
 #endif  // !defined(DART_PRECOMPILED_RUNTIME)
 
 static void hot_reload_test_mode_callback(CommandLineOptions* vm_options) {
@@ -162,6 +164,11 @@ void Options::PrintUsage() {
 "    <snapshot-kind> controls the kind of snapshot, it could be\n"
 "                    kernel(default) or app-jit\n"
 "    <file_name> specifies the file into which the snapshot is written\n"
+"--compress-snapshot\n"
+"  Gzip the data sections of an app-jit snapshot. This shrinks the snapshot\n"
+"  file at the cost of decompressing it into anonymous memory at startup,\n"
+"  so the data pages are no longer shared between processes running the\n"
+"  same snapshot.\n"
 "--version\n"
 "  Print the SDK version.\n");
   } else {
@@ -10,6 +10,7 @@
 #include <errno.h>         // NOLINT
 #include <fcntl.h>         // NOLINT
 #include <poll.h>          // NOLINT
+#include <spawn.h>         // NOLINT
 #include <stdio.h>         // NOLINT
 #include <stdlib.h>        // NOLINT
 #include <string.h>        // NOLINT
@@ -156,6 +157,41 @@ class ExitCodeHandler {
     running_ = true;
   }
 
+  // Delivers the exit code for pid if the process exited and was reaped
+  // before it was added to the ProcessInfoList. This can only happen for
+  // processes started with posix_spawn, where the child is already running
+  // when it is registered (see ProcessStarter::StartWithPosixSpawn).
+  static void ClaimExit(pid_t pid) {
+    int exit_code = 0;
+    int negative = 0;
+    bool found = false;
+    {
+      MonitorLocker locker(monitor_);
+      UnclaimedExit* prev = NULL;
+      UnclaimedExit* current = unclaimed_exits_;
+      while (current != NULL) {
+        if (current->pid == pid) {
+          exit_code = current->exit_code;
+          negative = current->negative;
+          if (prev == NULL) {
+            unclaimed_exits_ = current->next;
+          } else {
+            prev->next = current->next;
+          }
+          delete current;
+          unclaimed_count_--;
+          found = true;
+          break;
+        }
+        prev = current;
+        current = current->next;
+      }
+    }
+    if (found) {
+      DeliverExitCode(pid, exit_code, negative);
+    }
+  }
+
   static void TerminateExitCodeThread() {
     MonitorLocker locker(monitor_);
 
@@ -211,32 +247,71 @@ class ExitCodeHandler {
           exit_code = WTERMSIG(status);
           negative = 1;
         }
-        intptr_t exit_code_fd = ProcessInfoList::LookupProcessExitFd(pid);
-        if (exit_code_fd != 0) {
-          int message[2] = {exit_code, negative};
-          ssize_t result =
-              FDUtils::WriteToBlocking(exit_code_fd, &message, sizeof(message));
-          // If the process has been closed, the read end of the exit
-          // pipe has been closed. It is therefore not a problem that
-          // write fails with a broken pipe error. Other errors should
-          // not happen.
-          if ((result != -1) && (result != sizeof(message))) {
-            FATAL("Failed to write entire process exit message");
-          } else if ((result == -1) && (errno != EPIPE)) {
-            FATAL1("Failed to write exit code: %d", errno);
-          }
-          ProcessInfoList::RemoveProcess(pid);
-          {
-            MonitorLocker locker(monitor_);
-            process_count_--;
-          }
-        }
+        DeliverExitCode(pid, exit_code, negative);
       } else if (pid < 0) {
         FATAL1("Wait for process exit failed: %d", errno);
       }
     }
   }
 
+  static void DeliverExitCode(pid_t pid, int exit_code, int negative) {
+    intptr_t exit_code_fd = ProcessInfoList::LookupProcessExitFd(pid);
+    if (exit_code_fd != 0) {
+      int message[2] = {exit_code, negative};
+      ssize_t result =
+          FDUtils::WriteToBlocking(exit_code_fd, &message, sizeof(message));
+      // If the process has been closed, the read end of the exit
+      // pipe has been closed. It is therefore not a problem that
+      // write fails with a broken pipe error. Other errors should
+      // not happen.
+      if ((result != -1) && (result != sizeof(message))) {
+        FATAL("Failed to write entire process exit message");
+      } else if ((result == -1) && (errno != EPIPE)) {
+        FATAL1("Failed to write exit code: %d", errno);
+      }
+      ProcessInfoList::RemoveProcess(pid);
+      {
+        MonitorLocker locker(monitor_);
+        process_count_--;
+      }
+    } else {
+      // The pid is not registered yet; keep the exit code so that ClaimExit
+      // can deliver it once registration completes. Exits of processes never
+      // registered (e.g. the intermediate children of detached processes)
+      // accumulate here as well, so the list is kept small by dropping the
+      // oldest entries.
+      MonitorLocker locker(monitor_);
+      UnclaimedExit* unclaimed = new UnclaimedExit();
+      unclaimed->pid = pid;
+      unclaimed->exit_code = exit_code;
+      unclaimed->negative = negative;
+      unclaimed->next = unclaimed_exits_;
+      unclaimed_exits_ = unclaimed;
+      unclaimed_count_++;
+      if (unclaimed_count_ > kMaxUnclaimedExits) {
+        UnclaimedExit* prev = unclaimed_exits_;
+        while (prev->next->next != NULL) {
+          prev = prev->next;
+        }
+        delete prev->next;
+        prev->next = NULL;
+        unclaimed_count_--;
+      }
+    }
+  }
+
+  // Exit code of a process that was reaped before it was registered.
+  struct UnclaimedExit {
+    pid_t pid;
+    int exit_code;
+    int negative;
+    UnclaimedExit* next;
+  };
+
+  static const intptr_t kMaxUnclaimedExits = 16;
+
+  static UnclaimedExit* unclaimed_exits_;
+  static intptr_t unclaimed_count_;
   static bool terminate_done_;
   static int process_count_;
   static bool running_;
@@ -246,6 +321,8 @@ class ExitCodeHandler {
   DISALLOW_IMPLICIT_CONSTRUCTORS(ExitCodeHandler);
 };
 
+ExitCodeHandler::UnclaimedExit* ExitCodeHandler::unclaimed_exits_ = NULL;
+intptr_t ExitCodeHandler::unclaimed_count_ = 0;
 bool ExitCodeHandler::running_ = false;
 int ExitCodeHandler::process_count_ = 0;
 bool ExitCodeHandler::terminate_done_ = false;
@@ -312,6 +389,10 @@ class ProcessStarter {
       return err;
     }
 
+    if (CanUsePosixSpawn()) {
+      return StartWithPosixSpawn();
+    }
+
     // Fork to create the new process.
     pid_t pid = TEMP_FAILURE_RETRY(fork());
     if (pid < 0) {
@@ -371,6 +452,91 @@ class ProcessStarter {
       return err;
     }
 
+    ConnectStdio();
+    ASSERT(exec_control_[0] == -1);
+    ASSERT(exec_control_[1] == -1);
+
+    *id_ = pid;
+    return 0;
+  }
+
+ private:
+  // Whether the process can be started with posix_spawn instead of
+  // fork/exec. posix_spawn has vfork semantics and does not duplicate the
+  // parent's page tables, which dominates the cost of fork for parents with
+  // a large heap. Detached modes need setsid and a second fork, changing
+  // the working directory has no portable spawn file action, and
+  // non-default namespaces resolve the path relative to the namespace;
+  // those all take the fork path.
+  bool CanUsePosixSpawn() {
+    return Process::ModeIsAttached(mode_) && (working_directory_ == NULL) &&
+           Namespace::IsDefault(namespc_);
+  }
+
+  int StartWithPosixSpawn() {
+    // The exec control pipe is only needed by the fork path; posix_spawn
+    // reports exec failures through its return value.
+    ClosePipe(exec_control_);
+
+    posix_spawn_file_actions_t file_actions;
+    int result = posix_spawn_file_actions_init(&file_actions);
+    if (result != 0) {
+      errno = result;
+      return CleanupAndReturnError();
+    }
+    if (mode_ == kNormal) {
+      // dup2 clears O_CLOEXEC on the standard fds; the parent's ends of the
+      // pipes keep it and are closed by the exec itself.
+      result = posix_spawn_file_actions_adddup2(&file_actions, write_out_[0],
+                                                STDIN_FILENO);
+      if (result == 0) {
+        result = posix_spawn_file_actions_adddup2(&file_actions, read_in_[1],
+                                                  STDOUT_FILENO);
+      }
+      if (result == 0) {
+        result = posix_spawn_file_actions_adddup2(&file_actions, read_err_[1],
+                                                  STDERR_FILENO);
+      }
+      if (result != 0) {
+        posix_spawn_file_actions_destroy(&file_actions);
+        errno = result;
+        return CleanupAndReturnError();
+      }
+    } else {
+      ASSERT(mode_ == kInheritStdio);
+    }
+
+    pid_t pid;
+    result = posix_spawnp(&pid, path_, &file_actions, NULL,
+                          const_cast<char* const*>(program_arguments_),
+                          (program_environment_ != NULL)
+                              ? const_cast<char* const*>(program_environment_)
+                              : environ);
+    posix_spawn_file_actions_destroy(&file_actions);
+    if (result != 0) {
+      errno = result;
+      return CleanupAndReturnError();
+    }
+
+    // Unlike the fork path there is no handshake delaying the exec until the
+    // process is registered: the child is already running. Register it and
+    // then claim its exit code in case the exit code handler reaped it
+    // before the registration.
+    ExitCodeHandler::ProcessStarted();
+    int err = RegisterProcess(pid);
+    if (err != 0) {
+      return err;
+    }
+    ExitCodeHandler::ClaimExit(pid);
+
+    ConnectStdio();
+    *id_ = pid;
+    return 0;
+  }
+
+  // Connects the parent's ends of the stdio pipes and closes the child's
+  // ends.
+  void ConnectStdio() {
     if (Process::ModeHasStdio(mode_)) {
       // Connect stdio, stdout and stderr.
       FDUtils::SetNonBlocking(read_in_[0]);
@@ -391,14 +557,8 @@ class ProcessStarter {
       ASSERT(read_err_[0] == -1);
       ASSERT(read_err_[1] == -1);
     }
-    ASSERT(exec_control_[0] == -1);
-    ASSERT(exec_control_[1] == -1);
-
-    *id_ = pid;
-    return 0;
   }
 
- private:
   int CreatePipes() {
     int result;
     result = TEMP_FAILURE_RETRY(pipe2(exec_control_, O_CLOEXEC));
@@ -1112,6 +1272,14 @@ void ExitCodeHandler::Init() {
 
 void ExitCodeHandler::Cleanup() {
   ASSERT(ExitCodeHandler::monitor_ != nullptr);
+  UnclaimedExit* unclaimed = unclaimed_exits_;
+  while (unclaimed != NULL) {
+    UnclaimedExit* next = unclaimed->next;
+    delete unclaimed;
+    unclaimed = next;
+  }
+  unclaimed_exits_ = NULL;
+  unclaimed_count_ = 0;
   delete ExitCodeHandler::monitor_;
   ExitCodeHandler::monitor_ = nullptr;
 }
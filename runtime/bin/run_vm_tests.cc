@@ -45,6 +45,10 @@ static const char* const kAllBenchmarks = "All Benchmarks";
 static const char* run_filter = kNone;
 static const char* kernel_snapshot = nullptr;
 
+// When true, benchmark scores are printed as JSON records, one per line,
+// so CI can trend them without parsing the human-readable format.
+static bool benchmark_json = false;
+
 static int run_matches = 0;
 
 void TestCase::Run() {
@@ -73,8 +77,13 @@ void Benchmark::RunBenchmark() {
   if ((run_filter == kAllBenchmarks) ||
       (strcmp(run_filter, this->name()) == 0)) {
     this->Run();
-    Syslog::Print("%s(%s): %" Pd64 "\n", this->name(), this->score_kind(),
-                  this->score());
+    if (benchmark_json) {
+      Syslog::Print("{\"name\":\"%s\",\"kind\":\"%s\",\"score\":%" Pd64 "}\n",
+                    this->name(), this->score_kind(), this->score());
+    } else {
+      Syslog::Print("%s(%s): %" Pd64 "\n", this->name(), this->score_kind(),
+                    this->score());
+    }
     run_matches++;
   } else if (run_filter == kList) {
     Syslog::Print("%s Pass\n", this->name());
@@ -87,6 +96,7 @@ static void PrintUsage() {
       "Usage: one of the following\n"
       "  run_vm_tests --list\n"
       "  run_vm_tests [--dfe=<snapshot file name>] --benchmarks\n"
+      "  run_vm_tests [--dfe=<snapshot file name>] --benchmarks-json\n"
       "  run_vm_tests [--dfe=<snapshot file name>] [vm-flags ...] <test name>\n"
       "  run_vm_tests [--dfe=<snapshot file name>] [vm-flags ...] <benchmark "
       "name>\n");
@@ -346,6 +356,11 @@ static int Main(int argc, const char** argv) {
   if (arg_pos == argc - 1 && strcmp(argv[arg_pos], "--benchmarks") == 0) {
     // "--benchmarks" is the last argument.
     run_filter = kAllBenchmarks;
+  } else if (arg_pos == argc - 1 &&
+             strcmp(argv[arg_pos], "--benchmarks-json") == 0) {
+    // "--benchmarks-json" is the last argument.
+    run_filter = kAllBenchmarks;
+    benchmark_json = true;
   } else {
     // Last argument is the test name, the rest are vm flags.
     run_filter = argv[argc - 1];
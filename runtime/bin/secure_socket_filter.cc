@@ -237,6 +237,15 @@ void FUNCTION_NAME(SecureSocket_FilterPointer)(Dart_NativeArguments args) {
  * When ProcessFilter returns, the Dart thread is responsible for combining
  * the updated pointers from Dart and C++, to make the new valid state of
  * the circular buffer.
+ *
+ * Note on threading: this function does not run on the isolate's mutator
+ * thread. It is invoked through a native IO service port, whose handler runs
+ * on a VM thread pool worker (see NativeMessageHandler), so the BoringSSL
+ * work here never blocks the isolate's event loop. The library side keeps a
+ * pool of such ports (_IOServicePorts, up to 32 per isolate) and each
+ * in-flight request checks out its own port, so busy TLS connections are
+ * encrypted and decrypted concurrently with each other and with other IO
+ * service requests.
  */
 CObject* SSLFilter::ProcessFilterRequest(const CObjectArray& request) {
   CObjectIntptr filter_object(request[0]);
@@ -532,6 +541,14 @@ void SSLFilter::Connect(const char* hostname,
                                          hostname_, strlen(hostname_));
     SecureSocketUtils::CheckStatusSSL(
         status, "TlsException", "Set hostname for certificate checking", ssl_);
+    // Offer a previously established session with this host, if the context
+    // has one cached, so the handshake can resume instead of starting over.
+    SSL_SESSION* session = context->LookupSession(hostname_);
+    if (session != NULL) {
+      SSL_set_session(ssl_, session);
+      // SSL_set_session took its own reference.
+      SSL_SESSION_free(session);
+    }
   }
   // Make the connection:
   if (is_server_) {
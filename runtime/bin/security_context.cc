@@ -19,6 +19,7 @@
 #include "bin/secure_socket_filter.h"
 #include "bin/secure_socket_utils.h"
 #include "platform/syslog.h"
+#include "platform/utils.h"
 
 // Return the error from the containing function if handle is an error handle.
 #define RETURN_IF_ERROR(handle)                                                \
@@ -80,6 +81,74 @@ int SSLCertContext::CertificateCallback(int preverify_ok,
   return static_cast<int>(DartUtils::GetBooleanValue(result));
 }
 
+int SSLCertContext::NewSessionCallback(SSL* ssl, SSL_SESSION* session) {
+  SSLFilter* filter = static_cast<SSLFilter*>(
+      SSL_get_ex_data(ssl, SSLFilter::filter_ssl_index));
+  SSLCertContext* context = static_cast<SSLCertContext*>(
+      SSL_get_ex_data(ssl, SSLFilter::ssl_cert_context_index));
+  if ((filter == NULL) || (context == NULL) || filter->is_server() ||
+      (filter->hostname() == NULL)) {
+    // Ownership not taken; BoringSSL frees the session.
+    return 0;
+  }
+  context->CacheSession(filter->hostname(), session);
+  // The cache took ownership of the session reference.
+  return 1;
+}
+
+void SSLCertContext::CacheSession(const char* hostname, SSL_SESSION* session) {
+  ASSERT(hostname != NULL);
+  MutexLocker locker(&sessions_mutex_);
+  // Replace an existing session for the host.
+  for (CachedSession* cached = sessions_; cached != NULL;
+       cached = cached->next) {
+    if (strcmp(cached->hostname, hostname) == 0) {
+      SSL_SESSION_free(cached->session);
+      cached->session = session;
+      return;
+    }
+  }
+  if (num_sessions_ >= kMaxCachedSessions) {
+    // Drop the oldest entry, at the tail of the list.
+    CachedSession* previous = NULL;
+    CachedSession* tail = sessions_;
+    while (tail->next != NULL) {
+      previous = tail;
+      tail = tail->next;
+    }
+    if (previous == NULL) {
+      sessions_ = NULL;
+    } else {
+      previous->next = NULL;
+    }
+    free(tail->hostname);
+    SSL_SESSION_free(tail->session);
+    delete tail;
+    num_sessions_--;
+  }
+  CachedSession* entry = new CachedSession();
+  entry->hostname = Utils::StrDup(hostname);
+  entry->session = session;
+  entry->next = sessions_;
+  sessions_ = entry;
+  num_sessions_++;
+}
+
+SSL_SESSION* SSLCertContext::LookupSession(const char* hostname) {
+  if (hostname == NULL) {
+    return NULL;
+  }
+  MutexLocker locker(&sessions_mutex_);
+  for (CachedSession* cached = sessions_; cached != NULL;
+       cached = cached->next) {
+    if (strcmp(cached->hostname, hostname) == 0) {
+      SSL_SESSION_up_ref(cached->session);
+      return cached->session;
+    }
+  }
+  return NULL;
+}
+
 SSLCertContext* SSLCertContext::GetSecurityContext(Dart_NativeArguments args) {
   SSLCertContext* context;
   Dart_Handle dart_this = ThrowIfError(Dart_GetNativeArgument(args, 0));
@@ -804,6 +873,12 @@ void FUNCTION_NAME(SecurityContext_Allocate)(Dart_NativeArguments args) {
   SSL_CTX_set_verify(ctx, SSL_VERIFY_PEER, SSLCertContext::CertificateCallback);
   SSL_CTX_set_min_proto_version(ctx, TLS1_VERSION);
   SSL_CTX_set_cipher_list(ctx, "HIGH:MEDIUM");
+  // Cache client sessions so that repeated connections to the same host can
+  // resume instead of doing a full handshake. Sessions are stored on the
+  // SSLCertContext keyed by hostname (rather than in the SSL_CTX's internal
+  // cache, which cannot be looked up by host).
+  SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT);
+  SSL_CTX_sess_set_new_cb(ctx, SSLCertContext::NewSessionCallback);
   SSLCertContext* context = new SSLCertContext(ctx);
   Dart_Handle err = SetSecurityContext(args, context);
   if (Dart_IsError(err)) {
@@ -31,13 +31,23 @@ class SSLCertContext : public ReferenceCounted<SSLCertContext> {
       : ReferenceCounted(),
         context_(context),
         alpn_protocol_string_(NULL),
-        trust_builtin_(false) {}
+        trust_builtin_(false),
+        sessions_(NULL),
+        num_sessions_(0) {}
 
   ~SSLCertContext() {
     SSL_CTX_free(context_);
     if (alpn_protocol_string_ != NULL) {
       free(alpn_protocol_string_);
     }
+    CachedSession* session = sessions_;
+    while (session != NULL) {
+      CachedSession* next = session->next;
+      free(session->hostname);
+      SSL_SESSION_free(session->session);
+      delete session;
+      session = next;
+    }
   }
 
   static int CertificateCallback(int preverify_ok, X509_STORE_CTX* store_ctx);
@@ -88,12 +98,38 @@ class SSLCertContext : public ReferenceCounted<SSLCertContext> {
   void RegisterCallbacks(SSL* ssl);
   TrustEvaluateHandlerFunc GetTrustEvaluateHandler() const;
 
+  // Called by BoringSSL when a client handshake establishes a new session.
+  // Stores the session on the connection's SSLCertContext for resumption of
+  // later connections to the same host.
+  static int NewSessionCallback(SSL* ssl, SSL_SESSION* session);
+
+  // Stores a session for the host, replacing any previous one. Takes
+  // ownership of the session reference.
+  void CacheSession(const char* hostname, SSL_SESSION* session);
+
+  // Returns a cached session for the host with its reference count
+  // incremented, or NULL. The caller owns the returned reference.
+  SSL_SESSION* LookupSession(const char* hostname);
+
   static bool long_ssl_cert_evaluation() { return long_ssl_cert_evaluation_; }
   static void set_long_ssl_cert_evaluation(bool long_ssl_cert_evaluation) {
     long_ssl_cert_evaluation_ = long_ssl_cert_evaluation;
   }
 
  private:
+  // Sessions established through this context, kept for resumption. Sessions
+  // are deliberately not shared between contexts: a session resumed under a
+  // context with different trust settings would bypass its certificate
+  // verification.
+  struct CachedSession {
+    char* hostname;
+    SSL_SESSION* session;
+    CachedSession* next;
+  };
+
+  // At most this many sessions are retained per context.
+  static const intptr_t kMaxCachedSessions = 64;
+
   void AddCompiledInCerts();
   void LoadRootCertFile(const char* file);
   void LoadRootCertCache(const char* cache);
@@ -106,6 +142,10 @@ class SSLCertContext : public ReferenceCounted<SSLCertContext> {
 
   bool trust_builtin_;
 
+  Mutex sessions_mutex_;
+  CachedSession* sessions_;
+  intptr_t num_sessions_;
+
   static bool long_ssl_cert_evaluation_;
 
   DISALLOW_COPY_AND_ASSIGN(SSLCertContext);
@@ -12,6 +12,7 @@
 #include "bin/error_exit.h"
 #include "bin/extensions.h"
 #include "bin/file.h"
+#include "bin/gzip.h"
 #include "bin/platform.h"
 #include "include/dart_api.h"
 #include "platform/utils.h"
@@ -22,6 +23,11 @@ namespace dart {
 namespace bin {
 
 static const int64_t kAppSnapshotHeaderSize = 5 * kInt64Size;
+// Each blob section is written at an offset aligned to the largest supported
+// OS page size, so it can be mapped directly from the snapshot file with the
+// needed protection. The mappings are read-only (read-execute for
+// instructions), so the kernel shares their pages among all processes running
+// the same snapshot.
 static const int64_t kAppSnapshotPageSize = 16 * KB;
 
 class MappedAppSnapshot : public AppSnapshot {
@@ -71,6 +77,72 @@ class MappedAppSnapshot : public AppSnapshot {
   MappedMemory* isolate_instructions_mapping_;
 };
 
+// An app snapshot whose data sections were stored gzipped and have been
+// decompressed into the C heap. The instruction sections are stored
+// uncompressed so they are still mapped directly from the snapshot file.
+class DecompressedAppSnapshot : public AppSnapshot {
+ public:
+  DecompressedAppSnapshot(uint8_t* vm_snapshot_data,
+                          MappedMemory* vm_snapshot_instructions,
+                          uint8_t* isolate_snapshot_data,
+                          MappedMemory* isolate_snapshot_instructions)
+      : vm_data_(vm_snapshot_data),
+        vm_instructions_mapping_(vm_snapshot_instructions),
+        isolate_data_(isolate_snapshot_data),
+        isolate_instructions_mapping_(isolate_snapshot_instructions) {}
+
+  ~DecompressedAppSnapshot() {
+    free(vm_data_);
+    delete vm_instructions_mapping_;
+    free(isolate_data_);
+    delete isolate_instructions_mapping_;
+  }
+
+  void SetBuffers(const uint8_t** vm_data_buffer,
+                  const uint8_t** vm_instructions_buffer,
+                  const uint8_t** isolate_data_buffer,
+                  const uint8_t** isolate_instructions_buffer) {
+    if (vm_data_ != nullptr) {
+      *vm_data_buffer = vm_data_;
+    }
+    if (vm_instructions_mapping_ != nullptr) {
+      *vm_instructions_buffer =
+          reinterpret_cast<const uint8_t*>(vm_instructions_mapping_->address());
+    }
+    if (isolate_data_ != nullptr) {
+      *isolate_data_buffer = isolate_data_;
+    }
+    if (isolate_instructions_mapping_ != nullptr) {
+      *isolate_instructions_buffer = reinterpret_cast<const uint8_t*>(
+          isolate_instructions_mapping_->address());
+    }
+  }
+
+ private:
+  uint8_t* vm_data_;
+  MappedMemory* vm_instructions_mapping_;
+  uint8_t* isolate_data_;
+  MappedMemory* isolate_instructions_mapping_;
+};
+
+// Maps the gzipped section at [position, position + size) and inflates it
+// into a buffer allocated in the C heap.
+static uint8_t* DecompressSection(File* file,
+                                  const char* script_name,
+                                  int64_t position,
+                                  int64_t size) {
+  MappedMemory* mapping = file->Map(File::kReadOnly, position, size);
+  if (mapping == nullptr) {
+    FATAL1("Failed to memory map snapshot: %s\n", script_name);
+  }
+  uint8_t* decompressed = nullptr;
+  intptr_t decompressed_size = 0;
+  Decompress(reinterpret_cast<const uint8_t*>(mapping->address()), size,
+             &decompressed, &decompressed_size);
+  delete mapping;
+  return decompressed;
+}
+
 static AppSnapshot* TryReadAppSnapshotBlobs(const char* script_name,
                                             File* file) {
   if ((file->Length() - file->Position()) < kAppSnapshotHeaderSize) {
@@ -83,8 +155,12 @@ static AppSnapshot* TryReadAppSnapshotBlobs(const char* script_name,
     return nullptr;
   }
   ASSERT(sizeof(header[0]) == appjit_magic_number.length);
-  if (memcmp(&header[0], appjit_magic_number.bytes,
-             appjit_magic_number.length) != 0) {
+  bool compressed_data = false;
+  if (memcmp(&header[0], appjit_gzip_magic_number.bytes,
+             appjit_gzip_magic_number.length) == 0) {
+    compressed_data = true;
+  } else if (memcmp(&header[0], appjit_magic_number.bytes,
+                    appjit_magic_number.length) != 0) {
     return nullptr;
   }
 
@@ -108,6 +184,46 @@ static AppSnapshot* TryReadAppSnapshotBlobs(const char* script_name,
         Utils::RoundUp(isolate_instructions_position, kAppSnapshotPageSize);
   }
 
+  if (compressed_data) {
+    // The sizes in the header are the stored (compressed) sizes of the data
+    // sections; the decompressed sizes are carried in the gzip streams
+    // themselves.
+    uint8_t* vm_data_buffer = nullptr;
+    if (vm_data_size != 0) {
+      vm_data_buffer =
+          DecompressSection(file, script_name, vm_data_position, vm_data_size);
+    }
+
+    MappedMemory* vm_instr_mapping = nullptr;
+    if (vm_instructions_size != 0) {
+      vm_instr_mapping = file->Map(File::kReadExecute, vm_instructions_position,
+                                   vm_instructions_size);
+      if (vm_instr_mapping == nullptr) {
+        FATAL1("Failed to memory map snapshot: %s\n", script_name);
+      }
+    }
+
+    uint8_t* isolate_data_buffer = nullptr;
+    if (isolate_data_size != 0) {
+      isolate_data_buffer = DecompressSection(
+          file, script_name, isolate_data_position, isolate_data_size);
+    }
+
+    MappedMemory* isolate_instr_mapping = nullptr;
+    if (isolate_instructions_size != 0) {
+      isolate_instr_mapping =
+          file->Map(File::kReadExecute, isolate_instructions_position,
+                    isolate_instructions_size);
+      if (isolate_instr_mapping == nullptr) {
+        FATAL1("Failed to memory map snapshot: %s\n", script_name);
+      }
+    }
+
+    return new DecompressedAppSnapshot(vm_data_buffer, vm_instr_mapping,
+                                       isolate_data_buffer,
+                                       isolate_instr_mapping);
+  }
+
   MappedMemory* vm_data_mapping = nullptr;
   if (vm_data_size != 0) {
     vm_data_mapping =
@@ -403,13 +519,35 @@ void Snapshot::WriteAppSnapshot(const char* filename,
                                 uint8_t* isolate_data_buffer,
                                 intptr_t isolate_data_size,
                                 uint8_t* isolate_instructions_buffer,
-                                intptr_t isolate_instructions_size) {
+                                intptr_t isolate_instructions_size,
+                                bool compress_data) {
   File* file = File::Open(NULL, filename, File::kWriteTruncate);
   if (file == NULL) {
     ErrorExit(kErrorExitCode, "Unable to write snapshot file '%s'\n", filename);
   }
 
-  file->WriteFully(appjit_magic_number.bytes, appjit_magic_number.length);
+  // When requested, the data sections are gzipped before being written and
+  // the header records their compressed sizes. The instruction sections stay
+  // uncompressed so they can still be mapped executable directly from the
+  // snapshot file.
+  uint8_t* compressed_vm_data = NULL;
+  uint8_t* compressed_isolate_data = NULL;
+  if (compress_data) {
+    if (vm_data_size != 0) {
+      Compress(vm_data_buffer, vm_data_size, &compressed_vm_data,
+               &vm_data_size);
+      vm_data_buffer = compressed_vm_data;
+    }
+    if (isolate_data_size != 0) {
+      Compress(isolate_data_buffer, isolate_data_size,
+               &compressed_isolate_data, &isolate_data_size);
+      isolate_data_buffer = compressed_isolate_data;
+    }
+  }
+
+  const MagicNumberData& magic_number =
+      compress_data ? appjit_gzip_magic_number : appjit_magic_number;
+  file->WriteFully(magic_number.bytes, magic_number.length);
   WriteInt64(file, vm_data_size);
   WriteInt64(file, vm_instructions_size);
   WriteInt64(file, isolate_data_size);
@@ -455,6 +593,9 @@ void Snapshot::WriteAppSnapshot(const char* filename,
     }
   }
 
+  free(compressed_vm_data);
+  free(compressed_isolate_data);
+
   file->Flush();
   file->Release();
 }
@@ -483,7 +624,8 @@ void Snapshot::GenerateKernel(const char* snapshot_filename,
 #endif  // !defined(EXCLUDE_CFE_AND_KERNEL_PLATFORM) && !defined(TESTING)
 }
 
-void Snapshot::GenerateAppJIT(const char* snapshot_filename) {
+void Snapshot::GenerateAppJIT(const char* snapshot_filename,
+                              bool compress_data) {
 #if defined(TARGET_ARCH_IA32)
   // Snapshots with code are not supported on IA32.
   uint8_t* isolate_buffer = NULL;
@@ -496,7 +638,7 @@ void Snapshot::GenerateAppJIT(const char* snapshot_filename) {
   }
 
   WriteAppSnapshot(snapshot_filename, NULL, 0, NULL, 0, isolate_buffer,
-                   isolate_size, NULL, 0);
+                   isolate_size, NULL, 0, compress_data);
 #else
   uint8_t* isolate_data_buffer = NULL;
   intptr_t isolate_data_size = 0;
@@ -510,7 +652,7 @@ void Snapshot::GenerateAppJIT(const char* snapshot_filename) {
   }
   WriteAppSnapshot(snapshot_filename, NULL, 0, NULL, 0, isolate_data_buffer,
                    isolate_data_size, isolate_instructions_buffer,
-                   isolate_instructions_size);
+                   isolate_instructions_size, compress_data);
 #endif
 }
 
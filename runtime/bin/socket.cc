@@ -126,6 +126,34 @@ Dart_Handle ListeningSocketRegistry::CreateBindListen(Dart_Handle socket_object,
           return DartUtils::NewDartOSError(&os_error);
         }
 
+#if defined(HOST_OS_LINUX) || defined(HOST_OS_ANDROID)
+        // On kernels with SO_REUSEPORT, give each additional shared listener
+        // its own file descriptor so the kernel balances accepts across the
+        // listeners instead of the event handler fanning out accepts from a
+        // single fd. If the kernel refuses the additional bind, fall through
+        // to sharing the original fd.
+        intptr_t balanced_fd =
+            ServerSocket::CreateBindListen(addr, backlog, v6_only,
+                                           /*reuse_port=*/true);
+        if (balanced_fd >= 0) {
+          if (!ServerSocket::StartAccept(balanced_fd)) {
+            OSError os_error(-1, "Failed to start accept", OSError::kUnknown);
+            return DartUtils::NewDartOSError(&os_error);
+          }
+          Socket* balanced_socketfd = new Socket(balanced_fd);
+          OSSocket* balanced_socket =
+              new OSSocket(addr, os_socket_same_addr->port, v6_only, shared,
+                           balanced_socketfd, nullptr);
+          balanced_socket->ref_count = 1;
+          balanced_socket->next = first_os_socket;
+          InsertByPort(balanced_socket->port, balanced_socket);
+          InsertByFd(balanced_socketfd, balanced_socket);
+          Socket::ReuseSocketIdNativeField(socket_object, balanced_socketfd,
+                                           Socket::kFinalizerListening);
+          return Dart_True();
+        }
+#endif  // defined(HOST_OS_LINUX) || defined(HOST_OS_ANDROID)
+
         // This socket creation is the exact same as the one which originally
         // created the socket. Feed same fd and store it into native field
         // of dart socket_object. Sockets here will share same fd but contain a
@@ -142,8 +170,12 @@ Dart_Handle ListeningSocketRegistry::CreateBindListen(Dart_Handle socket_object,
     }
   }
 
-  // There is no socket listening on that (address, port), so we create new one.
-  intptr_t fd = ServerSocket::CreateBindListen(addr, backlog, v6_only);
+  // There is no socket listening on that (address, port), so we create new
+  // one. A shared listener asks for SO_REUSEPORT so later listeners on the
+  // same (address, port) can get their own kernel-balanced fd.
+  intptr_t fd =
+      ServerSocket::CreateBindListen(addr, backlog, v6_only,
+                                     /*reuse_port=*/shared);
   if (fd == -5) {
     OSError os_error(-1, "Invalid host", OSError::kUnknown);
     return DartUtils::NewDartOSError(&os_error);
@@ -564,34 +596,10 @@ void FUNCTION_NAME(Socket_Read)(Dart_NativeArguments args) {
   }
 }
 
-void FUNCTION_NAME(Socket_RecvFrom)(Dart_NativeArguments args) {
-  // TODO(sgjesse): Use a MTU value here. Only the loopback adapter can
-  // handle 64k datagrams.
-  const int kReceiveBufferLen = 65536;
-  Socket* socket =
-      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
-
-  // Ensure that a receive buffer for the UDP socket exists.
-  ASSERT(socket != nullptr);
-  uint8_t* recv_buffer = socket->udp_receive_buffer();
-  if (recv_buffer == nullptr) {
-    recv_buffer = reinterpret_cast<uint8_t*>(malloc(kReceiveBufferLen));
-    socket->set_udp_receive_buffer(recv_buffer);
-  }
-
-  // Read data into the buffer.
-  RawAddr addr;
-  const intptr_t bytes_read = SocketBase::RecvFrom(
-      socket->fd(), recv_buffer, kReceiveBufferLen, &addr, SocketBase::kAsync);
-  if (bytes_read == 0) {
-    Dart_SetReturnValue(args, Dart_Null());
-    return;
-  }
-  if (bytes_read < 0) {
-    ASSERT(bytes_read == -1);
-    Dart_ThrowException(DartUtils::NewDartOSError());
-  }
-
+// Builds a Datagram object from a received datagram and its sender address.
+static Dart_Handle MakeDatagram(const uint8_t* buffer,
+                                intptr_t bytes_read,
+                                RawAddr addr) {
   // Datagram data read. Copy into buffer of the exact size,
   ASSERT(bytes_read >= 0);
   uint8_t* data_buffer = nullptr;
@@ -603,7 +611,7 @@ void FUNCTION_NAME(Socket_RecvFrom)(Dart_NativeArguments args) {
     Dart_PropagateError(data);
   }
   ASSERT(data_buffer != nullptr);
-  memmove(data_buffer, recv_buffer, bytes_read);
+  memmove(data_buffer, buffer, bytes_read);
 
   // Memory Sanitizer complains addr not being initialized, which is done
   // through RecvFrom().
@@ -647,9 +655,92 @@ void FUNCTION_NAME(Socket_RecvFrom)(Dart_NativeArguments args) {
   if (Dart_IsError(io_lib)) {
     Dart_PropagateError(io_lib);
   }
-  Dart_Handle result = Dart_Invoke(
-      io_lib, DartUtils::NewString("_makeDatagram"), kNumArgs, dart_args);
-  Dart_SetReturnValue(args, result);
+  return Dart_Invoke(io_lib, DartUtils::NewString("_makeDatagram"), kNumArgs,
+                     dart_args);
+}
+
+// Ensures that a receive buffer for the UDP socket exists and returns it.
+static uint8_t* GetUdpReceiveBuffer(Socket* socket, intptr_t buffer_len) {
+  ASSERT(socket != nullptr);
+  uint8_t* recv_buffer = socket->udp_receive_buffer();
+  if (recv_buffer == nullptr) {
+    recv_buffer = reinterpret_cast<uint8_t*>(malloc(buffer_len));
+    socket->set_udp_receive_buffer(recv_buffer);
+  }
+  return recv_buffer;
+}
+
+// TODO(sgjesse): Use a MTU value here. Only the loopback adapter can
+// handle 64k datagrams.
+static const int kReceiveBufferLen = 65536;
+
+void FUNCTION_NAME(Socket_RecvFrom)(Dart_NativeArguments args) {
+  Socket* socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  uint8_t* recv_buffer = GetUdpReceiveBuffer(socket, kReceiveBufferLen);
+
+  // Read data into the buffer.
+  RawAddr addr;
+  const intptr_t bytes_read = SocketBase::RecvFrom(
+      socket->fd(), recv_buffer, kReceiveBufferLen, &addr, SocketBase::kAsync);
+  if (bytes_read == 0) {
+    Dart_SetReturnValue(args, Dart_Null());
+    return;
+  }
+  if (bytes_read < 0) {
+    ASSERT(bytes_read == -1);
+    Dart_ThrowException(DartUtils::NewDartOSError());
+  }
+
+  Dart_SetReturnValue(args, MakeDatagram(recv_buffer, bytes_read, addr));
+}
+
+void FUNCTION_NAME(Socket_ReceiveMessages)(Dart_NativeArguments args) {
+  Socket* socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  const int64_t buffer_size = DartUtils::GetInt64ValueCheckRange(
+      Dart_GetNativeArgument(args, 1), 1, kReceiveBufferLen);
+  int64_t num_messages = DartUtils::GetInt64ValueCheckRange(
+      Dart_GetNativeArgument(args, 2), 1, SocketBase::kReceiveMessagesMax);
+  // The batch shares the single receive buffer, so it holds fewer datagrams
+  // the bigger they are allowed to be. Datagrams larger than buffer_size
+  // are truncated, as with Socket_RecvFrom and its fixed 64k buffer.
+  if (num_messages > (kReceiveBufferLen / buffer_size)) {
+    num_messages = kReceiveBufferLen / buffer_size;
+  }
+  uint8_t* recv_buffer = GetUdpReceiveBuffer(socket, kReceiveBufferLen);
+
+  intptr_t lengths[SocketBase::kReceiveMessagesMax];
+  RawAddr addrs[SocketBase::kReceiveMessagesMax];
+  const intptr_t received =
+      SocketBase::ReceiveMessages(socket->fd(), recv_buffer, buffer_size,
+                                  num_messages, lengths, addrs,
+                                  SocketBase::kAsync);
+  if (received == 0) {
+    Dart_SetReturnValue(args, Dart_Null());
+    return;
+  }
+  if (received < 0) {
+    ASSERT(received == -1);
+    Dart_ThrowException(DartUtils::NewDartOSError());
+  }
+
+  Dart_Handle datagrams = Dart_NewList(received);
+  if (Dart_IsError(datagrams)) {
+    Dart_PropagateError(datagrams);
+  }
+  for (intptr_t i = 0; i < received; i++) {
+    Dart_Handle datagram =
+        MakeDatagram(recv_buffer + i * buffer_size, lengths[i], addrs[i]);
+    if (Dart_IsError(datagram)) {
+      Dart_PropagateError(datagram);
+    }
+    Dart_Handle result = Dart_ListSetAt(datagrams, i, datagram);
+    if (Dart_IsError(result)) {
+      Dart_PropagateError(result);
+    }
+  }
+  Dart_SetReturnValue(args, datagrams);
 }
 
 void FUNCTION_NAME(Socket_WriteList)(Dart_NativeArguments args) {
@@ -699,6 +790,112 @@ void FUNCTION_NAME(Socket_WriteList)(Dart_NativeArguments args) {
   }
 }
 
+void FUNCTION_NAME(Socket_WriteVec)(Dart_NativeArguments args) {
+  Socket* socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  Dart_Handle list_obj = Dart_GetNativeArgument(args, 1);
+  ASSERT(Dart_IsList(list_obj));
+  intptr_t num_buffers = 0;
+  Dart_Handle result = Dart_ListLength(list_obj, &num_buffers);
+  if (Dart_IsError(result)) {
+    Dart_PropagateError(result);
+  }
+  // Writing fewer buffers than passed is just a short write; the caller
+  // retries with the remainder.
+  if (num_buffers > SocketBase::kWriteVMax) {
+    num_buffers = SocketBase::kWriteVMax;
+  }
+  Dart_Handle handles[SocketBase::kWriteVMax];
+  const void* buffers[SocketBase::kWriteVMax];
+  intptr_t lengths[SocketBase::kWriteVMax];
+  // Fetch all the buffer handles before acquiring any data, as fetching may
+  // run Dart code for non-core lists.
+  for (intptr_t i = 0; i < num_buffers; i++) {
+    handles[i] = Dart_ListGetAt(list_obj, i);
+    if (Dart_IsError(handles[i])) {
+      Dart_PropagateError(handles[i]);
+    }
+  }
+  for (intptr_t i = 0; i < num_buffers; i++) {
+    Dart_TypedData_Type type;
+    void* data = nullptr;
+    intptr_t len = 0;
+    result = Dart_TypedDataAcquireData(handles[i], &type, &data, &len);
+    if (Dart_IsError(result)) {
+      for (intptr_t j = 0; j < i; j++) {
+        Dart_TypedDataReleaseData(handles[j]);
+      }
+      Dart_PropagateError(result);
+    }
+    buffers[i] = data;
+    lengths[i] = len;
+  }
+  bool short_write = false;
+  if (Socket::short_socket_write()) {
+    // Match Socket_WriteList: force a short write so retry paths are
+    // exercised in testing.
+    if (num_buffers > 1) {
+      short_write = true;
+      const intptr_t used = (num_buffers + 1) / 2;
+      for (intptr_t i = used; i < num_buffers; i++) {
+        Dart_TypedDataReleaseData(handles[i]);
+      }
+      num_buffers = used;
+    } else if ((num_buffers == 1) && (lengths[0] > 1)) {
+      short_write = true;
+      lengths[0] = (lengths[0] + 1) / 2;
+    }
+  }
+  intptr_t bytes_written = SocketBase::WriteV(socket->fd(), buffers, lengths,
+                                              num_buffers, SocketBase::kAsync);
+  if (bytes_written >= 0) {
+    for (intptr_t i = 0; i < num_buffers; i++) {
+      Dart_TypedDataReleaseData(handles[i]);
+    }
+    if (short_write) {
+      // If the write was forced 'short', indicate by returning the negative
+      // number of bytes. A forced short write may not trigger a write event.
+      Dart_SetIntegerReturnValue(args, -bytes_written);
+    } else {
+      Dart_SetIntegerReturnValue(args, bytes_written);
+    }
+  } else {
+    // Extract OSError before we release data, as it may override the error.
+    Dart_Handle error;
+    {
+      OSError os_error;
+      for (intptr_t i = 0; i < num_buffers; i++) {
+        Dart_TypedDataReleaseData(handles[i]);
+      }
+      error = DartUtils::NewDartOSError(&os_error);
+    }
+    Dart_ThrowException(error);
+  }
+}
+
+void FUNCTION_NAME(Socket_SendFile)(Dart_NativeArguments args) {
+  Socket* socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  File* file = File::GetPeer(Dart_GetNativeArgument(args, 1));
+  ASSERT(file != NULL);
+  const int64_t offset = DartUtils::GetInt64ValueCheckRange(
+      Dart_GetNativeArgument(args, 2), 0, kMaxInt64);
+  const int64_t count = DartUtils::GetInt64ValueCheckRange(
+      Dart_GetNativeArgument(args, 3), 1, kMaxInt64);
+  const intptr_t bytes_sent =
+      SocketBase::SendFile(socket->fd(), file->GetFD(), offset, count);
+  if (bytes_sent >= 0) {
+    // A result of 0 means the transfer would block; the caller retries on
+    // the next write event.
+    Dart_SetIntegerReturnValue(args, bytes_sent);
+  } else if (bytes_sent == SocketBase::kSendFileUnsupported) {
+    // Tell the caller to fall back to copying through a buffer.
+    Dart_SetReturnValue(args, Dart_Null());
+  } else {
+    Dart_ThrowException(DartUtils::NewDartOSError());
+  }
+}
+
 void FUNCTION_NAME(Socket_SendTo)(Dart_NativeArguments args) {
   Socket* socket =
       Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
@@ -890,44 +1087,198 @@ void FUNCTION_NAME(ServerSocket_Accept)(Dart_NativeArguments args) {
   }
 }
 
+static CObjectArray* NewLookupResponse(intptr_t count, const RawAddr* addrs) {
+  CObjectArray* array = new CObjectArray(CObject::NewArray(count + 1));
+  array->SetAt(0, new CObjectInt32(CObject::NewInt32(0)));
+  for (intptr_t i = 0; i < count; i++) {
+    RawAddr raw = addrs[i];
+    SocketAddress addr(&raw.addr);
+    CObjectArray* entry = new CObjectArray(CObject::NewArray(4));
+
+    CObjectInt32* type = new CObjectInt32(CObject::NewInt32(addr.GetType()));
+    entry->SetAt(0, type);
+
+    CObjectString* as_string =
+        new CObjectString(CObject::NewString(addr.as_string()));
+    entry->SetAt(1, as_string);
+
+    CObjectUint8Array* data = SocketAddress::ToCObject(raw);
+    entry->SetAt(2, data);
+
+    CObjectInt64* scope_id =
+        new CObjectInt64(CObject::NewInt64(SocketAddress::GetAddrScope(raw)));
+    entry->SetAt(3, scope_id);
+
+    array->SetAt(i + 1, entry);
+  }
+  return array;
+}
+
+Mutex* LookupCache::mutex_ = nullptr;
+LookupCache::Entry* LookupCache::entries_ = nullptr;
+intptr_t LookupCache::num_entries_ = 0;
+
+void LookupCache::Initialize() {
+  ASSERT(mutex_ == nullptr);
+  mutex_ = new Mutex();
+}
+
+void LookupCache::Cleanup() {
+  ASSERT(mutex_ != nullptr);
+  Entry* entry = entries_;
+  while (entry != nullptr) {
+    Entry* next = entry->next;
+    DeleteEntry(entry);
+    entry = next;
+  }
+  entries_ = nullptr;
+  num_entries_ = 0;
+  delete mutex_;
+  mutex_ = nullptr;
+}
+
+void LookupCache::DeleteEntry(Entry* entry) {
+  free(entry->host);
+  delete[] entry->addrs;
+  free(entry->error_message);
+  delete entry;
+}
+
+void LookupCache::AddEntry(Entry* entry) {
+  // Called with mutex_ held. Replaces any entry with the same key and drops
+  // the oldest entry once the cache is full.
+  Entry* prev = nullptr;
+  Entry* current = entries_;
+  while (current != nullptr) {
+    if ((current->type == entry->type) &&
+        (strcmp(current->host, entry->host) == 0)) {
+      if (prev == nullptr) {
+        entries_ = current->next;
+      } else {
+        prev->next = current->next;
+      }
+      DeleteEntry(current);
+      num_entries_--;
+      break;
+    }
+    prev = current;
+    current = current->next;
+  }
+  if (num_entries_ >= kMaxEntries) {
+    ASSERT(entries_ != nullptr);
+    prev = entries_;
+    while (prev->next->next != nullptr) {
+      prev = prev->next;
+    }
+    DeleteEntry(prev->next);
+    prev->next = nullptr;
+    num_entries_--;
+  }
+  entry->next = entries_;
+  entries_ = entry;
+  num_entries_++;
+}
+
+CObject* LookupCache::FindResponse(const char* host, int type) {
+  if (mutex_ == nullptr) {
+    return nullptr;
+  }
+  MutexLocker locker(mutex_);
+  const int64_t now = TimerUtils::GetCurrentMonotonicMillis();
+  Entry* prev = nullptr;
+  Entry* current = entries_;
+  while (current != nullptr) {
+    Entry* next = current->next;
+    if (current->expiry <= now) {
+      // Purge expired entries as they are encountered.
+      if (prev == nullptr) {
+        entries_ = next;
+      } else {
+        prev->next = next;
+      }
+      DeleteEntry(current);
+      num_entries_--;
+      current = next;
+      continue;
+    }
+    if ((current->type == type) && (strcmp(current->host, host) == 0)) {
+      if (current->count >= 0) {
+        return NewLookupResponse(current->count, current->addrs);
+      }
+      OSError os_error(current->error_code, current->error_message,
+                       OSError::kGetAddressInfo);
+      return CObject::NewOSError(&os_error);
+    }
+    prev = current;
+    current = next;
+  }
+  return nullptr;
+}
+
+void LookupCache::Insert(const char* host,
+                         int type,
+                         intptr_t count,
+                         RawAddr* addrs) {
+  if (mutex_ == nullptr) {
+    delete[] addrs;
+    return;
+  }
+  Entry* entry = new Entry();
+  entry->next = nullptr;
+  entry->host = Utils::StrDup(host);
+  entry->type = type;
+  entry->expiry = TimerUtils::GetCurrentMonotonicMillis() + kPositiveTtlMillis;
+  entry->count = count;
+  entry->addrs = addrs;
+  entry->error_code = 0;
+  entry->error_message = nullptr;
+  MutexLocker locker(mutex_);
+  AddEntry(entry);
+}
+
+void LookupCache::InsertFailure(const char* host,
+                                int type,
+                                OSError* os_error) {
+  if (mutex_ == nullptr) {
+    return;
+  }
+  Entry* entry = new Entry();
+  entry->next = nullptr;
+  entry->host = Utils::StrDup(host);
+  entry->type = type;
+  entry->expiry = TimerUtils::GetCurrentMonotonicMillis() + kNegativeTtlMillis;
+  entry->count = -1;
+  entry->addrs = nullptr;
+  entry->error_code = os_error->code();
+  entry->error_message =
+      Utils::StrDup(os_error->message() != nullptr ? os_error->message() : "");
+  MutexLocker locker(mutex_);
+  AddEntry(entry);
+}
+
 CObject* Socket::LookupRequest(const CObjectArray& request) {
   if ((request.Length() == 2) && request[0]->IsString() &&
       request[1]->IsInt32()) {
     CObjectString host(request[0]);
     CObjectInt32 type(request[1]);
-    CObject* result = nullptr;
+    CObject* result = LookupCache::FindResponse(host.CString(), type.Value());
+    if (result != nullptr) {
+      return result;
+    }
     OSError* os_error = nullptr;
     AddressList<SocketAddress>* addresses =
         SocketBase::LookupAddress(host.CString(), type.Value(), &os_error);
     if (addresses != nullptr) {
-      CObjectArray* array =
-          new CObjectArray(CObject::NewArray(addresses->count() + 1));
-      array->SetAt(0, new CObjectInt32(CObject::NewInt32(0)));
-      for (intptr_t i = 0; i < addresses->count(); i++) {
-        SocketAddress* addr = addresses->GetAt(i);
-        CObjectArray* entry = new CObjectArray(CObject::NewArray(4));
-
-        CObjectInt32* type =
-            new CObjectInt32(CObject::NewInt32(addr->GetType()));
-        entry->SetAt(0, type);
-
-        CObjectString* as_string =
-            new CObjectString(CObject::NewString(addr->as_string()));
-        entry->SetAt(1, as_string);
-
-        RawAddr raw = addr->addr();
-        CObjectUint8Array* data = SocketAddress::ToCObject(raw);
-        entry->SetAt(2, data);
-
-        CObjectInt64* scope_id = new CObjectInt64(
-            CObject::NewInt64(SocketAddress::GetAddrScope(raw)));
-        entry->SetAt(3, scope_id);
-
-        array->SetAt(i + 1, entry);
+      const intptr_t count = addresses->count();
+      RawAddr* addrs = new RawAddr[count];
+      for (intptr_t i = 0; i < count; i++) {
+        addrs[i] = addresses->GetAt(i)->addr();
       }
-      result = array;
       delete addresses;
+      result = NewLookupResponse(count, addrs);
+      LookupCache::Insert(host.CString(), type.Value(), count, addrs);
     } else {
+      LookupCache::InsertFailure(host.CString(), type.Value(), os_error);
       result = CObject::NewOSError(os_error);
       delete os_error;
     }
@@ -1113,6 +1464,18 @@ void FUNCTION_NAME(Socket_SetOption)(Dart_NativeArguments args) {
   }
 }
 
+void FUNCTION_NAME(Socket_SetCork)(Dart_NativeArguments args) {
+  Socket* socket =
+      Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
+  bool enabled = DartUtils::GetBooleanValue(Dart_GetNativeArgument(args, 1));
+  // Corking lets a caller that emits a burst of small frames batch them into
+  // full segments in the kernel without a user-space coalescing buffer;
+  // uncorking flushes the remainder. Returns false where the platform has no
+  // cork option so callers can skip the uncork.
+  Dart_SetBooleanReturnValue(args,
+                             SocketBase::SetCork(socket->fd(), enabled));
+}
+
 void FUNCTION_NAME(Socket_SetRawOption)(Dart_NativeArguments args) {
   Socket* socket =
       Socket::GetSocketIdNativeField(Dart_GetNativeArgument(args, 0));
@@ -147,9 +147,14 @@ class ServerSocket {
   //
   //   -1: system error (errno set)
   //   -5: invalid bindAddress
+  //
+  // If `reuse_port` is true, SO_REUSEPORT is set before binding on platforms
+  // where it balances accepts between listening sockets (Linux and Android);
+  // elsewhere the flag is ignored.
   static intptr_t CreateBindListen(const RawAddr& addr,
                                    intptr_t backlog,
-                                   bool v6_only = false);
+                                   bool v6_only = false,
+                                   bool reuse_port = false);
   static intptr_t CreateUnixDomainBindListen(const RawAddr& addr,
                                              intptr_t backlog);
 
@@ -319,6 +324,59 @@ class ListeningSocketRegistry {
   DISALLOW_COPY_AND_ASSIGN(ListeningSocketRegistry);
 };
 
+// Process-wide cache of name lookup results, shared by all isolates.
+// getaddrinfo does not surface record TTLs, so positive results are kept for
+// a fixed 60 seconds and failures for 5 seconds - long enough to absorb
+// lookup bursts against the same hosts without risking long-lived stale
+// entries.
+class LookupCache {
+ public:
+  static void Initialize();
+  static void Cleanup();
+
+  // Returns a lookup response built from a live cache entry, or nullptr if
+  // nothing usable is cached for (host, type).
+  static CObject* FindResponse(const char* host, int type);
+
+  // Caches the addresses resolved for (host, type). Takes ownership of
+  // addrs.
+  static void Insert(const char* host,
+                     int type,
+                     intptr_t count,
+                     RawAddr* addrs);
+
+  // Caches a failed lookup of (host, type).
+  static void InsertFailure(const char* host, int type, OSError* os_error);
+
+ private:
+  struct Entry {
+    Entry* next;
+    char* host;
+    int type;
+    int64_t expiry;
+    intptr_t count;  // Negative: entry caches a failure.
+    RawAddr* addrs;
+    int error_code;
+    char* error_message;
+  };
+
+  static const int64_t kPositiveTtlMillis = 60 * 1000;
+  static const int64_t kNegativeTtlMillis = 5 * 1000;
+  static const intptr_t kMaxEntries = 256;
+
+  static void DeleteEntry(Entry* entry);
+  static void AddEntry(Entry* entry);
+
+  // Guards entries_ and num_entries_. nullptr outside of
+  // Initialize..Cleanup, during which the cache is disabled.
+  static Mutex* mutex_;
+  static Entry* entries_;
+  static intptr_t num_entries_;
+
+  DISALLOW_ALLOCATION();
+  DISALLOW_IMPLICIT_CONSTRUCTORS(LookupCache);
+};
+
 }  // namespace bin
 }  // namespace dart
 
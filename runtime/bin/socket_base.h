@@ -172,6 +172,28 @@ class SocketBase : public AllStatic {
                         const void* buffer,
                         intptr_t num_bytes,
                         SocketOpKind sync);
+  // Gather-write: writes the count buffers in order, with a single syscall
+  // where the OS supports it. Returns the total number of bytes written,
+  // which falls short of the sum of the buffer lengths on a partial write,
+  // 0 if the operation would block, or -1 on error.
+  static intptr_t WriteV(intptr_t fd,
+                         const void* const* buffers,
+                         const intptr_t* lengths,
+                         intptr_t count,
+                         SocketOpKind sync);
+  // Maximum number of buffers a single WriteV call accepts.
+  static const intptr_t kWriteVMax = 64;
+  // Transfer a region of an open file directly to the socket without
+  // copying it through a user-space buffer. Returns the number of bytes
+  // sent, 0 if the operation would block (retry on the next write event),
+  // kSendFileUnsupported if the OS cannot transfer between the two
+  // descriptors (the caller should fall back to Read/Write copying), or
+  // -1 on error.
+  static intptr_t SendFile(intptr_t fd,
+                           intptr_t file_fd,
+                           int64_t offset,
+                           int64_t count);
+  static const intptr_t kSendFileUnsupported = -2;
   // Send data on a socket. The port to send to is specified in the port
   // component of the passed RawAddr structure. The RawAddr structure is only
   // used for datagram sockets.
@@ -185,6 +207,20 @@ class SocketBase : public AllStatic {
                            intptr_t num_bytes,
                            RawAddr* addr,
                            SocketOpKind sync);
+  // Receive up to num_messages datagrams in one operation. Datagram i is
+  // stored at buffers + i * buffer_size, its length in lengths[i] and its
+  // sender in addrs[i]. Returns the number of datagrams received, 0 if the
+  // operation would block, or -1 on error. Platforms without a batched
+  // receive syscall drain the socket with one syscall per datagram instead.
+  static intptr_t ReceiveMessages(intptr_t fd,
+                                  uint8_t* buffers,
+                                  intptr_t buffer_size,
+                                  intptr_t num_messages,
+                                  intptr_t* lengths,
+                                  RawAddr* addrs,
+                                  SocketOpKind sync);
+  // Maximum number of datagrams a single ReceiveMessages call can return.
+  static const intptr_t kReceiveMessagesMax = 64;
   static bool AvailableDatagram(intptr_t fd, void* buffer, intptr_t num_bytes);
   // Returns true if the given error-number is because the system was not able
   // to bind the socket to a specific IP.
@@ -197,6 +233,11 @@ class SocketBase : public AllStatic {
   static void Close(intptr_t fd);
   static bool GetNoDelay(intptr_t fd, bool* enabled);
   static bool SetNoDelay(intptr_t fd, bool enabled);
+  // Corks or uncorks a TCP socket. While corked the kernel aggregates
+  // partial frames into full segments instead of sending them immediately;
+  // uncorking flushes whatever is pending. Supported on Linux and Android
+  // (TCP_CORK) and macOS (TCP_NOPUSH); returns false elsewhere.
+  static bool SetCork(intptr_t fd, bool enabled);
   static bool GetMulticastLoop(intptr_t fd, intptr_t protocol, bool* enabled);
   static bool SetMulticastLoop(intptr_t fd, intptr_t protocol, bool enabled);
   static bool GetMulticastHops(intptr_t fd, intptr_t protocol, int* value);
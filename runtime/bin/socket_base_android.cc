@@ -14,7 +14,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/sendfile.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include "bin/fdutils.h"
@@ -98,6 +100,41 @@ intptr_t SocketBase::RecvFrom(intptr_t fd,
   return read_bytes;
 }
 
+intptr_t SocketBase::ReceiveMessages(intptr_t fd,
+                                     uint8_t* buffers,
+                                     intptr_t buffer_size,
+                                     intptr_t num_messages,
+                                     intptr_t* lengths,
+                                     RawAddr* addrs,
+                                     SocketOpKind sync) {
+  ASSERT(fd >= 0);
+  ASSERT(num_messages <= kReceiveMessagesMax);
+  struct mmsghdr headers[kReceiveMessagesMax];
+  struct iovec iovecs[kReceiveMessagesMax];
+  memset(headers, 0, num_messages * sizeof(headers[0]));
+  for (intptr_t i = 0; i < num_messages; i++) {
+    iovecs[i].iov_base = buffers + i * buffer_size;
+    iovecs[i].iov_len = buffer_size;
+    headers[i].msg_hdr.msg_name = &addrs[i].addr;
+    headers[i].msg_hdr.msg_namelen = sizeof(addrs[i].ss);
+    headers[i].msg_hdr.msg_iov = &iovecs[i];
+    headers[i].msg_hdr.msg_iovlen = 1;
+  }
+  const intptr_t result =
+      TEMP_FAILURE_RETRY(recvmmsg(fd, headers, num_messages, 0, NULL));
+  ASSERT(EAGAIN == EWOULDBLOCK);
+  if (result == -1) {
+    if ((sync == kAsync) && (errno == EWOULDBLOCK)) {
+      return 0;
+    }
+    return -1;
+  }
+  for (intptr_t i = 0; i < result; i++) {
+    lengths[i] = headers[i].msg_len;
+  }
+  return result;
+}
+
 bool SocketBase::AvailableDatagram(intptr_t fd,
                                    void* buffer,
                                    intptr_t num_bytes) {
@@ -122,6 +159,52 @@ intptr_t SocketBase::Write(intptr_t fd,
   return written_bytes;
 }
 
+intptr_t SocketBase::WriteV(intptr_t fd,
+                            const void* const* buffers,
+                            const intptr_t* lengths,
+                            intptr_t count,
+                            SocketOpKind sync) {
+  ASSERT(fd >= 0);
+  ASSERT(count <= kWriteVMax);
+  struct iovec iov[kWriteVMax];
+  for (intptr_t i = 0; i < count; i++) {
+    iov[i].iov_base = const_cast<void*>(buffers[i]);
+    iov[i].iov_len = lengths[i];
+  }
+  ssize_t written_bytes = TEMP_FAILURE_RETRY(writev(fd, iov, count));
+  ASSERT(EAGAIN == EWOULDBLOCK);
+  if ((sync == kAsync) && (written_bytes == -1) && (errno == EWOULDBLOCK)) {
+    // If the would block we need to retry and therefore return 0 as
+    // the number of bytes written.
+    written_bytes = 0;
+  }
+  return written_bytes;
+}
+
+intptr_t SocketBase::SendFile(intptr_t fd,
+                              intptr_t file_fd,
+                              int64_t offset,
+                              int64_t count) {
+  ASSERT(fd >= 0);
+  ASSERT(file_fd >= 0);
+  off64_t file_offset = offset;
+  const ssize_t written_bytes =
+      TEMP_FAILURE_RETRY(sendfile64(fd, file_fd, &file_offset, count));
+  ASSERT(EAGAIN == EWOULDBLOCK);
+  if (written_bytes == -1) {
+    if (errno == EWOULDBLOCK) {
+      // The send buffer is full; retry when the socket becomes writable.
+      return 0;
+    }
+    if ((errno == EINVAL) || (errno == ENOSYS)) {
+      // The kernel cannot transfer between this descriptor pair; fall back
+      // to copying through a user-space buffer.
+      return kSendFileUnsupported;
+    }
+  }
+  return written_bytes;
+}
+
 intptr_t SocketBase::SendTo(intptr_t fd,
                             const void* buffer,
                             intptr_t num_bytes,
@@ -354,6 +437,13 @@ bool SocketBase::SetNoDelay(intptr_t fd, bool enabled) {
                                       sizeof(on))) == 0;
 }
 
+bool SocketBase::SetCork(intptr_t fd, bool enabled) {
+  int on = enabled ? 1 : 0;
+  return NO_RETRY_EXPECTED(setsockopt(fd, IPPROTO_TCP, TCP_CORK,
+                                      reinterpret_cast<char*>(&on),
+                                      sizeof(on))) == 0;
+}
+
 bool SocketBase::GetMulticastLoop(intptr_t fd,
                                   intptr_t protocol,
                                   bool* enabled) {
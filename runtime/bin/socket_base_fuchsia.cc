@@ -124,6 +124,33 @@ intptr_t SocketBase::RecvFrom(intptr_t fd,
   return -1;
 }
 
+intptr_t SocketBase::ReceiveMessages(intptr_t fd,
+                                     uint8_t* buffers,
+                                     intptr_t buffer_size,
+                                     intptr_t num_messages,
+                                     intptr_t* lengths,
+                                     RawAddr* addrs,
+                                     SocketOpKind sync) {
+  // There is no batched receive syscall; drain the socket one datagram at
+  // a time until it would block or the batch is full.
+  ASSERT(num_messages <= kReceiveMessagesMax);
+  intptr_t received = 0;
+  while (received < num_messages) {
+    const intptr_t bytes_read =
+        RecvFrom(fd, buffers + received * buffer_size, buffer_size,
+                 &addrs[received], sync);
+    if (bytes_read < 0) {
+      return (received > 0) ? received : -1;
+    }
+    if (bytes_read == 0) {
+      break;
+    }
+    lengths[received] = bytes_read;
+    received++;
+  }
+  return received;
+}
+
 bool SocketBase::AvailableDatagram(intptr_t fd,
                                    void* buffer,
                                    intptr_t num_bytes) {
@@ -154,6 +181,36 @@ intptr_t SocketBase::Write(intptr_t fd,
   return written_bytes;
 }
 
+intptr_t SocketBase::WriteV(intptr_t fd,
+                            const void* const* buffers,
+                            const intptr_t* lengths,
+                            intptr_t count,
+                            SocketOpKind sync) {
+  // IOHandle has no gather-write; write the buffers in order and stop at
+  // the first partial or blocked write.
+  intptr_t total = 0;
+  for (intptr_t i = 0; i < count; i++) {
+    const intptr_t written = Write(fd, buffers[i], lengths[i], sync);
+    if (written < 0) {
+      return (total > 0) ? total : -1;
+    }
+    total += written;
+    if (written < lengths[i]) {
+      break;
+    }
+  }
+  return total;
+}
+
+intptr_t SocketBase::SendFile(intptr_t fd,
+                              intptr_t file_fd,
+                              int64_t offset,
+                              int64_t count) {
+  // Fuchsia has no in-kernel file-to-socket transfer; the caller falls back
+  // to copying through a user-space buffer.
+  return kSendFileUnsupported;
+}
+
 intptr_t SocketBase::SendTo(intptr_t fd,
                             const void* buffer,
                             intptr_t num_bytes,
@@ -353,6 +410,13 @@ bool SocketBase::SetNoDelay(intptr_t fd, bool enabled) {
                                       sizeof(on))) == 0;
 }
 
+bool SocketBase::SetCork(intptr_t fd, bool enabled) {
+  // TCP_CORK is not plumbed through the Fuchsia socket interface.
+  USE(fd);
+  USE(enabled);
+  return false;
+}
+
 bool SocketBase::GetMulticastLoop(intptr_t fd,
                                   intptr_t protocol,
                                   bool* enabled) {
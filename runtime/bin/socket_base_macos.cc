@@ -14,7 +14,10 @@
 #include <stdio.h>        // NOLINT
 #include <stdlib.h>       // NOLINT
 #include <string.h>       // NOLINT
+#include <sys/socket.h>   // NOLINT
 #include <sys/stat.h>     // NOLINT
+#include <sys/types.h>    // NOLINT
+#include <sys/uio.h>      // NOLINT
 #include <unistd.h>       // NOLINT
 
 #include "bin/fdutils.h"
@@ -97,6 +100,33 @@ intptr_t SocketBase::RecvFrom(intptr_t fd,
   return read_bytes;
 }
 
+intptr_t SocketBase::ReceiveMessages(intptr_t fd,
+                                     uint8_t* buffers,
+                                     intptr_t buffer_size,
+                                     intptr_t num_messages,
+                                     intptr_t* lengths,
+                                     RawAddr* addrs,
+                                     SocketOpKind sync) {
+  // There is no batched receive syscall; drain the socket one datagram at
+  // a time until it would block or the batch is full.
+  ASSERT(num_messages <= kReceiveMessagesMax);
+  intptr_t received = 0;
+  while (received < num_messages) {
+    const intptr_t bytes_read =
+        RecvFrom(fd, buffers + received * buffer_size, buffer_size,
+                 &addrs[received], sync);
+    if (bytes_read < 0) {
+      return (received > 0) ? received : -1;
+    }
+    if (bytes_read == 0) {
+      break;
+    }
+    lengths[received] = bytes_read;
+    received++;
+  }
+  return received;
+}
+
 bool SocketBase::AvailableDatagram(intptr_t fd,
                                    void* buffer,
                                    intptr_t num_bytes) {
@@ -121,6 +151,55 @@ intptr_t SocketBase::Write(intptr_t fd,
   return written_bytes;
 }
 
+intptr_t SocketBase::WriteV(intptr_t fd,
+                            const void* const* buffers,
+                            const intptr_t* lengths,
+                            intptr_t count,
+                            SocketOpKind sync) {
+  ASSERT(fd >= 0);
+  ASSERT(count <= kWriteVMax);
+  struct iovec iov[kWriteVMax];
+  for (intptr_t i = 0; i < count; i++) {
+    iov[i].iov_base = const_cast<void*>(buffers[i]);
+    iov[i].iov_len = lengths[i];
+  }
+  ssize_t written_bytes = TEMP_FAILURE_RETRY(writev(fd, iov, count));
+  ASSERT(EAGAIN == EWOULDBLOCK);
+  if ((sync == kAsync) && (written_bytes == -1) && (errno == EWOULDBLOCK)) {
+    // If the would block we need to retry and therefore return 0 as
+    // the number of bytes written.
+    written_bytes = 0;
+  }
+  return written_bytes;
+}
+
+intptr_t SocketBase::SendFile(intptr_t fd,
+                              intptr_t file_fd,
+                              int64_t offset,
+                              int64_t count) {
+  ASSERT(fd >= 0);
+  ASSERT(file_fd >= 0);
+  // A length of 0 means "send until end of file" on macOS, so the caller
+  // must pass the number of bytes to transfer explicitly.
+  off_t len = count;
+  const intptr_t result =
+      TEMP_FAILURE_RETRY(sendfile(file_fd, fd, offset, &len, NULL, 0));
+  if (result == -1) {
+    if (errno == EAGAIN) {
+      // The send buffer filled up; len holds the bytes sent so far. A
+      // result of 0 means retry when the socket becomes writable.
+      return len;
+    }
+    if ((errno == ENOTSUP) || (errno == EINVAL)) {
+      // The descriptor pair cannot be transferred in the kernel; fall back
+      // to copying through a user-space buffer.
+      return kSendFileUnsupported;
+    }
+    return -1;
+  }
+  return len;
+}
+
 intptr_t SocketBase::SendTo(intptr_t fd,
                             const void* buffer,
                             intptr_t num_bytes,
@@ -346,6 +425,13 @@ bool SocketBase::SetNoDelay(intptr_t fd, bool enabled) {
                                       sizeof(on))) == 0;
 }
 
+bool SocketBase::SetCork(intptr_t fd, bool enabled) {
+  int on = enabled ? 1 : 0;
+  return NO_RETRY_EXPECTED(setsockopt(fd, IPPROTO_TCP, TCP_NOPUSH,
+                                      reinterpret_cast<char*>(&on),
+                                      sizeof(on))) == 0;
+}
+
 bool SocketBase::GetMulticastLoop(intptr_t fd,
                                   intptr_t protocol,
                                   bool* enabled) {
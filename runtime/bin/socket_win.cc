@@ -225,7 +225,11 @@ intptr_t Socket::CreateBindDatagram(const RawAddr& addr,
 
 intptr_t ServerSocket::CreateBindListen(const RawAddr& addr,
                                         intptr_t backlog,
-                                        bool v6_only) {
+                                        bool v6_only,
+                                        bool reuse_port) {
+  // SO_REUSEPORT does not balance accepts on this platform; shared listeners
+  // keep using a single file descriptor.
+  USE(reuse_port);
   SOCKET s = socket(addr.ss.ss_family, SOCK_STREAM, IPPROTO_TCP);
   if (s == INVALID_SOCKET) {
     return -1;
@@ -264,7 +268,7 @@ intptr_t ServerSocket::CreateBindListen(const RawAddr& addr,
        65535)) {
     // Don't close fd until we have created new. By doing that we ensure another
     // port.
-    intptr_t new_s = CreateBindListen(addr, backlog, v6_only);
+    intptr_t new_s = CreateBindListen(addr, backlog, v6_only, reuse_port);
     DWORD rc = WSAGetLastError();
     closesocket(s);
     listen_socket->Release();
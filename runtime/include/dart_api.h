@@ -1158,6 +1158,21 @@ DART_EXPORT void Dart_HintFreed(intptr_t size);
  */
 DART_EXPORT void Dart_NotifyIdle(int64_t deadline);
 
+/**
+ * Hints that the embedder expects the program to be idle until |deadline|,
+ * for example because its event loop is about to sleep until its next timer.
+ * Unlike Dart_NotifyIdle, no garbage collection work is performed right away:
+ * the VM uses the most recent hint to size the work it schedules whenever a
+ * mutator runs out of work. The hint is an upper bound; the VM may still be
+ * interrupted before the deadline.
+ *
+ * |deadline| is measured in microseconds against the system's monotonic time.
+ * This clock can be accessed via Dart_TimelineGetMicros().
+ *
+ * May be called from any thread, with or without a current isolate.
+ */
+DART_EXPORT void Dart_HintIdle(int64_t deadline);
+
 /**
  * Notifies the VM that the system is running low on memory.
  *
@@ -2585,6 +2600,44 @@ Dart_Invoke(Dart_Handle target,
             Dart_Handle* arguments);
 /* TODO(turnidge): Document how to invoke operators. */
 
+/**
+ * A single invocation in a Dart_InvokeBatch call.
+ *
+ * The target, name, number_of_arguments, and arguments fields have the same
+ * meaning as the corresponding parameters of Dart_Invoke. The result field
+ * is written by Dart_InvokeBatch.
+ */
+typedef struct {
+  Dart_Handle target;
+  Dart_Handle name;
+  int number_of_arguments;
+  Dart_Handle* arguments;
+  Dart_Handle result;
+} Dart_Invocation;
+
+/**
+ * Invokes a sequence of methods or functions.
+ *
+ * Equivalent to calling Dart_Invoke once per element of 'invocations' in
+ * order, but the thread transition and API scope setup are paid once for the
+ * whole batch rather than per call, which matters for embedders making many
+ * fine-grained calls. Each invocation's return value or error is stored in
+ * its result field. If an invocation fails because the isolate is shutting
+ * down, the remaining invocations do not run and their result fields are
+ * left unmodified.
+ *
+ * May generate unhandled exception errors in the result fields.
+ *
+ * \param number_of_invocations Size of the invocations array.
+ * \param invocations An array of invocations to execute.
+ *
+ * \return A valid handle if the batch was executed, even if individual
+ *   invocations failed. An error handle if the batch arguments were invalid
+ *   or the batch was cut short by isolate shutdown.
+ */
+DART_EXPORT DART_WARN_UNUSED_RESULT Dart_Handle
+Dart_InvokeBatch(intptr_t number_of_invocations, Dart_Invocation* invocations);
+
 /**
  * Invokes a Closure with the given arguments.
  *
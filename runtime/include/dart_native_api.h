@@ -152,6 +152,31 @@ DART_EXPORT Dart_Port Dart_NewNativePort(const char* name,
                                          bool handle_concurrently);
 /* TODO(turnidge): Currently handle_concurrently is ignored. */
 
+/**
+ * Creates a new native port whose handler runs directly on the thread that
+ * posts each message, skipping the VM thread pool. This removes a thread
+ * hop for trivial handlers such as high-rate completion callbacks.
+ *
+ * The handler must be reentrant-safe: it may run concurrently on any number
+ * of posting threads and must not assume a particular thread. It should do
+ * a small, bounded amount of work, since it runs on the poster's thread --
+ * possibly a Dart mutator thread. Delivery order between messages posted
+ * from different threads is unspecified.
+ *
+ * A message posted from inside a native message handler is always delivered
+ * through the thread pool, which bounds the work a single post performs
+ * inline.
+ *
+ * \param name The name of this port in debugging messages.
+ * \param handler The C handler to run when messages arrive on the port.
+ *
+ * \return If successful, returns the port id for the native port.  In
+ *   case of error, returns ILLEGAL_PORT.
+ */
+DART_EXPORT Dart_Port Dart_NewDirectNativePort(
+    const char* name,
+    Dart_NativeMessageHandler handler);
+
 /**
  * Closes the native port with the given id.
  *
@@ -163,6 +188,181 @@ DART_EXPORT Dart_Port Dart_NewNativePort(const char* name,
  */
 DART_EXPORT bool Dart_CloseNativePort(Dart_Port native_port_id);
 
+/*
+ * ==================
+ * CObject arenas
+ * ==================
+ */
+
+/**
+ * An opaque arena for building Dart_CObject message graphs.
+ *
+ * All nodes and buffers handed out by an arena are allocated with a bump
+ * pointer from larger blocks and stay valid until the arena is reset or
+ * destroyed; there is no per-node free. Callers posting many messages
+ * should build each message in the arena, call Dart_PostCObject, and then
+ * reset the arena, which retains the underlying blocks for reuse.
+ *
+ * An arena is not thread safe; use one arena per sending thread.
+ */
+typedef struct _Dart_CObjectArena Dart_CObjectArena;
+
+/**
+ * Creates an arena for building Dart_CObject messages.
+ *
+ * \param initial_capacity A hint, in bytes, for the first allocation block.
+ *   Values smaller than a minimum block size are rounded up.
+ *
+ * \return The new arena.
+ */
+DART_EXPORT Dart_CObjectArena* Dart_CreateCObjectArena(
+    intptr_t initial_capacity);
+
+/**
+ * Discards everything allocated from the arena but retains its blocks, so
+ * the next message can be built without going to malloc. All Dart_CObject
+ * pointers previously handed out by the arena are invalidated.
+ *
+ * \param arena An arena created by Dart_CreateCObjectArena.
+ */
+DART_EXPORT void Dart_ResetCObjectArena(Dart_CObjectArena* arena);
+
+/**
+ * Frees the arena and all memory allocated from it.
+ *
+ * \param arena An arena created by Dart_CreateCObjectArena.
+ */
+DART_EXPORT void Dart_DestroyCObjectArena(Dart_CObjectArena* arena);
+
+/**
+ * Allocates raw memory from the arena, aligned to 8 bytes. Useful for
+ * string payloads and other buffers referenced from Dart_CObject nodes.
+ *
+ * \param arena An arena created by Dart_CreateCObjectArena.
+ * \param size The number of bytes to allocate.
+ *
+ * \return The allocation, or NULL if size is negative.
+ */
+DART_EXPORT void* Dart_CObjectArenaAllocate(Dart_CObjectArena* arena,
+                                            intptr_t size);
+
+/**
+ * Allocates a single Dart_CObject node of the given type from the arena.
+ * The value union is zeroed; the caller fills it in.
+ *
+ * \param arena An arena created by Dart_CreateCObjectArena.
+ * \param type The type tag for the new node.
+ *
+ * \return The new node.
+ */
+DART_EXPORT Dart_CObject* Dart_CObjectArenaNewObject(Dart_CObjectArena* arena,
+                                                     Dart_CObject_Type type);
+
+/**
+ * Allocates a kArray node together with its values vector and 'length'
+ * element nodes in one arena allocation. Each element starts out as kNull
+ * and is mutated in place by the caller, so a message with N fields costs
+ * one allocation instead of N+1 mallocs.
+ *
+ * \param arena An arena created by Dart_CreateCObjectArena.
+ * \param length The number of elements.
+ *
+ * \return The array node, or NULL if length is negative.
+ */
+DART_EXPORT Dart_CObject* Dart_CObjectArenaNewArray(Dart_CObjectArena* arena,
+                                                    intptr_t length);
+
+/**
+ * Allocates a kTypedData node together with its data block, the flat
+ * encoding for a homogeneous array: one header plus raw bytes, which the
+ * receiving isolate turns into a typed data list without per-element
+ * dispatch. The caller copies its data into the values pointer of the
+ * returned node.
+ *
+ * \param arena An arena created by Dart_CreateCObjectArena.
+ * \param type The element type from dart:typed_data.
+ * \param length_in_bytes The size of the data block in bytes; must be a
+ *   multiple of the element size.
+ *
+ * \return The typed data node, or NULL if length_in_bytes is negative.
+ */
+DART_EXPORT Dart_CObject* Dart_CObjectArenaNewTypedData(
+    Dart_CObjectArena* arena,
+    Dart_TypedData_Type type,
+    intptr_t length_in_bytes);
+
+/*
+ * ==================
+ * Shared buffer rings
+ * ==================
+ */
+
+/**
+ * An opaque, reference counted buffer that can be mapped into multiple
+ * isolates of the same process as external typed data. Intended for
+ * single-producer/single-consumer streams (e.g. high-rate telemetry) that
+ * would otherwise pay message serialization per datum.
+ *
+ * The buffer has a fixed layout so producer and consumer can implement a
+ * lock-free ring on top of it, from Dart or from native code:
+ *
+ *   [DART_SHARED_RING_READ_OFFSET, +8)   free-running read index
+ *   [DART_SHARED_RING_WRITE_OFFSET, +8)  free-running write index
+ *   [DART_SHARED_RING_DATA_OFFSET, +capacity)  data
+ *
+ * Only the consumer writes the read index and only the producer writes the
+ * write index; each index lives on its own cache line. Both indices are
+ * little-endian 64-bit values and are taken modulo the capacity when
+ * addressing data, so a power-of-two capacity is recommended. The VM itself
+ * performs no synchronization on the region; the usual single-producer/
+ * single-consumer ordering discipline applies.
+ */
+typedef struct _Dart_SharedRing Dart_SharedRing;
+
+#define DART_SHARED_RING_READ_OFFSET (0)
+#define DART_SHARED_RING_WRITE_OFFSET (64)
+#define DART_SHARED_RING_DATA_OFFSET (128)
+
+/**
+ * Creates a shared ring with space for `capacity` data bytes. The region,
+ * including both indices, is zero-initialized.
+ *
+ * This function may be called on any thread and does not require a current
+ * isolate.
+ *
+ * \param capacity The number of data bytes. Must be positive.
+ *
+ * \return The ring, with one reference owned by the caller, or NULL if
+ *   capacity is invalid or allocation failed.
+ */
+DART_EXPORT Dart_SharedRing* Dart_CreateSharedRing(intptr_t capacity);
+
+/**
+ * Returns an external Uint8List covering the ring's region, including the
+ * index words, backed by the same memory in every isolate it is created in.
+ *
+ * The list holds a reference to the ring which is released when the list is
+ * garbage collected, so the region stays valid for as long as any view or
+ * the creator's reference exists.
+ *
+ * Requires a current isolate and scope.
+ *
+ * \param ring The ring to view.
+ *
+ * \return The Uint8List view, or an error handle.
+ */
+DART_EXPORT Dart_Handle Dart_SharedRingView(Dart_SharedRing* ring);
+
+/**
+ * Releases a reference to the ring. The region is freed once the last
+ * reference, whether held by the embedder or by a view, is gone.
+ *
+ * This function may be called on any thread.
+ *
+ * \param ring The ring to release.
+ */
+DART_EXPORT void Dart_ReleaseSharedRing(Dart_SharedRing* ring);
+
 /*
  * ==================
  * Verification Tools
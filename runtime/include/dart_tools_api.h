@@ -495,5 +495,27 @@ DART_EXPORT int64_t
 Dart_IsolateRunnableLatencyMetric(Dart_Isolate isolate);  // Microsecond
 DART_EXPORT int64_t
 Dart_IsolateRunnableHeapSizeMetric(Dart_Isolate isolate);  // Byte
+DART_EXPORT int64_t
+Dart_IsolateTimeToSafepointMetric(Dart_Isolate isolate);  // Microsecond
+DART_EXPORT int64_t
+Dart_IsolateGcPauseTimeMetric(Dart_Isolate isolate);  // Microsecond
+
+/**
+ * Return one bucket of a histogram metric.
+ *
+ * The time metrics above aggregate every recorded duration into a histogram
+ * of 16 power-of-two buckets: bucket 0 counts durations of at most one
+ * microsecond, bucket i counts durations between 2^(i-1) and 2^i microseconds
+ * (inclusive), and the last bucket counts all larger durations. The metric
+ * functions without a bucket argument return the sum of all recorded
+ * durations.
+ *
+ * Returns -1 if bucket is out of range.
+ */
+DART_EXPORT int64_t
+Dart_IsolateTimeToSafepointHistogramMetric(Dart_Isolate isolate,
+                                           intptr_t bucket);
+DART_EXPORT int64_t Dart_IsolateGcPauseTimeHistogramMetric(Dart_Isolate isolate,
+                                                           intptr_t bucket);
 
 #endif  // RUNTIME_INCLUDE_DART_TOOLS_API_H_
@@ -50,6 +50,19 @@ DEFINE_NATIVE_ENTRY(GrowableList_setIndexed, 0, 3) {
   return Object::null();
 }
 
+DEFINE_NATIVE_ENTRY(GrowableList_grow, 0, 2) {
+  const GrowableObjectArray& array =
+      GrowableObjectArray::CheckedHandle(zone, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, new_capacity, arguments->NativeArgAt(1));
+  if ((new_capacity.Value() <= array.Capacity()) ||
+      (new_capacity.Value() > Array::kMaxElements)) {
+    Exceptions::ThrowRangeError("new_capacity", new_capacity,
+                                array.Capacity() + 1, Array::kMaxElements);
+  }
+  array.Grow(new_capacity.Value());
+  return Object::null();
+}
+
 DEFINE_NATIVE_ENTRY(GrowableList_getLength, 0, 1) {
   const GrowableObjectArray& array =
       GrowableObjectArray::CheckedHandle(zone, arguments->NativeArgAt(0));
@@ -99,6 +99,75 @@ DEFINE_NATIVE_ENTRY(SendPortImpl_get_hashcode, 0, 1) {
   return Smi::New(hash);
 }
 
+// Returns true if the object graph rooted in 'obj' consists only of deeply
+// immutable objects: canonical instances, strings, numbers, send ports,
+// capabilities and immutable arrays thereof. Isolates in a group share a
+// heap, so such a graph can be delivered to a receiver in the same group by
+// reference - neither side can observe that the copy was elided.
+static bool IsDeeplyImmutableMessage(Isolate* isolate, const Object& obj) {
+  class ImmutabilityVisitor : public ObjectPointerVisitor {
+   public:
+    ImmutabilityVisitor(IsolateGroup* isolate_group,
+                        WeakTable* visited,
+                        MallocGrowableArray<ObjectPtr>* const working_set)
+        : ObjectPointerVisitor(isolate_group),
+          visited_(visited),
+          working_set_(working_set) {}
+
+   private:
+    void VisitPointers(ObjectPtr* from, ObjectPtr* to) {
+      for (ObjectPtr* raw = from; raw <= to; raw++) {
+        if (!(*raw)->IsHeapObject() || (*raw)->ptr()->IsCanonical()) {
+          continue;
+        }
+        if (visited_->GetValueExclusive(*raw) == 1) {
+          continue;
+        }
+        visited_->SetValueExclusive(*raw, 1);
+        working_set_->Add(*raw);
+      }
+    }
+
+    WeakTable* visited_;
+    MallocGrowableArray<ObjectPtr>* const working_set_;
+  };
+  if (!obj.raw()->IsHeapObject() || obj.raw()->ptr()->IsCanonical()) {
+    return true;
+  }
+
+  NoSafepointScope no_safepoint;
+  MallocGrowableArray<ObjectPtr> working_set;
+  std::unique_ptr<WeakTable> visited(new WeakTable());
+
+  ImmutabilityVisitor visitor(isolate->group(), visited.get(), &working_set);
+
+  visited->SetValueExclusive(obj.raw(), 1);
+  working_set.Add(obj.raw());
+
+  while (!working_set.is_empty()) {
+    ObjectPtr raw = working_set.RemoveLast();
+
+    switch (raw->GetClassId()) {
+      case kOneByteStringCid:
+      case kTwoByteStringCid:
+        // Strings may still compute their hash lazily, but racing stores of
+        // the same value are benign.
+      case kMintCid:
+      case kDoubleCid:
+      case kSendPortCid:
+      case kCapabilityCid:
+        // Leaf objects whose contents never change after construction.
+        break;
+      case kImmutableArrayCid:
+        raw->ptr()->VisitPointers(&visitor);
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
 DEFINE_NATIVE_ENTRY(SendPortImpl_sendInternal_, 0, 2) {
   GET_NON_NULL_NATIVE_ARGUMENT(SendPort, port, arguments->NativeArgAt(0));
   // TODO(iposva): Allow for arbitrary messages to be sent.
@@ -110,6 +179,17 @@ DEFINE_NATIVE_ENTRY(SendPortImpl_sendInternal_, 0, 2) {
   if (ApiObjectConverter::CanConvert(obj.raw())) {
     PortMap::PostMessage(
         Message::New(destination_port_id, obj.raw(), Message::kNormalPriority));
+  } else if (PortMap::IsReceiverInThisIsolateGroup(destination_port_id,
+                                                   isolate->group()) &&
+             IsDeeplyImmutableMessage(isolate, obj)) {
+    // Pass the message along by reference instead of copying it through a
+    // snapshot, rooted in a persistent handle like sendAndExit does.
+    PersistentHandle* handle =
+        isolate->group()->api_state()->AllocatePersistentHandle();
+    handle->set_raw(obj);
+    PortMap::PostMessage(Message::New(destination_port_id,
+                                      new Bequest(handle, destination_port_id),
+                                      Message::kNormalPriority));
   } else {
     MessageWriter writer(can_send_any_object);
     // TODO(turnidge): Throw an exception when the return value is false?
@@ -320,7 +400,11 @@ class SpawnIsolateTask : public ThreadPool::Task {
     ASSERT(name != nullptr);
 
     auto group = state_->isolate_group();
-    if (!FLAG_enable_isolate_groups || group == nullptr) {
+    if (!FLAG_enable_isolate_groups || group == nullptr ||
+        Isolate::InitializeCallback() == nullptr) {
+      // Spawning within an existing group requires the embedder to provide an
+      // initialize callback. Fall back to a full isolate group creation if it
+      // did not.
       RunHeavyweight(name);
     } else {
       RunLightweight(name);
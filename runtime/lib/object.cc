@@ -59,6 +59,30 @@ DEFINE_NATIVE_ENTRY(Object_setHash, 0, 2) {
   return Object::null();
 }
 
+// Draws a random identity hash for the given object and installs it,
+// returning the installed value. Combining the draw and the store in one
+// native call keeps hashCode on fresh objects down to a single transition
+// out of generated code.
+DEFINE_NATIVE_ENTRY(Object_createHash, 0, 1) {
+  // The hash must be a Smi value greater than 0.
+  uint32_t hash;
+  do {
+    hash = isolate->random()->NextUInt32() & 0x3fffffff;
+  } while (hash == 0);
+#if defined(HASH_IN_OBJECT_HEADER)
+  // No handle is created for the argument: it is only read again before any
+  // allocation can move it.
+  Object::SetCachedHash(arguments->NativeArgAt(0), hash);
+  return Smi::New(Object::GetCachedHash(arguments->NativeArgAt(0)));
+#else
+  const Instance& instance =
+      Instance::CheckedHandle(zone, arguments->NativeArgAt(0));
+  Heap* heap = isolate->heap();
+  heap->SetHash(instance.raw(), hash);
+  return Smi::New(heap->GetHash(instance.raw()));
+#endif
+}
+
 DEFINE_NATIVE_ENTRY(Object_toString, 0, 1) {
   const Instance& instance =
       Instance::CheckedHandle(zone, arguments->NativeArgAt(0));
@@ -42,23 +42,37 @@ static StackTracePtr CurrentSyncStackTraceLazy(Thread* thread,
 static StackTracePtr CurrentSyncStackTrace(Thread* thread,
                                            intptr_t skip_frames = 1) {
   Zone* zone = thread->zone();
-  const Function& null_function = Function::ZoneHandle(zone);
 
-  // Determine how big the stack trace is.
-  const intptr_t stack_trace_length =
-      StackTraceUtils::CountFrames(thread, skip_frames, null_function, nullptr);
+  // Walk the stack once, capturing each frame as a zone handle plus offset.
+  // The frames cannot be captured as raw pcs: the arrays allocated below can
+  // trigger a collection, and the collector may move Code objects.
+  GrowableArray<const Code*> codes(kDefaultStackAllocation);
+  GrowableArray<uword> offsets(kDefaultStackAllocation);
+  DartFrameIterator frames(thread, StackFrameIterator::kNoCrossThreadIteration);
+  StackFrame* frame = frames.NextFrame();
+  ASSERT(frame != nullptr);  // We expect to find a dart invocation frame.
+  for (; frame != nullptr; frame = frames.NextFrame()) {
+    if (skip_frames > 0) {
+      skip_frames--;
+      continue;
+    }
+    const Code& code = Code::ZoneHandle(zone, frame->LookupDartCode());
+    codes.Add(&code);
+    offsets.Add(frame->pc() - code.PayloadStart());
+  }
 
-  // Allocate once.
+  // Allocate once per array and fill in the frames.
+  const intptr_t stack_trace_length = codes.length();
   const Array& code_array =
       Array::ZoneHandle(zone, Array::New(stack_trace_length));
   const Array& pc_offset_array =
       Array::ZoneHandle(zone, Array::New(stack_trace_length));
-
-  // Collect the frames.
-  const intptr_t collected_frames_count = StackTraceUtils::CollectFrames(
-      thread, code_array, pc_offset_array, 0, stack_trace_length, skip_frames);
-
-  ASSERT(collected_frames_count == stack_trace_length);
+  Smi& offset = Smi::Handle(zone);
+  for (intptr_t i = 0; i < stack_trace_length; i++) {
+    offset = Smi::New(offsets[i]);
+    code_array.SetAt(i, *codes[i]);
+    pc_offset_array.SetAt(i, offset);
+  }
 
   return StackTrace::New(code_array, pc_offset_array);
 }
@@ -100,27 +100,6 @@ DEFINE_NATIVE_ENTRY(StringBase_substringUnchecked, 0, 3) {
   return String::SubString(receiver, start, (end - start));
 }
 
-// Return the bitwise-or of all characters in the slice from start to end.
-static uint16_t CharacterLimit(const String& string,
-                               intptr_t start,
-                               intptr_t end) {
-  ASSERT(string.IsTwoByteString() || string.IsExternalTwoByteString());
-  // Maybe do loop unrolling, and handle two uint16_t in a single uint32_t
-  // operation.
-  NoSafepointScope no_safepoint;
-  uint16_t result = 0;
-  if (string.IsTwoByteString()) {
-    for (intptr_t i = start; i < end; i++) {
-      result |= TwoByteString::CharAt(string, i);
-    }
-  } else {
-    for (intptr_t i = start; i < end; i++) {
-      result |= ExternalTwoByteString::CharAt(string, i);
-    }
-  }
-  return result;
-}
-
 static const intptr_t kLengthSize = 11;
 static const intptr_t kLengthMask = (1 << kLengthSize) - 1;
 
@@ -151,7 +130,8 @@ static bool CheckSlicesOneByte(const String& base,
         }
         slice_end = Smi::Cast(object).Value();
       }
-      uint16_t char_limit = CharacterLimit(base, slice_start, slice_end);
+      uint16_t char_limit =
+          String::CodeUnitLimit(base, slice_start, slice_end);
       if (char_limit > 0xff) {
         return false;
       }
@@ -177,6 +177,43 @@ DEFINE_NATIVE_ENTRY(TypedData_setRange, 0, 7) {
   return Bool::False().raw();
 }
 
+// Fills a contiguous byte range of a typed data object with a byte value.
+DEFINE_NATIVE_ENTRY(TypedData_fillRange, 0, 4) {
+  const Instance& dst =
+      Instance::CheckedHandle(zone, arguments->NativeArgAt(0));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, dst_start, arguments->NativeArgAt(1));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, length, arguments->NativeArgAt(2));
+  GET_NON_NULL_NATIVE_ARGUMENT(Smi, value, arguments->NativeArgAt(3));
+
+  if (length.Value() < 0) {
+    const String& error = String::Handle(String::NewFormatted(
+        "length (%" Pd ") must be non-negative", length.Value()));
+    Exceptions::ThrowArgumentError(error);
+  }
+  const intptr_t offset_in_bytes = dst_start.Value();
+  const intptr_t length_in_bytes = length.Value();
+  const intptr_t byte_value = value.Value();
+  ASSERT((byte_value >= 0) && (byte_value <= 0xff));
+
+  if (dst.IsTypedData()) {
+    const TypedData& dst_array = TypedData::Cast(dst);
+    ASSERT(Utils::RangeCheck(offset_in_bytes, length_in_bytes,
+                             dst_array.LengthInBytes()));
+    NoSafepointScope no_safepoint;
+    memset(dst_array.DataAddr(offset_in_bytes), byte_value, length_in_bytes);
+    return Object::null();
+  } else if (dst.IsExternalTypedData()) {
+    const ExternalTypedData& dst_array = ExternalTypedData::Cast(dst);
+    ASSERT(Utils::RangeCheck(offset_in_bytes, length_in_bytes,
+                             dst_array.LengthInBytes()));
+    NoSafepointScope no_safepoint;
+    memset(dst_array.DataAddr(offset_in_bytes), byte_value, length_in_bytes);
+    return Object::null();
+  }
+  UNREACHABLE();
+  return Object::null();
+}
+
 // Native methods for typed data allocation are recognized and implemented
 // in FlowGraphBuilder::BuildGraphOfRecognizedMethod.
 // These bodies exist only to assert that they are not used.
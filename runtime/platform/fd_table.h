@@ -0,0 +1,97 @@
+// Copyright (c) 2026, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+
+#ifndef RUNTIME_PLATFORM_FD_TABLE_H_
+#define RUNTIME_PLATFORM_FD_TABLE_H_
+
+#include "platform/allocation.h"
+#include "platform/assert.h"
+#include "platform/globals.h"
+
+namespace dart {
+
+// FdTable maps small non-negative integer keys - typically file descriptors,
+// which the OS hands out densely starting from zero - to pointers. Lookup is
+// a bounds check and an indexed load, so unlike a hash map it never probes,
+// never rehashes, and does not mutate the table on reads. The table grows to
+// the largest key inserted, at one pointer per possible key, which is cheap
+// for the dense keys it is meant for.
+template <typename T>
+class FdTable {
+ public:
+  // initial_capacity is the number of keys covered without growing;
+  // it must be greater than 0.
+  explicit FdTable(intptr_t initial_capacity) : capacity_(initial_capacity) {
+    ASSERT(initial_capacity > 0);
+    entries_ = reinterpret_cast<T**>(calloc(capacity_, sizeof(T*)));
+    if (entries_ == NULL) {
+      OUT_OF_MEMORY();
+    }
+  }
+
+  ~FdTable() { free(entries_); }
+
+  // Returns the value for the given key, or NULL if none was inserted.
+  T* Lookup(intptr_t fd) const {
+    ASSERT(fd >= 0);
+    return (fd < capacity_) ? entries_[fd] : NULL;
+  }
+
+  // Inserts a value for the given key, replacing any previous value.
+  void Insert(intptr_t fd, T* value) {
+    ASSERT(fd >= 0);
+    if (fd >= capacity_) {
+      Grow(fd + 1);
+    }
+    entries_[fd] = value;
+  }
+
+  // Removes the value for the given key, returning it (or NULL if none
+  // was inserted).
+  T* Remove(intptr_t fd) {
+    ASSERT(fd >= 0);
+    if (fd >= capacity_) {
+      return NULL;
+    }
+    T* value = entries_[fd];
+    entries_[fd] = NULL;
+    return value;
+  }
+
+  // Invokes the callback for every inserted value and empties the table.
+  void Clear(void (*free_value)(T* value)) {
+    for (intptr_t fd = 0; fd < capacity_; fd++) {
+      if (entries_[fd] != NULL) {
+        free_value(entries_[fd]);
+        entries_[fd] = NULL;
+      }
+    }
+  }
+
+ private:
+  void Grow(intptr_t minimum_capacity) {
+    intptr_t new_capacity = capacity_;
+    while (new_capacity < minimum_capacity) {
+      new_capacity *= 2;
+    }
+    T** new_entries =
+        reinterpret_cast<T**>(realloc(entries_, new_capacity * sizeof(T*)));
+    if (new_entries == NULL) {
+      OUT_OF_MEMORY();
+    }
+    memset(new_entries + capacity_, 0,
+           (new_capacity - capacity_) * sizeof(T*));
+    entries_ = new_entries;
+    capacity_ = new_capacity;
+  }
+
+  T** entries_;
+  intptr_t capacity_;
+
+  DISALLOW_COPY_AND_ASSIGN(FdTable);
+};
+
+}  // namespace dart
+
+#endif  // RUNTIME_PLATFORM_FD_TABLE_H_
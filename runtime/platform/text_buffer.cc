@@ -137,7 +137,15 @@ char* TextBuffer::Steal() {
 bool TextBuffer::EnsureCapacity(intptr_t len) {
   intptr_t remaining = capacity_ - length_;
   if (remaining <= len) {
-    intptr_t new_size = capacity_ + Utils::Maximum(capacity_, len + 1);
+    // Grow by doubling, but once the buffer is large - as it gets for big
+    // service responses - switch to a smaller geometric factor. This bounds
+    // how far the capacity can overshoot the final length while keeping the
+    // total copying done by realloc linear in the final length; a fixed
+    // increment would make it quadratic.
+    const intptr_t kLargeBufferThreshold = 16 * MB;
+    intptr_t growth =
+        capacity_ < kLargeBufferThreshold ? capacity_ : capacity_ / 4;
+    intptr_t new_size = capacity_ + Utils::Maximum(growth, len + 1);
     char* new_buf = reinterpret_cast<char*>(realloc(buffer_, new_size));
     if (new_buf == nullptr) {
       OUT_OF_MEMORY();
@@ -40,6 +40,44 @@ const uint32_t Utf8::kOverlongMinimum[7] = {0,  // Padding.
                                             0x0,     0x80,       0x800,
                                             0x10000, 0xFFFFFFFF, 0xFFFFFFFF};
 
+// A constant mask that can be 'and'ed with a word of data to determine if it
+// is all ASCII (with no Latin1 characters).
+#if defined(ARCH_IS_64_BIT)
+static const uintptr_t kAsciiWordMask = DART_UINT64_C(0x8080808080808080);
+#else
+static const uintptr_t kAsciiWordMask = 0x80808080u;
+#endif
+
+// Returns the length of the run of ASCII bytes at the start of 'utf8_array'.
+// ASCII bytes decode to themselves in every output encoding, so callers can
+// process the run in bulk and reserve the byte-at-a-time paths for the
+// multibyte sequences this scan stopped at.
+static intptr_t AsciiRunLength(const uint8_t* utf8_array, intptr_t array_len) {
+  intptr_t i = 0;
+  // Scan byte-by-byte until the input is word aligned.
+  while ((i < array_len) &&
+         ((reinterpret_cast<uintptr_t>(&utf8_array[i]) &
+           (sizeof(uintptr_t) - 1)) != 0)) {
+    if (utf8_array[i] > Utf8::kMaxOneByteChar) {
+      return i;
+    }
+    i++;
+  }
+  // Check a word of input at a time.
+  while ((i + static_cast<intptr_t>(sizeof(uintptr_t))) <= array_len) {
+    uintptr_t chunk = *reinterpret_cast<const uintptr_t*>(&utf8_array[i]);
+    if ((chunk & kAsciiWordMask) != 0) {
+      break;
+    }
+    i += sizeof(uintptr_t);
+  }
+  // Take care of the tail of the run.
+  while ((i < array_len) && (utf8_array[i] <= Utf8::kMaxOneByteChar)) {
+    i++;
+  }
+  return i;
+}
+
 // Returns the most restricted coding form in which the sequence of utf8
 // characters in 'utf8_array' can be represented in, and the number of
 // code units needed in that form.
@@ -48,7 +86,15 @@ intptr_t Utf8::CodeUnitCount(const uint8_t* utf8_array,
                              Type* type) {
   intptr_t len = 0;
   Type char_type = kLatin1;
-  for (intptr_t i = 0; i < array_len; i++) {
+  intptr_t i = 0;
+  while (i < array_len) {
+    // ASCII characters are one code unit each and leave the type unchanged.
+    const intptr_t ascii_run = AsciiRunLength(&utf8_array[i], array_len - i);
+    if (ascii_run > 0) {
+      len += ascii_run;
+      i += ascii_run;
+      continue;
+    }
     uint8_t code_unit = utf8_array[i];
     if (!IsTrailByte(code_unit)) {
       ++len;
@@ -61,6 +107,7 @@ intptr_t Utf8::CodeUnitCount(const uint8_t* utf8_array,
         }
       }
     }
+    i++;
   }
   *type = char_type;
   return len;
@@ -70,6 +117,12 @@ intptr_t Utf8::CodeUnitCount(const uint8_t* utf8_array,
 bool Utf8::IsValid(const uint8_t* utf8_array, intptr_t array_len) {
   intptr_t i = 0;
   while (i < array_len) {
+    // ASCII runs need no validation beyond the scan itself.
+    const intptr_t ascii_run = AsciiRunLength(&utf8_array[i], array_len - i);
+    if (ascii_run > 0) {
+      i += ascii_run;
+      continue;
+    }
     uint32_t ch = utf8_array[i] & 0xFF;
     intptr_t j = 1;
     if (ch >= 0x80) {
@@ -197,16 +250,30 @@ bool Utf8::DecodeToLatin1(const uint8_t* utf8_array,
                           intptr_t len) {
   intptr_t i = 0;
   intptr_t j = 0;
-  intptr_t num_bytes;
-  for (; (i < array_len) && (j < len); i += num_bytes, ++j) {
+  while ((i < array_len) && (j < len)) {
+    // ASCII runs decode to themselves: copy them in bulk.
+    intptr_t run_limit = array_len - i;
+    if (run_limit > (len - j)) {
+      run_limit = len - j;
+    }
+    const intptr_t ascii_run = AsciiRunLength(&utf8_array[i], run_limit);
+    if (ascii_run > 0) {
+      memmove(&dst[j], &utf8_array[i], ascii_run);
+      i += ascii_run;
+      j += ascii_run;
+      continue;
+    }
     int32_t ch;
     ASSERT(IsLatin1SequenceStart(utf8_array[i]));
-    num_bytes = Utf8::Decode(&utf8_array[i], (array_len - i), &ch);
+    const intptr_t num_bytes =
+        Utf8::Decode(&utf8_array[i], (array_len - i), &ch);
     if (ch == -1) {
       return false;  // Invalid input.
     }
     ASSERT(Utf::IsLatin1(ch));
     dst[j] = ch;
+    i += num_bytes;
+    ++j;
   }
   if ((i < array_len) && (j == len)) {
     return false;  // Output overflow.
@@ -220,11 +287,25 @@ bool Utf8::DecodeToUTF16(const uint8_t* utf8_array,
                          intptr_t len) {
   intptr_t i = 0;
   intptr_t j = 0;
-  intptr_t num_bytes;
-  for (; (i < array_len) && (j < len); i += num_bytes, ++j) {
+  while ((i < array_len) && (j < len)) {
+    // ASCII runs decode to themselves: widen them in bulk.
+    intptr_t run_limit = array_len - i;
+    if (run_limit > (len - j)) {
+      run_limit = len - j;
+    }
+    const intptr_t ascii_run = AsciiRunLength(&utf8_array[i], run_limit);
+    if (ascii_run > 0) {
+      for (intptr_t k = 0; k < ascii_run; k++) {
+        dst[j + k] = utf8_array[i + k];
+      }
+      i += ascii_run;
+      j += ascii_run;
+      continue;
+    }
     int32_t ch;
     bool is_supplementary = IsSupplementarySequenceStart(utf8_array[i]);
-    num_bytes = Utf8::Decode(&utf8_array[i], (array_len - i), &ch);
+    const intptr_t num_bytes =
+        Utf8::Decode(&utf8_array[i], (array_len - i), &ch);
     if (ch == -1) {
       return false;  // Invalid input.
     }
@@ -235,6 +316,8 @@ bool Utf8::DecodeToUTF16(const uint8_t* utf8_array,
     } else {
       dst[j] = ch;
     }
+    i += num_bytes;
+    ++j;
   }
   if ((i < array_len) && (j == len)) {
     return false;  // Output overflow.
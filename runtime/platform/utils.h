@@ -387,6 +387,15 @@ class Utils {
     return ((mask >> position) & 1) != 0;
   }
 
+  // Hints to the CPU that the memory at the given address is likely to be
+  // accessed soon, to hide the cache miss behind other work. This is only a
+  // hint; it is a no-op on compilers without a prefetch intrinsic.
+  DART_FORCE_INLINE static void Prefetch(const void* addr) {
+#if defined(__GNUC__)
+    __builtin_prefetch(addr);
+#endif
+  }
+
   static char* StrError(int err, char* buffer, size_t bufsize);
 
   // Not all platforms support strndup.
@@ -50,7 +50,27 @@ uint8_t* DecodeBase64(const char* str, intptr_t* out_decoded_len) {
   intptr_t decoded_en = ((len * 6) >> 3) - pad_length;
   uint8_t* bytes = static_cast<uint8_t*>(malloc(decoded_en));
 
-  for (int i = 0, o = 0; o < decoded_en;) {
+  intptr_t i = 0;
+  intptr_t o = 0;
+  while (o < decoded_en) {
+    // Fast path: four alphabet characters decode straight into three output
+    // bytes. Groups containing padding, line breaks or anything else fall
+    // through to the character-at-a-time loop below.
+    if ((o + 3 <= decoded_en) && (i + 4 <= len)) {
+      const int c0 = decode_table[(uint8_t)str[i]];
+      const int c1 = decode_table[(uint8_t)str[i + 1]];
+      const int c2 = decode_table[(uint8_t)str[i + 2]];
+      const int c3 = decode_table[(uint8_t)str[i + 3]];
+      if (((c0 | c1 | c2 | c3) >= 0) && (str[i] != PAD) &&
+          (str[i + 1] != PAD) && (str[i + 2] != PAD) && (str[i + 3] != PAD)) {
+        const int x = (c0 << 18) | (c1 << 12) | (c2 << 6) | c3;
+        bytes[o++] = x >> 16;
+        bytes[o++] = (x >> 8) & 0xFF;
+        bytes[o++] = x & 0xFF;
+        i += 4;
+        continue;
+      }
+    }
     // Accumulate 4 valid 6 bit Base 64 characters into an int.
     int x = 0;
     for (int j = 4; j > 0;) {
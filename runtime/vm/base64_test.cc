@@ -19,6 +19,18 @@ TEST_CASE(Base64Decode) {
   free(decoded_bytes);
 }
 
+TEST_CASE(Base64DecodeMultiBlock) {
+  intptr_t decoded_len;
+  uint8_t* decoded_bytes = DecodeBase64(
+      "VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IGRvZy4=",
+      &decoded_len);
+  const char expected_bytes[] = "The quick brown fox jumps over the lazy dog.";
+  intptr_t expected_len = strlen(expected_bytes);
+  EXPECT(!memcmp(expected_bytes, decoded_bytes, expected_len));
+  EXPECT_EQ(expected_len, decoded_len);
+  free(decoded_bytes);
+}
+
 TEST_CASE(Base64DecodeMalformed) {
   intptr_t decoded_len;
   EXPECT(DecodeBase64("SomethingMalformed", &decoded_len) == nullptr);
@@ -15,10 +15,13 @@
 #include "platform/globals.h"
 #include "platform/utils.h"
 
+#include "vm/base64.h"
 #include "vm/clustered_snapshot.h"
 #include "vm/dart_api_impl.h"
 #include "vm/datastream.h"
+#include "vm/heap/heap.h"
 #include "vm/stack_frame.h"
+#include "vm/symbols.h"
 #include "vm/timer.h"
 
 using dart::bin::File;
@@ -242,6 +245,36 @@ BENCHMARK(DartStringAccess) {
   benchmark->set_score(elapsed_time);
 }
 
+//
+// Measure decoding of a large base64 payload.
+//
+BENCHMARK(Base64Decode) {
+  const intptr_t kBlocks = 256 * 1024;
+  // "Hello, world!!!" encodes to a padding-free group of base64 characters,
+  // so repeating it yields one large well-formed input.
+  const char* kBlockChars = "SGVsbG8sIHdvcmxkISEh";
+  const intptr_t block_len = strlen(kBlockChars);
+  char* input = reinterpret_cast<char*>(malloc(kBlocks * block_len + 1));
+  for (intptr_t i = 0; i < kBlocks; i++) {
+    memmove(input + i * block_len, kBlockChars, block_len);
+  }
+  input[kBlocks * block_len] = '\0';
+
+  Timer timer(true, "Base64 decode benchmark");
+  timer.Start();
+  for (intptr_t i = 0; i < 10; i++) {
+    intptr_t decoded_len;
+    uint8_t* decoded = DecodeBase64(input, &decoded_len);
+    EXPECT(decoded != nullptr);
+    EXPECT_EQ(kBlocks * 15, decoded_len);
+    free(decoded);
+  }
+  timer.Stop();
+  free(input);
+  int64_t elapsed_time = timer.TotalElapsedTime();
+  benchmark->set_score(elapsed_time);
+}
+
 static void vmservice_resolver(Dart_NativeArguments args) {}
 
 static Dart_NativeFunction NativeResolver(Dart_Handle name,
@@ -613,6 +646,137 @@ BENCHMARK(LargeMap) {
   benchmark->set_score(elapsed_time);
 }
 
+//
+// Measure scavenge time with a live graph of small objects in new space.
+//
+BENCHMARK(ScavengeLiveGraph) {
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  HANDLESCOPE(thread);
+  const intptr_t kWidth = 1024;
+  const intptr_t kLinks = 16;
+  const Array& root = Array::Handle(Array::New(kWidth));
+  Array& chain = Array::Handle();
+  Array& next = Array::Handle();
+  const intptr_t kLoopCount = 50;
+  Timer timer(true, "Scavenge live graph benchmark");
+  timer.Start();
+  for (intptr_t i = 0; i < kLoopCount; i++) {
+    // Rebuild the graph each iteration so every scavenge copies a comparable
+    // amount of newly allocated, still reachable data and abandons the
+    // previous iteration's graph as garbage.
+    for (intptr_t j = 0; j < kWidth; j++) {
+      chain = Array::New(1);
+      for (intptr_t k = 1; k < kLinks; k++) {
+        next = Array::New(1);
+        next.SetAt(0, chain);
+        chain = next.raw();
+      }
+      root.SetAt(j, chain);
+    }
+    thread->heap()->CollectGarbage(Heap::kNew);
+  }
+  timer.Stop();
+  benchmark->set_score(timer.TotalElapsedTime());
+}
+
+//
+// Measure mark-sweep time over an old-space graph with cross links.
+//
+BENCHMARK(MarkSweepLiveGraph) {
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  HANDLESCOPE(thread);
+  const intptr_t kNodes = 100000;
+  const intptr_t kEdges = 4;
+  const Array& nodes = Array::Handle(Array::New(kNodes, Heap::kOld));
+  Array& node = Array::Handle();
+  Object& neighbor = Object::Handle();
+  for (intptr_t i = 0; i < kNodes; i++) {
+    node = Array::New(kEdges, Heap::kOld);
+    nodes.SetAt(i, node);
+  }
+  for (intptr_t i = 0; i < kNodes; i++) {
+    node ^= nodes.At(i);
+    for (intptr_t j = 0; j < kEdges; j++) {
+      neighbor = nodes.At((i * 31 + j * 1009) % kNodes);
+      node.SetAt(j, neighbor);
+    }
+  }
+  const intptr_t kLoopCount = 10;
+  Timer timer(true, "MarkSweep live graph benchmark");
+  timer.Start();
+  for (intptr_t i = 0; i < kLoopCount; i++) {
+    thread->heap()->CollectGarbage(Heap::kOld);
+  }
+  timer.Stop();
+  benchmark->set_score(timer.TotalElapsedTime());
+}
+
+static int64_t MessageRoundTrip(Thread* thread,
+                                intptr_t length,
+                                intptr_t loop_count) {
+  const Array& list = Array::Handle(Array::New(length));
+  Smi& element = Smi::Handle();
+  for (intptr_t i = 0; i < length; i++) {
+    element = Smi::New(i);
+    list.SetAt(i, element);
+  }
+  Timer timer(true, "Message round-trip benchmark");
+  timer.Start();
+  for (intptr_t i = 0; i < loop_count; i++) {
+    StackZone zone(thread);
+    MessageWriter writer(true);
+    std::unique_ptr<Message> message =
+        writer.WriteMessage(list, ILLEGAL_PORT, Message::kNormalPriority);
+
+    // Read object back from the snapshot.
+    MessageSnapshotReader reader(message.get(), thread);
+    reader.ReadObject();
+  }
+  timer.Stop();
+  return timer.TotalElapsedTime();
+}
+
+BENCHMARK(MessageList1k) {
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  HANDLESCOPE(thread);
+  benchmark->set_score(MessageRoundTrip(thread, 1024, 10000));
+}
+
+BENCHMARK(MessageList256k) {
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  HANDLESCOPE(thread);
+  benchmark->set_score(MessageRoundTrip(thread, 256 * 1024, 100));
+}
+
+//
+// Measure interning of distinct symbols and re-lookup of existing ones.
+//
+BENCHMARK(SymbolInterning) {
+  TransitionNativeToVM transition(thread);
+  StackZone zone(thread);
+  HANDLESCOPE(thread);
+  const intptr_t kSymbolCount = 100000;
+  String& symbol = String::Handle();
+  char name[32];
+  Timer timer(true, "Symbol interning benchmark");
+  timer.Start();
+  for (intptr_t i = 0; i < kSymbolCount; i++) {
+    Utils::SNPrint(name, sizeof(name), "sym%" Pd, i);
+    symbol = Symbols::New(thread, name);
+  }
+  // The second round hits the canonical table instead of growing it.
+  for (intptr_t i = 0; i < kSymbolCount; i++) {
+    Utils::SNPrint(name, sizeof(name), "sym%" Pd, i);
+    symbol = Symbols::New(thread, name);
+  }
+  timer.Stop();
+  benchmark->set_score(timer.TotalElapsedTime());
+}
+
 BENCHMARK_MEMORY(InitialRSS) {
   benchmark->set_score(bin::Process::MaxRSS());
 }
@@ -3,6 +3,7 @@
 // BSD-style license that can be found in the LICENSE file.
 
 #include "vm/bit_vector.h"
+#include "platform/utils.h"
 #include "vm/log.h"
 #include "vm/os.h"
 
@@ -19,17 +20,13 @@ void BitVector::Iterator::Advance() {
     } while (current_word_ == 0);
     bit_index_ = word_index_ * kBitsPerWord;
   }
-  // Skip zero bytes.
-  while ((current_word_ & 0xff) == 0) {
-    current_word_ >>= 8;
-    bit_index_ += 8;
-  }
-  // Skip zero bits.
-  while ((current_word_ & 0x1) == 0) {
-    current_word_ >>= 1;
-    ++bit_index_;
-  }
-  current_word_ = current_word_ >> 1;
+  // Jump directly to the next set bit.
+  const intptr_t shift = Utils::CountTrailingZerosWord(current_word_);
+  bit_index_ += shift;
+  // Shift in two steps: shift + 1 is kBitsPerWord when the set bit is the
+  // most significant one, and shifting by the full word width is undefined.
+  current_word_ >>= shift;
+  current_word_ >>= 1;
 }
 
 bool BitVector::Equals(const BitVector& other) const {
@@ -49,45 +46,44 @@ bool BitVector::Equals(const BitVector& other) const {
   return true;
 }
 
+// The bulk operations below accumulate the changed bits instead of branching
+// on every word so that the compiler can vectorize the loops; liveness
+// analysis iterates them to a fixed point over many large vectors.
 bool BitVector::AddAll(const BitVector* from) {
   ASSERT(data_length_ == from->data_length_);
-  bool changed = false;
+  uword changed = 0;
   for (intptr_t i = 0; i < data_length_; i++) {
     const uword before = data_[i];
-    const uword after = data_[i] | from->data_[i];
-    if (before != after) {
-      changed = true;
-      data_[i] = after;
-    }
+    const uword after = before | from->data_[i];
+    changed |= before ^ after;
+    data_[i] = after;
   }
-  return changed;
+  return changed != 0;
 }
 
 bool BitVector::RemoveAll(const BitVector* from) {
   ASSERT(data_length_ == from->data_length_);
-  bool changed = false;
+  uword changed = 0;
   for (intptr_t i = 0; i < data_length_; i++) {
     const uword before = data_[i];
-    const uword after = data_[i] & ~from->data_[i];
-    if (before != after) {
-      changed = true;
-      data_[i] = after;
-    }
+    const uword after = before & ~from->data_[i];
+    changed |= before ^ after;
+    data_[i] = after;
   }
-  return changed;
+  return changed != 0;
 }
 
 bool BitVector::KillAndAdd(BitVector* kill, BitVector* gen) {
   ASSERT(data_length_ == kill->data_length_);
   ASSERT(data_length_ == gen->data_length_);
-  bool changed = false;
+  uword changed = 0;
   for (intptr_t i = 0; i < data_length_; i++) {
     const uword before = data_[i];
-    const uword after = data_[i] | (gen->data_[i] & ~kill->data_[i]);
-    if (before != after) changed = true;
+    const uword after = before | (gen->data_[i] & ~kill->data_[i]);
+    changed |= before ^ after;
     data_[i] = after;
   }
-  return changed;
+  return changed != 0;
 }
 
 void BitVector::Intersect(const BitVector* other) {
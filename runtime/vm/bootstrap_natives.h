@@ -19,6 +19,7 @@ namespace dart {
   V(Object_equals, 2)                                                          \
   V(Object_getHash, 1)                                                         \
   V(Object_setHash, 2)                                                         \
+  V(Object_createHash, 1)                                                      \
   V(Object_toString, 1)                                                        \
   V(Object_runtimeType, 1)                                                     \
   V(Object_haveSameRuntimeType, 2)                                             \
@@ -193,6 +194,7 @@ namespace dart {
   V(TypedData_Float64x2Array_new, 2)                                           \
   V(TypedData_length, 1)                                                       \
   V(TypedData_setRange, 7)                                                     \
+  V(TypedData_fillRange, 4)                                                    \
   V(TypedData_GetInt8, 2)                                                      \
   V(TypedData_SetInt8, 3)                                                      \
   V(TypedData_GetUint8, 2)                                                     \
@@ -329,6 +331,7 @@ namespace dart {
   V(GrowableList_allocate, 2)                                                  \
   V(GrowableList_getIndexed, 2)                                                \
   V(GrowableList_setIndexed, 3)                                                \
+  V(GrowableList_grow, 2)                                                      \
   V(GrowableList_getLength, 1)                                                 \
   V(GrowableList_getCapacity, 1)                                               \
   V(GrowableList_setLength, 2)                                                 \
@@ -254,6 +254,67 @@ class CanonicalTypeArgumentsTraits {
 typedef UnorderedHashSet<CanonicalTypeArgumentsTraits>
     CanonicalTypeArgumentsSet;
 
+class FfiCallbackFunctionKey {
+ public:
+  FfiCallbackFunctionKey(const Function& c_signature,
+                         const Function& dart_target,
+                         const Instance& exceptional_return)
+      : c_signature_(c_signature),
+        dart_target_(dart_target),
+        exceptional_return_(exceptional_return) {}
+
+  bool Matches(const Function& callback) const {
+    if (callback.FfiCallbackTarget() != dart_target_.raw() ||
+        callback.FfiCSignature() != c_signature_.raw()) {
+      return false;
+    }
+    const Instance& other_exceptional_return =
+        Instance::Handle(callback.FfiCallbackExceptionalReturn());
+    if (exceptional_return_.IsNull() || other_exceptional_return.IsNull()) {
+      return exceptional_return_.raw() == other_exceptional_return.raw();
+    }
+    // The exceptional return value may have been copied into old space, so
+    // equal values are not necessarily the same object.
+    return exceptional_return_.CanonicalizeEquals(other_exceptional_return);
+  }
+  uword Hash() const {
+    return String::Handle(dart_target_.name()).Hash();
+  }
+  const Function& c_signature_;
+  const Function& dart_target_;
+  const Instance& exceptional_return_;
+
+ private:
+  DISALLOW_ALLOCATION();
+};
+
+// Traits for looking up an existing FFI callback function based on the
+// C signature, Dart target and exceptional return value it was created for.
+class FfiCallbackFunctionTraits {
+ public:
+  static const char* Name() { return "FfiCallbackFunctionTraits"; }
+  static bool ReportStats() { return false; }
+
+  // Called when growing the table. The table only ever contains one callback
+  // per key, so stored entries can be compared by identity.
+  static bool IsMatch(const Object& a, const Object& b) {
+    ASSERT(a.IsFunction() && b.IsFunction());
+    return a.raw() == b.raw();
+  }
+  static bool IsMatch(const FfiCallbackFunctionKey& a, const Object& b) {
+    ASSERT(b.IsFunction());
+    return a.Matches(Function::Cast(b));
+  }
+  static uword Hash(const Object& key) {
+    ASSERT(key.IsFunction());
+    const Function& target =
+        Function::Handle(Function::Cast(key).FfiCallbackTarget());
+    return String::Handle(target.name()).Hash();
+  }
+  static uword Hash(const FfiCallbackFunctionKey& key) { return key.Hash(); }
+};
+typedef UnorderedHashSet<FfiCallbackFunctionTraits> FfiCallbackFunctionSet;
+
 }  // namespace dart
 
 #endif  // RUNTIME_VM_CANONICAL_TABLES_H_
@@ -201,10 +201,16 @@ bool ClassFinalizer::ProcessPendingClasses() {
     }
 #endif
 
-    // Finalize types in all classes.
-    for (intptr_t i = 0; i < class_array.Length(); i++) {
-      cls ^= class_array.At(i);
-      FinalizeTypesInClass(cls);
+    // Finalize types in all classes. With --lazy-type-finalization this is
+    // deferred until the class is first used: Class::EnsureIsFinalized
+    // finalizes the types in a class (and in its supertype chain) on demand.
+    // The precompiler visits every class anyway, so there is nothing to be
+    // gained by deferring in AOT mode.
+    if (!FLAG_lazy_type_finalization || FLAG_precompiled_mode) {
+      for (intptr_t i = 0; i < class_array.Length(); i++) {
+        cls ^= class_array.At(i);
+        FinalizeTypesInClass(cls);
+      }
     }
 
     // Clear pending classes array.
@@ -1089,10 +1095,13 @@ void ClassFinalizer::RegisterClassInHierarchy(Zone* zone, const Class& cls) {
 }
 
 void ClassFinalizer::FinalizeClass(const Class& cls) {
-  ASSERT(cls.is_type_finalized());
   if (cls.is_finalized()) {
     return;
   }
+  // The types in the class may not have been finalized yet if type
+  // finalization was deferred at load time. This also finalizes the types in
+  // the supertype chain and is a cheap no-op otherwise.
+  FinalizeTypesInClass(cls);
 
   Thread* thread = Thread::Current();
   HANDLESCOPE(thread);
@@ -1207,7 +1216,6 @@ ErrorPtr ClassFinalizer::LoadClassMembers(const Class& cls) {
 #if !defined(DART_PRECOMPILED_RUNTIME)
     cls.EnsureDeclarationLoaded();
 #endif
-    ASSERT(cls.is_type_finalized());
     ClassFinalizer::FinalizeClass(cls);
     return Error::null();
   } else {
@@ -1745,4 +1753,47 @@ void ClassFinalizer::ClearAllCode(bool including_nonchanging_cids) {
 #endif  // !DART_PRECOMPILED_RUNTIME
 }
 
+void ClassFinalizer::ClearUnusedCode() {
+#ifdef DART_PRECOMPILED_RUNTIME
+  UNREACHABLE();
+#else
+  auto const thread = Thread::Current();
+  auto const isolate = thread->isolate();
+  StackZone stack_zone(thread);
+  HANDLESCOPE(thread);
+  auto const zone = thread->zone();
+
+  // Ages code across sweeps: the first visit of an executed function resets
+  // its usage counter, and a later visit that still finds a zero counter
+  // knows the function has not been entered for at least one full sweep
+  // interval and detaches its code. The GC then reclaims the code unless it
+  // is still referenced, e.g. from a frame on some stack.
+  class ClearUnusedCodeVisitor : public FunctionVisitor {
+   public:
+    void VisitFunction(const Function& function) {
+      if (!function.HasCode() || function.HasOptimizedCode()) {
+        // Not compiled, or hot enough to have been optimized.
+        return;
+      }
+      if (function.usage_counter() > 0) {
+        // Entered since the previous sweep. SetUsageCounter records the
+        // execution in the was-executed bit before clearing the counter.
+        function.SetUsageCounter(0);
+        return;
+      }
+      if (!function.WasExecuted()) {
+        // Compiled but never run, e.g. code loaded from an app-jit
+        // snapshot. Discarding it would throw away training work.
+        return;
+      }
+      function.ClearCode();
+      function.ClearICDataArray();
+    }
+  };
+
+  ClearUnusedCodeVisitor visitor;
+  ProgramVisitor::WalkProgram(zone, isolate, &visitor);
+#endif  // !DART_PRECOMPILED_RUNTIME
+}
+
 }  // namespace dart
@@ -44,6 +44,12 @@ class ClassFinalizer : public AllStatic {
   static void RehashTypes();
   static void ClearAllCode(bool including_nonchanging_cids = false);
 
+  // Discards unoptimized code that has not been entered since the previous
+  // call, reclaiming code compiled for run-once functions in long-lived
+  // isolates. Cleared functions fall back to the lazy compile stub and are
+  // recompiled if they are ever called again.
+  static void ClearUnusedCode();
+
   // Return whether processing pending classes (ObjectStore::pending_classes_)
   // failed. The function returns true if the processing was successful.
   // If processing fails, an error message is set in the sticky error field
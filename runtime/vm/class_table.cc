@@ -172,7 +172,8 @@ void ClassTable::Register(const Class& cls) {
     table_.load()[cid] = cls.raw();
   } else {
     if (top_ == capacity_) {
-      const intptr_t new_capacity = capacity_ + kCapacityIncrement;
+      const intptr_t new_capacity =
+          Utils::Maximum(capacity_ * 2, capacity_ + kCapacityIncrement);
       Grow(new_capacity);
     }
     ASSERT(top_ < capacity_);
@@ -196,7 +197,8 @@ void ClassTable::RegisterTopLevel(const Class& cls) {
   ASSERT(index == kIllegalCid);
 
   if (tlc_top_ == tlc_capacity_) {
-    const intptr_t new_capacity = tlc_capacity_ + kCapacityIncrement;
+    const intptr_t new_capacity =
+        Utils::Maximum(tlc_capacity_ * 2, tlc_capacity_ + kCapacityIncrement);
     GrowTopLevel(new_capacity);
   }
   ASSERT(tlc_top_ < tlc_capacity_);
@@ -220,7 +222,8 @@ intptr_t SharedClassTable::Register(intptr_t index, intptr_t size) {
   } else {
     ASSERT(size == 0);
     if (top_ == capacity_) {
-      const intptr_t new_capacity = capacity_ + kCapacityIncrement;
+      const intptr_t new_capacity =
+          Utils::Maximum(capacity_ * 2, capacity_ + kCapacityIncrement);
       Grow(new_capacity);
     }
     ASSERT(top_ < capacity_);
@@ -240,7 +243,8 @@ void ClassTable::AllocateIndex(intptr_t index) {
   ASSERT(Class::is_valid_id(index));
 
   if (index >= capacity_) {
-    const intptr_t new_capacity = index + kCapacityIncrement;
+    const intptr_t new_capacity =
+        Utils::Maximum(capacity_ * 2, index + kCapacityIncrement);
     Grow(new_capacity);
   }
 
@@ -258,7 +262,8 @@ void ClassTable::AllocateTopLevelIndex(intptr_t cid) {
   const intptr_t tlc_index = IndexFromTopLevelCid(cid);
 
   if (tlc_index >= tlc_capacity_) {
-    const intptr_t new_capacity = tlc_index + kCapacityIncrement;
+    const intptr_t new_capacity =
+        Utils::Maximum(tlc_capacity_ * 2, tlc_index + kCapacityIncrement);
     GrowTopLevel(new_capacity);
   }
 
@@ -319,7 +324,8 @@ void SharedClassTable::AllocateIndex(intptr_t index) {
   ASSERT(Class::is_valid_id(index));
 
   if (index >= capacity_) {
-    const intptr_t new_capacity = index + kCapacityIncrement;
+    const intptr_t new_capacity =
+        Utils::Maximum(capacity_ * 2, index + kCapacityIncrement);
     Grow(new_capacity);
   }
 
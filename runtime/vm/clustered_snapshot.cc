@@ -20,6 +20,7 @@
 #include "vm/growable_array.h"
 #include "vm/heap/heap.h"
 #include "vm/image_snapshot.h"
+#include "vm/json_writer.h"
 #include "vm/native_entry.h"
 #include "vm/object.h"
 #include "vm/object_store.h"
@@ -28,6 +29,7 @@
 #include "vm/symbols.h"
 #include "vm/timeline.h"
 #include "vm/version.h"
+#include "vm/virtual_memory.h"
 #include "vm/zone_text_buffer.h"
 
 #if !defined(DART_PRECOMPILED_RUNTIME)
@@ -43,6 +45,12 @@ DEFINE_FLAG(bool,
             print_cluster_information,
             false,
             "Print information about clusters written to snapshot");
+DEFINE_FLAG(charp,
+            print_snapshot_sizes_to,
+            nullptr,
+            "Print a machine readable report of the isolate snapshot's "
+            "cluster sizes in JSON format to the given file. Per-function "
+            "instruction sizes are reported by --print_instructions_sizes_to.");
 #endif
 
 #if defined(DART_PRECOMPILER)
@@ -50,6 +58,13 @@ DEFINE_FLAG(charp,
             write_v8_snapshot_profile_to,
             NULL,
             "Write a snapshot profile in V8 format to a file.");
+DEFINE_FLAG(charp,
+            code_order_file,
+            nullptr,
+            "File with one fully qualified function name per line. AOT "
+            "snapshot code is emitted in this order, so code exercised "
+            "during a training run packs into adjacent pages; unlisted "
+            "code follows in discovery order.");
 #endif  // defined(DART_PRECOMPILER)
 
 #if defined(DART_PRECOMPILER) && !defined(TARGET_ARCH_IA32)
@@ -951,6 +966,7 @@ class FfiTrampolineDataSerializationCluster : public SerializationCluster {
         // FFI callbacks can only be written to AOT snapshots.
         ASSERT(data->ptr()->callback_target_ == Object::null());
       }
+      s->Write<bool>(data->ptr()->is_leaf_);
     }
   }
 
@@ -984,6 +1000,7 @@ class FfiTrampolineDataDeserializationCluster : public DeserializationCluster {
       ReadFromTo(data);
       data->ptr()->callback_id_ =
           d->kind() == Snapshot::kFullAOT ? d->ReadUnsigned() : 0;
+      data->ptr()->is_leaf_ = d->Read<bool>();
     }
   }
 };
@@ -1617,16 +1634,150 @@ class CodeSerializationCluster : public SerializationCluster {
     return 0;
   }
 
+  // Maps the functions recorded by CompilationTraceLoader to their position
+  // in the startup profile, so code compiled early during the training run
+  // is written early in the cluster and packed into the same pages. Returns
+  // the number of functions in the profile.
+  static intptr_t BuildStartupProfileMap(Serializer* s,
+                                         IntMap<intptr_t>* profile_map) {
+    if (s->kind() != Snapshot::kFullJIT) {
+      return 0;
+    }
+    Isolate* isolate = s->isolate();
+    if ((isolate == nullptr) || (isolate->object_store() == nullptr)) {
+      return 0;
+    }
+    GrowableObjectArrayPtr functions =
+        isolate->object_store()->startup_functions();
+    if (functions == GrowableObjectArray::null()) {
+      return 0;
+    }
+    const intptr_t length = Smi::Value(functions->ptr()->length_);
+    ArrayPtr data = functions->ptr()->data_;
+    for (intptr_t i = 0; i < length; i++) {
+      profile_map->Insert(static_cast<intptr_t>(data->ptr()->data()[i]),
+                          i + 1);
+    }
+    return length;
+  }
+
+#if defined(DART_PRECOMPILER)
+  // Reads --code_order_file into [ranks], mapping fully qualified function
+  // names to their 1-based line number. Returns the number of names read.
+  static intptr_t ReadCodeOrderFile(Zone* zone, CStringMap<intptr_t>* ranks) {
+    Dart_FileOpenCallback file_open = Dart::file_open_callback();
+    Dart_FileReadCallback file_read = Dart::file_read_callback();
+    Dart_FileCloseCallback file_close = Dart::file_close_callback();
+    if ((file_open == nullptr) || (file_read == nullptr) ||
+        (file_close == nullptr)) {
+      OS::PrintErr(
+          "warning: Ignoring --code_order_file=%s: "
+          "no file callbacks are set\n",
+          FLAG_code_order_file);
+      return 0;
+    }
+    void* file = file_open(FLAG_code_order_file, /*write=*/false);
+    if (file == nullptr) {
+      OS::PrintErr("warning: Failed to open code order file '%s'\n",
+                   FLAG_code_order_file);
+      return 0;
+    }
+    uint8_t* buffer = nullptr;
+    intptr_t length = -1;
+    file_read(&buffer, &length, file);
+    file_close(file);
+    if ((buffer == nullptr) || (length <= 0)) {
+      OS::PrintErr("warning: Failed to read code order file '%s'\n",
+                   FLAG_code_order_file);
+      return 0;
+    }
+
+    // Copy into the zone so the parsed names stay alive as map keys.
+    char* text = zone->Alloc<char>(length + 1);
+    memmove(text, buffer, length);
+    text[length] = '\0';
+    free(buffer);
+
+    intptr_t count = 0;
+    char* line = text;
+    while (*line != '\0') {
+      char* end = strchr(line, '\n');
+      if (end != nullptr) {
+        *end = '\0';
+      }
+      if (*line != '\0') {
+        count++;
+        ranks->Update({line, count});
+      }
+      if (end == nullptr) break;
+      line = end + 1;
+    }
+    return count;
+  }
+
+  // Maps the owners of [codes] named in --code_order_file to their rank in
+  // the file, so a training run's code order decides the AOT text layout.
+  // Returns the number of names in the file.
+  static intptr_t BuildCodeOrderMap(Serializer* s,
+                                    IntMap<intptr_t>* profile_map,
+                                    const GrowableArray<CodePtr>& codes) {
+    if ((FLAG_code_order_file == nullptr) ||
+        (s->kind() != Snapshot::kFullAOT)) {
+      return 0;
+    }
+    Thread* thread = Thread::Current();
+    Zone* zone = thread->zone();
+    CStringMap<intptr_t> ranks(zone);
+    const intptr_t count = ReadCodeOrderFile(zone, &ranks);
+    if (count == 0) {
+      return 0;
+    }
+    Function& function = Function::Handle(zone);
+    for (intptr_t i = 0; i < codes.length(); i++) {
+      ObjectPtr owner = codes[i]->ptr()->owner_;
+      if (!owner->IsHeapObject() || (owner->GetClassId() != kFunctionCid)) {
+        continue;
+      }
+      const intptr_t function_key = static_cast<intptr_t>(owner);
+      if (profile_map->HasKey(function_key)) {
+        continue;
+      }
+      function ^= owner;
+      const intptr_t rank =
+          ranks.LookupValue(function.ToFullyQualifiedCString());
+      if (rank != 0) {
+        profile_map->Insert(function_key, rank);
+      }
+    }
+    return count;
+  }
+#endif  // defined(DART_PRECOMPILER)
+
   static void Insert(GrowableArray<CodeOrderInfo>* order_list,
                      IntMap<intptr_t>* order_map,
+                     IntMap<intptr_t>* profile_map,
+                     intptr_t profile_length,
                      CodePtr code) {
+    ObjectPtr owner = code->ptr()->owner_;
+    if (owner->IsHeapObject() && (owner->GetClassId() == kFunctionCid)) {
+      const intptr_t function_key = static_cast<intptr_t>(owner);
+      if (profile_map->HasKey(function_key)) {
+        CodeOrderInfo info;
+        info.code = code;
+        info.order = profile_map->Lookup(function_key);
+        order_list->Add(info);
+        return;
+      }
+    }
+    // Code absent from the profile keeps its discovery order, after all the
+    // profiled code.
     InstructionsPtr instr = code->ptr()->instructions_;
     intptr_t key = static_cast<intptr_t>(instr);
     intptr_t order;
     if (order_map->HasKey(key)) {
       order = order_map->Lookup(key);
     } else {
-      order = order_list->length() + 1;
+      order = profile_length + order_list->length() + 1;
       order_map->Insert(key, order);
     }
     CodeOrderInfo info;
@@ -1635,11 +1786,19 @@ class CodeSerializationCluster : public SerializationCluster {
     order_list->Add(info);
   }
 
-  static void Sort(GrowableArray<CodePtr>* codes) {
+  static void Sort(Serializer* s, GrowableArray<CodePtr>* codes) {
     GrowableArray<CodeOrderInfo> order_list;
     IntMap<intptr_t> order_map;
+    IntMap<intptr_t> profile_map;
+    intptr_t profile_length = BuildStartupProfileMap(s, &profile_map);
+#if defined(DART_PRECOMPILER)
+    if (profile_length == 0) {
+      profile_length = BuildCodeOrderMap(s, &profile_map, *codes);
+    }
+#endif
     for (intptr_t i = 0; i < codes->length(); i++) {
-      Insert(&order_list, &order_map, (*codes)[i]);
+      Insert(&order_list, &order_map, &profile_map, profile_length,
+             (*codes)[i]);
     }
     order_list.Sort(CompareCodeOrderInfo);
     ASSERT(order_list.length() == codes->length());
@@ -1648,11 +1807,23 @@ class CodeSerializationCluster : public SerializationCluster {
     }
   }
 
-  static void Sort(GrowableArray<Code*>* codes) {
+  static void Sort(Serializer* s, GrowableArray<Code*>* codes) {
     GrowableArray<CodeOrderInfo> order_list;
     IntMap<intptr_t> order_map;
+    IntMap<intptr_t> profile_map;
+    intptr_t profile_length = BuildStartupProfileMap(s, &profile_map);
+#if defined(DART_PRECOMPILER)
+    if (profile_length == 0) {
+      GrowableArray<CodePtr> raw_codes(codes->length());
+      for (intptr_t i = 0; i < codes->length(); i++) {
+        raw_codes.Add((*codes)[i]->raw());
+      }
+      profile_length = BuildCodeOrderMap(s, &profile_map, raw_codes);
+    }
+#endif
     for (intptr_t i = 0; i < codes->length(); i++) {
-      Insert(&order_list, &order_map, (*codes)[i]->raw());
+      Insert(&order_list, &order_map, &profile_map, profile_length,
+             (*codes)[i]->raw());
     }
     order_list.Sort(CompareCodeOrderInfo);
     ASSERT(order_list.length() == codes->length());
@@ -1662,13 +1833,13 @@ class CodeSerializationCluster : public SerializationCluster {
   }
 
   void WriteAlloc(Serializer* s) {
-    Sort(&objects_);
+    Sort(s, &objects_);
     auto loading_units = s->loading_units();
     if (loading_units != nullptr) {
       for (intptr_t i = LoadingUnit::kRootId + 1; i < loading_units->length();
            i++) {
         auto unit_objects = loading_units->At(i)->deferred_objects();
-        Sort(unit_objects);
+        Sort(s, unit_objects);
         for (intptr_t j = 0; j < unit_objects->length(); j++) {
           deferred_objects_.Add(unit_objects->At(j)->raw());
         }
@@ -2316,7 +2487,10 @@ class PcDescriptorsDeserializationCluster : public DeserializationCluster {
 };
 
 #if !defined(DART_PRECOMPILED_RUNTIME)
-// PcDescriptor, CompressedStackMaps, OneByteString, TwoByteString
+// PcDescriptors, CodeSourceMaps, CompressedStackMaps, OneByteStrings and
+// TwoByteStrings are written into the direct mapped data image instead of the
+// clustered stream (see Serializer::ReadOnlyObjectType), so at load time they
+// are used in place from the image rather than copied into the heap.
 class RODataSerializationCluster : public SerializationCluster {
  public:
   RODataSerializationCluster(Zone* zone, const char* type, intptr_t cid)
@@ -6137,9 +6311,11 @@ void Serializer::WriteDispatchTable(const Array& entries) {
 
 void Serializer::PrintSnapshotSizes() {
 #if !defined(DART_PRECOMPILED_RUNTIME)
-  if (FLAG_print_snapshot_sizes_verbose) {
-    OS::PrintErr(
-        "                  Cluster   Objs     Size Fraction Cumulative\n");
+  // The cluster size report covers the isolate snapshot only; the VM snapshot
+  // holds no program structure and would clobber the report file.
+  const bool dump_sizes_json =
+      (FLAG_print_snapshot_sizes_to != nullptr) && !vm_;
+  if (FLAG_print_snapshot_sizes_verbose || dump_sizes_json) {
     GrowableArray<SerializationCluster*> clusters_by_size;
     for (intptr_t cid = 1; cid < num_cids_; cid++) {
       SerializationCluster* cluster = clusters_by_cid_[cid];
@@ -6176,21 +6352,71 @@ void Serializer::PrintSnapshotSizes() {
           "DispatchTable", entry_count, dispatch_table_size_));
     }
     clusters_by_size.Sort(CompareClusters);
-    double total_size =
-        static_cast<double>(bytes_written() + GetDataSize() + text_size);
-    double cumulative_fraction = 0.0;
-    for (intptr_t i = 0; i < clusters_by_size.length(); i++) {
-      SerializationCluster* cluster = clusters_by_size[i];
-      double fraction = static_cast<double>(cluster->size()) / total_size;
-      cumulative_fraction += fraction;
-      OS::PrintErr("%25s %6" Pd " %8" Pd " %lf %lf\n", cluster->name(),
-                   cluster->num_objects(), cluster->size(), fraction,
-                   cumulative_fraction);
+    if (FLAG_print_snapshot_sizes_verbose) {
+      OS::PrintErr(
+          "                  Cluster   Objs     Size Fraction Cumulative\n");
+      double total_size =
+          static_cast<double>(bytes_written() + GetDataSize() + text_size);
+      double cumulative_fraction = 0.0;
+      for (intptr_t i = 0; i < clusters_by_size.length(); i++) {
+        SerializationCluster* cluster = clusters_by_size[i];
+        double fraction = static_cast<double>(cluster->size()) / total_size;
+        cumulative_fraction += fraction;
+        OS::PrintErr("%25s %6" Pd " %8" Pd " %lf %lf\n", cluster->name(),
+                     cluster->num_objects(), cluster->size(), fraction,
+                     cumulative_fraction);
+      }
+    }
+    if (dump_sizes_json) {
+      DumpSnapshotSizesJSON(clusters_by_size, text_size);
     }
   }
 #endif  // !defined(DART_PRECOMPILED_RUNTIME)
 }
 
+#if !defined(DART_PRECOMPILED_RUNTIME)
+void Serializer::DumpSnapshotSizesJSON(
+    const GrowableArray<SerializationCluster*>& clusters,
+    intptr_t text_size) {
+  JSONWriter js;
+  js.OpenObject();
+  js.PrintProperty("snapshot_size", bytes_written() + GetDataSize());
+  js.PrintProperty("text_size", text_size);
+  js.OpenArray("clusters");
+  for (intptr_t i = 0; i < clusters.length(); i++) {
+    SerializationCluster* cluster = clusters[i];
+    js.OpenObject();
+    js.PrintProperty("n", cluster->name());
+    js.PrintProperty("o", cluster->num_objects());
+    js.PrintProperty("s", cluster->size());
+    js.CloseObject();
+  }
+  js.CloseArray();
+  js.CloseObject();
+
+  auto file_open = Dart::file_open_callback();
+  auto file_write = Dart::file_write_callback();
+  auto file_close = Dart::file_close_callback();
+  if ((file_open == nullptr) || (file_write == nullptr) ||
+      (file_close == nullptr)) {
+    return;
+  }
+
+  auto file = file_open(FLAG_print_snapshot_sizes_to, /*write=*/true);
+  if (file == nullptr) {
+    OS::PrintErr("Failed to open file %s\n", FLAG_print_snapshot_sizes_to);
+    return;
+  }
+
+  char* output = nullptr;
+  intptr_t output_length = 0;
+  js.Steal(&output, &output_length);
+  file_write(output, output_length, file);
+  free(output);
+  file_close(file);
+}
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
+
 Deserializer::Deserializer(Thread* thread,
                            Snapshot::Kind kind,
                            const uint8_t* buffer,
@@ -7099,6 +7325,35 @@ bool SnapshotHeaderReader::NullSafetyFromSnapshot(const Snapshot* snapshot) {
   return null_safety;
 }
 
+// Deserialization streams through the whole clustered snapshot and chases
+// references into the image pages, and on a cold start most of that memory
+// has not been faulted in yet. Ask the OS to read it ahead so the page faults
+// overlap with the deserialization work instead of serializing with it.
+static void ReadAheadSnapshot(Snapshot::Kind kind,
+                              const uint8_t* buffer,
+                              intptr_t size,
+                              const uint8_t* data_image,
+                              const uint8_t* instructions_image) {
+  VirtualMemory::WillNeed(const_cast<uint8_t*>(buffer), size);
+  if (data_image != NULL) {
+    Image image(data_image);
+    VirtualMemory::WillNeed(image.object_start(), image.object_size());
+  }
+  if (instructions_image != NULL) {
+    Image image(instructions_image);
+    if ((kind == Snapshot::kFullAOT) && FLAG_use_bare_instructions) {
+      // Deserialization only computes entry point addresses into this image;
+      // the payload pages are first touched when the code actually runs.
+      // Keeping the kernel from reading ahead around each executed page
+      // keeps never-executed code out of the resident set.
+      VirtualMemory::WillAccessRandomly(image.object_start(),
+                                        image.object_size());
+    } else {
+      VirtualMemory::WillNeed(image.object_start(), image.object_size());
+    }
+  }
+}
+
 ApiErrorPtr FullSnapshotReader::ReadVMSnapshot() {
   SnapshotHeaderReader header_reader(kind_, buffer_, size_);
 
@@ -7109,6 +7364,8 @@ ApiErrorPtr FullSnapshotReader::ReadVMSnapshot() {
     return ConvertToApiError(error);
   }
 
+  ReadAheadSnapshot(kind_, buffer_, size_, data_image_, instructions_image_);
+
   Deserializer deserializer(thread_, kind_, buffer_, size_, data_image_,
                             instructions_image_, /*is_non_root_unit=*/false,
                             offset);
@@ -7150,6 +7407,8 @@ ApiErrorPtr FullSnapshotReader::ReadProgramSnapshot() {
     return ConvertToApiError(error);
   }
 
+  ReadAheadSnapshot(kind_, buffer_, size_, data_image_, instructions_image_);
+
   Deserializer deserializer(thread_, kind_, buffer_, size_, data_image_,
                             instructions_image_, /*is_non_root_unit=*/false,
                             offset);
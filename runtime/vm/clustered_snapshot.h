@@ -220,6 +220,9 @@ class Serializer : public ThreadStackResource {
 
   ZoneGrowableArray<Object*>* Serialize(SerializationRoots* roots);
   void PrintSnapshotSizes();
+  void DumpSnapshotSizesJSON(
+      const GrowableArray<SerializationCluster*>& clusters,
+      intptr_t text_size);
 
   FieldTable* field_table() { return field_table_; }
 
@@ -18,6 +18,11 @@ namespace dart {
 #if !defined(DART_PRECOMPILED_RUNTIME)
 
 DEFINE_FLAG(bool, trace_compilation_trace, false, "Trace compilation trace.");
+DEFINE_FLAG(bool,
+            warmup_from_compilation_trace,
+            false,
+            "Queue functions from a loaded compilation trace for optimizing "
+            "background compilation instead of waiting for usage counters.");
 
 CompilationTraceSaver::CompilationTraceSaver(Zone* zone)
     : buf_(zone, 1 * MB),
@@ -67,6 +72,7 @@ CompilationTraceLoader::CompilationTraceLoader(Thread* thread)
       target_(Function::Handle(zone_)),
       selector_(String::Handle(zone_)),
       args_desc_(Array::Handle(zone_)),
+      startup_functions_(GrowableObjectArray::Handle(zone_)),
       error_(Object::Handle(zone_)) {}
 
 static char* FindCharacter(char* str, char goal, char* limit) {
@@ -372,11 +378,48 @@ ObjectPtr CompilationTraceLoader::CompileFunction(const Function& function) {
     return error_.raw();
   }
 
+  RecordStartupFunction(function);
   SpeculateInstanceCallTargets(function);
+  MaybeQueueForOptimization(function);
 
   return error_.raw();
 }
 
+// The trace records functions that became hot in an earlier run, so instead
+// of waiting for their usage counters to climb again, hand them to the
+// optimizing background compiler right away. They are queued with the lowest
+// priority, so functions that prove hot under live traffic still jump ahead
+// of the warm-up backlog, and the background task count bounds how much CPU
+// the warm-up may take from the application.
+void CompilationTraceLoader::MaybeQueueForOptimization(
+    const Function& function) {
+  if (!FLAG_warmup_from_compilation_trace || !FLAG_background_compilation) {
+    return;
+  }
+  Isolate* isolate = thread_->isolate();
+  if (BackgroundCompiler::IsDisabled(isolate, /*optimizing_compiler=*/true)) {
+    return;
+  }
+  if (!function.IsOptimizable() || !function.is_background_optimizable()) {
+    return;
+  }
+  BackgroundCompiler::Start(isolate);
+  isolate->optimizing_background_compiler()->Compile(function);
+}
+
+void CompilationTraceLoader::RecordStartupFunction(const Function& function) {
+  // Remember the order in which the traced functions were compiled. If this
+  // run later writes an app-jit snapshot, the code cluster is sorted by this
+  // order so that code needed early during startup is packed together.
+  startup_functions_ = thread_->isolate()->object_store()->startup_functions();
+  if (startup_functions_.IsNull()) {
+    startup_functions_ = GrowableObjectArray::New(Heap::kOld);
+    thread_->isolate()->object_store()->set_startup_functions(
+        startup_functions_);
+  }
+  startup_functions_.Add(function, Heap::kOld);
+}
+
 // For instance calls, if the receiver's static type has one concrete
 // implementation, lookup the target for that implementation and add it
 // to the ICData's entries.
@@ -518,6 +561,7 @@ void TypeFeedbackSaver::VisitFunction(const Function& function) {
 
   WriteInt(function.kind());
   WriteInt(function.token_pos().value());
+  WriteInt(function.SourceFingerprint());
 
   code_ = function.CurrentCode();
   intptr_t usage = function.usage_counter();
@@ -814,6 +858,7 @@ ObjectPtr TypeFeedbackLoader::LoadFunction() {
   func_name_ = ReadString();  // Without private mangling.
   FunctionLayout::Kind kind = static_cast<FunctionLayout::Kind>(ReadInt());
   intptr_t token_pos = ReadInt();
+  int32_t fingerprint = static_cast<int32_t>(ReadInt());
   intptr_t usage = ReadInt();
   intptr_t inlining_depth = ReadInt();
   intptr_t num_call_sites = ReadInt();
@@ -829,6 +874,16 @@ ObjectPtr TypeFeedbackLoader::LoadFunction() {
     }
   }
 
+  if (!skip && (func_.SourceFingerprint() != fingerprint)) {
+    // The program was recompiled from changed sources: the function still
+    // exists under this name but its body is different, so the saved call
+    // sites and counters no longer describe it.
+    skip = true;
+    if (FLAG_trace_compilation_trace) {
+      THR_Print("Mismatched source fingerprint %s\n", func_name_.ToCString());
+    }
+  }
+
   if (!skip) {
     error_ = Compiler::CompileFunction(thread_, func_);
     if (error_.IsError()) {
@@ -42,7 +42,9 @@ class CompilationTraceLoader : public ValueObject {
                           const char* cls_cstr,
                           const char* func_cstr);
   ObjectPtr CompileFunction(const Function& function);
+  void RecordStartupFunction(const Function& function);
   void SpeculateInstanceCallTargets(const Function& function);
+  void MaybeQueueForOptimization(const Function& function);
 
   Thread* thread_;
   Zone* zone_;
@@ -62,6 +64,7 @@ class CompilationTraceLoader : public ValueObject {
   Function& target_;
   String& selector_;
   Array& args_desc_;
+  GrowableObjectArray& startup_functions_;
   Object& error_;
 };
 
@@ -9,13 +9,24 @@
 #include <memory>
 
 #include "vm/compiler/frontend/kernel_translation_helper.h"
+#include "vm/dart.h"
 #include "vm/dispatch_table.h"
+#include "vm/flags.h"
+#include "vm/os.h"
 #include "vm/stub_code.h"
 #include "vm/thread.h"
 
 #define Z zone_
 
 namespace dart {
+
+DEFINE_FLAG(charp,
+            dispatch_table_profile,
+            nullptr,
+            "Path to a selector call frequency profile used to lay out the "
+            "dispatch table. Each line contains a selector name and a call "
+            "count separated by a space.");
+
 namespace compiler {
 
 class Interval {
@@ -398,6 +409,17 @@ void SelectorMap::SetSelectorProperties(int32_t sid,
   selectors_[sid].requires_args_descriptor |= requires_args_descriptor;
 }
 
+void SelectorMap::SetSelectorCallCount(int32_t sid, int32_t call_count) {
+  ASSERT(sid < selectors_.length());
+  // Whether a selector is used at all is a correctness decision taken from
+  // the TFA metadata; a profiled count only reweights the table layout. So
+  // only touch selectors which already have call sites, and clamp the count
+  // to 1 so a cold profile cannot turn a used selector into an unused one.
+  if (selectors_[sid].IsUsed()) {
+    selectors_[sid].call_count = call_count > 0 ? call_count : 1;
+  }
+}
+
 DispatchTableGenerator::DispatchTableGenerator(Zone* zone)
     : zone_(zone),
       classes_(nullptr),
@@ -433,13 +455,75 @@ void DispatchTableGenerator::ReadTableSelectorInfo() {
   }
 }
 
+// Reads the selector call frequency profile given with
+// --dispatch_table_profile, if any. The call counts from the kernel metadata
+// are static estimates; a profile gathered from a training run replaces them
+// with observed frequencies, so that ComputeSelectorOffsets packs the hottest
+// rows around the origin of the table. Returns whether a profile was loaded.
+bool DispatchTableGenerator::ReadSelectorProfile(CStringMap<int32_t>* profile) {
+  if (FLAG_dispatch_table_profile == nullptr) return false;
+  Dart_FileOpenCallback file_open = Dart::file_open_callback();
+  Dart_FileReadCallback file_read = Dart::file_read_callback();
+  Dart_FileCloseCallback file_close = Dart::file_close_callback();
+  if ((file_open == nullptr) || (file_read == nullptr) ||
+      (file_close == nullptr)) {
+    OS::PrintErr("warning: Ignoring --dispatch_table_profile=%s: "
+                 "no file callbacks are set\n",
+                 FLAG_dispatch_table_profile);
+    return false;
+  }
+  void* file = file_open(FLAG_dispatch_table_profile, /*write=*/false);
+  if (file == nullptr) {
+    OS::PrintErr("warning: Failed to open dispatch table profile '%s'\n",
+                 FLAG_dispatch_table_profile);
+    return false;
+  }
+  uint8_t* buffer = nullptr;
+  intptr_t length = -1;
+  file_read(&buffer, &length, file);
+  file_close(file);
+  if ((buffer == nullptr) || (length <= 0)) {
+    OS::PrintErr("warning: Failed to read dispatch table profile '%s'\n",
+                 FLAG_dispatch_table_profile);
+    return false;
+  }
+
+  // Copy into the zone so the parsed selector names stay alive as map keys.
+  char* text = Z->Alloc<char>(length + 1);
+  memmove(text, buffer, length);
+  text[length] = '\0';
+  free(buffer);
+
+  char* line = text;
+  while (*line != '\0') {
+    char* end = strchr(line, '\n');
+    if (end != nullptr) {
+      *end = '\0';
+    }
+    char* separator = strrchr(line, ' ');
+    if (separator != nullptr) {
+      *separator = '\0';
+      int64_t count = strtoll(separator + 1, nullptr, 10);
+      if (count > kMaxInt32) count = kMaxInt32;
+      profile->Update({line, static_cast<int32_t>(count)});
+    }
+    if (end == nullptr) break;
+    line = end + 1;
+  }
+  return true;
+}
+
 void DispatchTableGenerator::NumberSelectors() {
   num_classes_ = classes_->NumCids();
 
+  CStringMap<int32_t> profile(Z);
+  const bool has_profile = ReadSelectorProfile(&profile);
+
   Object& obj = Object::Handle(Z);
   Class& klass = Class::Handle(Z);
   Array& functions = Array::Handle(Z);
   Function& function = Function::Handle(Z);
+  String& name = String::Handle(Z);
 
   for (classid_t cid = kIllegalCid + 1; cid < num_classes_; cid++) {
     obj = classes_->At(cid);
@@ -461,6 +545,13 @@ void DispatchTableGenerator::NumberSelectors() {
             }
             selector_map_.SetSelectorProperties(sid, on_null_interface,
                                                 requires_args_descriptor);
+            if (has_profile) {
+              name = function.name();
+              const int32_t count = profile.LookupValue(name.ToCString());
+              if (count > 0) {
+                selector_map_.SetSelectorCallCount(sid, count);
+              }
+            }
           }
         }
       }
@@ -10,6 +10,7 @@
 #endif  // defined(DART_PRECOMPILED_RUNTIME)
 
 #include "vm/compiler/frontend/kernel_translation_helper.h"
+#include "vm/hash_map.h"
 #include "vm/object.h"
 
 namespace dart {
@@ -72,6 +73,7 @@ class SelectorMap {
   void SetSelectorProperties(int32_t sid,
                              bool on_null_interface,
                              bool requires_args_descriptor);
+  void SetSelectorCallCount(int32_t sid, int32_t call_count);
 
   int32_t NumIds() const { return selectors_.length(); }
 
@@ -99,6 +101,7 @@ class DispatchTableGenerator {
 
  private:
   void ReadTableSelectorInfo();
+  bool ReadSelectorProfile(CStringMap<int32_t>* profile);
   void NumberSelectors();
   void SetupSelectorRows();
   void ComputeSelectorOffsets();
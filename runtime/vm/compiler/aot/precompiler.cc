@@ -532,6 +532,14 @@ void Precompiler::AddRoots() {
   }
 }
 
+// The fixpoint loop below runs on the single mutator thread. Fanning the
+// pending queue out across a worker pool is not possible in the current
+// architecture: every compilation allocates in the isolate heap and inserts
+// into the canonicalization tables, bare-instructions mode appends to the
+// shared global object pool builder, and compile errors unwind via Jump() on
+// the compiling thread's long-jump scope. Until those are made thread-safe,
+// AOT build time is better reduced by caching and by trimming the work done
+// per function, not by adding threads here.
 void Precompiler::Iterate() {
   Function& function = Function::Handle(Z);
 
@@ -536,6 +536,15 @@ bool FlowGraphCompiler::IsPeephole(Instruction* instr) const {
   return false;
 }
 
+// Emits native code for all blocks in IL order. There is no instruction
+// scheduling: within a block, machine code order is IL order, so dependent
+// operations are emitted back to back even where an independent instruction
+// could hide latency on in-order cores. A post-register-allocation scheduler
+// would have to reorder IL instructions here while keeping deoptimization
+// environments, parallel moves, and safepoint state attached to the right
+// instructions; none of that state currently survives reordering, so any
+// such pass needs to run over the IL before this point rather than over the
+// emitted code.
 void FlowGraphCompiler::VisitBlocks() {
   CompactBlocks();
   if (compiler::Assembler::EmittingComments()) {
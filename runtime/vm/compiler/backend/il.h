@@ -5042,11 +5042,13 @@ class FfiCallInstr : public Definition {
  public:
   FfiCallInstr(Zone* zone,
                intptr_t deopt_id,
-               const compiler::ffi::CallMarshaller& marshaller)
+               const compiler::ffi::CallMarshaller& marshaller,
+               bool is_leaf)
       : Definition(deopt_id),
         zone_(zone),
         marshaller_(marshaller),
-        inputs_(marshaller.num_args() + 1) {
+        inputs_(marshaller.num_args() + 1),
+        is_leaf_(is_leaf) {
     inputs_.FillWith(nullptr, 0, marshaller.num_args() + 1);
   }
 
@@ -5070,6 +5072,10 @@ class FfiCallInstr : public Definition {
     return !CompilerState::Current().is_aot();
   }
 
+  // Whether the callee is known not to call back into Dart or block. Leaf
+  // calls are invoked without the generated-to-native thread transition.
+  bool is_leaf() const { return is_leaf_; }
+
   virtual bool HasUnknownSideEffects() const { return true; }
 
   // Always creates an exit frame before more Dart code can be called.
@@ -5100,6 +5106,8 @@ class FfiCallInstr : public Definition {
 
   GrowableArray<Value*> inputs_;
 
+  const bool is_leaf_;
+
   DISALLOW_COPY_AND_ASSIGN(FfiCallInstr);
 };
 
@@ -1315,8 +1315,21 @@ void FfiCallInstr::EmitNativeCode(FlowGraphCompiler* compiler) {
   compiler->EmitCallsiteMetadata(TokenPosition::kNoSource, deopt_id(),
                                  PcDescriptorsLayout::Kind::kOther, locs());
 
-  // Update information in the thread object and enter a safepoint.
-  if (CanExecuteGeneratedCodeInSafepoint()) {
+  if (is_leaf()) {
+    // The callee is declared not to call back into Dart or block, so we can
+    // skip the runtime transition: the thread stays in "generated" execution
+    // state and a requested safepoint simply waits for the call to return.
+    // Update the VM tag so the profiler attributes the time to the callee.
+    __ StoreToOffset(kWord, branch, THR,
+                     compiler::target::Thread::vm_tag_offset());
+
+    __ blx(branch);
+
+    __ LoadImmediate(temp, compiler::target::Thread::vm_tag_dart_id());
+    __ StoreToOffset(kWord, temp, THR,
+                     compiler::target::Thread::vm_tag_offset());
+  } else if (CanExecuteGeneratedCodeInSafepoint()) {
+    // Update information in the thread object and enter a safepoint.
     __ LoadImmediate(temp, compiler::target::Thread::exit_through_ffi());
     __ TransitionGeneratedToNative(branch, FPREG, temp, saved_fp,
                                    /*enter_safepoint=*/true);
@@ -1144,7 +1144,27 @@ void FfiCallInstr::EmitNativeCode(FlowGraphCompiler* compiler) {
 
   __ StoreToOffset(temp, FPREG, kSavedCallerPcSlotFromFp * kWordSize);
 
-  if (CanExecuteGeneratedCodeInSafepoint()) {
+  if (is_leaf()) {
+    // The callee is declared not to call back into Dart or block, so we can
+    // skip the runtime transition: the thread stays in "generated" execution
+    // state and a requested safepoint simply waits for the call to return.
+    // Update the VM tag so the profiler attributes the time to the callee.
+    __ StoreToOffset(branch, THR, compiler::target::Thread::vm_tag_offset());
+
+    // We are entering runtime code, so the C stack pointer must be restored
+    // from the stack limit to the top of the stack.
+    __ mov(R25, CSP);
+    __ mov(CSP, SP);
+
+    __ blr(branch);
+
+    // Restore the Dart stack pointer.
+    __ mov(SP, CSP);
+    __ mov(CSP, R25);
+
+    __ LoadImmediate(temp, compiler::target::Thread::vm_tag_dart_id());
+    __ StoreToOffset(temp, THR, compiler::target::Thread::vm_tag_offset());
+  } else if (CanExecuteGeneratedCodeInSafepoint()) {
     // Update information in the thread object and enter a safepoint.
     __ LoadImmediate(temp, compiler::target::Thread::exit_through_ffi());
     __ TransitionGeneratedToNative(branch, FPREG, temp,
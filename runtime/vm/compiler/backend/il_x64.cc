@@ -1075,7 +1075,18 @@ void FfiCallInstr::EmitNativeCode(FlowGraphCompiler* compiler) {
                                  PcDescriptorsLayout::Kind::kOther, locs());
   __ movq(compiler::Address(FPREG, kSavedCallerPcSlotFromFp * kWordSize), TMP);
 
-  if (CanExecuteGeneratedCodeInSafepoint()) {
+  if (is_leaf()) {
+    // The callee is declared not to call back into Dart or block, so we can
+    // skip the runtime transition: the thread stays in "generated" execution
+    // state and a requested safepoint simply waits for the call to return.
+    // Update the VM tag so the profiler attributes the time to the callee.
+    __ movq(compiler::Assembler::VMTagAddress(), target_address);
+
+    __ CallCFunction(target_address, /*restore_rsp=*/true);
+
+    __ movq(compiler::Assembler::VMTagAddress(),
+            compiler::Immediate(compiler::target::Thread::vm_tag_dart_id()));
+  } else if (CanExecuteGeneratedCodeInSafepoint()) {
     // Update information in the thread object and enter a safepoint.
     __ movq(TMP,
             compiler::Immediate(compiler::target::Thread::exit_through_ffi()));
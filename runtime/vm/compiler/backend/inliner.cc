@@ -894,6 +894,13 @@ class CallSiteInliner : public ValueObject {
     }
   }
 
+  // Builds a fresh callee graph for every call site. The graph cannot be
+  // cached and reused: inlining splices it destructively into the caller, and
+  // specialized builds depend on the constant arguments at this particular
+  // site. What is cached instead are the per-function instruction and call
+  // site counts (see CollectGraphInfo), which let the early heuristic below
+  // reject oversized callees without building their graphs again, and the
+  // sticky is_inlinable bit for callees that can never be inlined.
   bool TryInlining(const Function& function,
                    const Array& argument_names,
                    InlinedCallData* call_data,
@@ -970,6 +977,11 @@ class CallSiteInliner : public ValueObject {
     InliningDecision decision =
         ShouldWeInline(function, instruction_count, call_site_count);
     if (!decision.value) {
+      // If size is larger than all thresholds, don't consider it again.
+      if ((instruction_count > FLAG_inlining_size_threshold) &&
+          (call_site_count > FLAG_inlining_callee_call_sites_threshold)) {
+        function.set_is_inlinable(false);
+      }
       TRACE_INLINING(
           THR_Print("     Bailout: early heuristics (%s) with "
                     "code size:  %" Pd ", "
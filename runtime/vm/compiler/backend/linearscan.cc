@@ -2609,6 +2609,16 @@ static inline bool ShouldBeAllocatedBefore(LiveRange* a, LiveRange* b) {
   return a->Start() <= b->Start();
 }
 
+// Orders ranges by descending start position, so that popping from the back
+// of the list yields ranges in order of increasing start position. Ties are
+// broken by virtual register number to keep the order deterministic.
+static int AllocationOrder(LiveRange* const* a, LiveRange* const* b) {
+  if ((*a)->Start() != (*b)->Start()) {
+    return ((*a)->Start() > (*b)->Start()) ? -1 : 1;
+  }
+  return static_cast<int>((*a)->vreg() - (*b)->vreg());
+}
+
 static void AddToSortedListOfRanges(GrowableArray<LiveRange*>* list,
                                     LiveRange* range) {
   range->finger()->Initialize(range);
@@ -2632,13 +2642,17 @@ void FlowGraphAllocator::AddToUnallocated(LiveRange* range) {
 }
 
 void FlowGraphAllocator::CompleteRange(LiveRange* range, Location::Kind kind) {
+  // The lists built here are sorted once in PrepareForAllocation. Inserting
+  // in sorted order as ranges are completed is quadratic in the number of
+  // ranges, which is noticeable on huge mostly-straight-line methods.
+  range->finger()->Initialize(range);
   switch (kind) {
     case Location::kRegister:
-      AddToSortedListOfRanges(&unallocated_cpu_, range);
+      unallocated_cpu_.Add(range);
       break;
 
     case Location::kFpuRegister:
-      AddToSortedListOfRanges(&unallocated_xmm_, range);
+      unallocated_xmm_.Add(range);
       break;
 
     default:
@@ -2677,6 +2691,7 @@ void FlowGraphAllocator::PrepareForAllocation(
   }
   ASSERT(unallocated_.is_empty());
   unallocated_.AddArray(unallocated);
+  unallocated_.Sort(AllocationOrder);
 
   for (intptr_t reg = 0; reg < number_of_registers; reg++) {
     blocked_registers_[reg] = blocked_registers[reg];
@@ -319,6 +319,18 @@ class LoopInfo : public ZoneAllocated {
 };
 
 // Information on the loop hierarchy in the flow graph.
+//
+// Note on auto-vectorization: the induction framework above already provides
+// what a vectorizer needs on the analysis side (unit-stride linear inductions
+// with trip counts via CanComputeBounds, and in-range proofs for typed data
+// accesses via IsInRange). What is missing is IL support on the transform
+// side: LoadIndexed/StoreIndexed on scalar typed data lists produce and
+// consume scalars only, and there are no lane-reinterpreting vector memory
+// operations, so SimdOpInstr kinds can currently be fed only from the
+// explicit dart:typed_data SIMD list classes. A vectorization pass would
+// need such memory instructions (with codegen on every backend) plus a
+// story for safepoints and deoptimization inside vector loops before it
+// could be added to the pipeline.
 class LoopHierarchy : public ZoneAllocated {
  public:
   LoopHierarchy(ZoneGrowableArray<BlockEntryInstr*>* headers,
@@ -3007,19 +3007,21 @@ void IntConverterInstr::InferRange(RangeAnalysis* analysis, Range* range) {
   }
 }
 
-static bool IsRedundantBasedOnRangeInformation(Value* index, Value* length) {
+// Proves that the given index definition is within [0, length) using the
+// range assigned to it by range analysis.
+static bool IsDefinitionInBounds(Definition* index, Value* length) {
   // Range of the index is unknown can't decide if the check is redundant.
-  Range* index_range = index->definition()->range();
+  Range* index_range = index->range();
   if (index_range == nullptr) {
-    if (!(index->BindsToConstant() &&
-          compiler::target::IsSmi(index->BoundConstant()))) {
+    if (!(index->IsConstant() &&
+          compiler::target::IsSmi(index->AsConstant()->value()))) {
       return false;
     }
     Range range;
-    index->definition()->InferRange(nullptr, &range);
+    index->InferRange(nullptr, &range);
     ASSERT(!Range::IsUnknown(&range));
-    index->definition()->set_range(range);
-    index_range = index->definition()->range();
+    index->set_range(range);
+    index_range = index->range();
   }
 
   // Range of the index is not positive. Check can't be redundant.
@@ -3027,7 +3029,7 @@ static bool IsRedundantBasedOnRangeInformation(Value* index, Value* length) {
     return false;
   }
 
-  RangeBoundary max = RangeBoundary::FromDefinition(index->definition());
+  RangeBoundary max = RangeBoundary::FromDefinition(index);
   RangeBoundary max_upper = max.UpperBound();
   RangeBoundary array_length =
       RangeBoundary::FromDefinition(length->definition());
@@ -3059,6 +3061,29 @@ static bool IsRedundantBasedOnRangeInformation(Value* index, Value* length) {
   return false;
 }
 
+static bool IsRedundantBasedOnRangeInformation(Value* index, Value* length) {
+  if (IsDefinitionInBounds(index->definition(), length)) {
+    return true;
+  }
+  // Joining ranges at a phi generalizes symbolic boundaries away, so a phi
+  // can fail the direct proof above even when every one of its inputs is
+  // provably in bounds. A value that is in bounds on every path into the
+  // phi is in bounds at the phi itself, so check the inputs individually.
+  // Inputs that are themselves phis are rejected to keep this linear
+  // (loop phis feed back into themselves).
+  PhiInstr* phi = index->definition()->AsPhi();
+  if (phi != nullptr) {
+    for (intptr_t i = 0, n = phi->InputCount(); i < n; i++) {
+      Definition* input = phi->InputAt(i)->definition();
+      if (input->IsPhi() || !IsDefinitionInBounds(input, length)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  return false;
+}
+
 bool CheckBoundBase::IsRedundant(bool use_loops) {
   // First, try to prove redundancy with the results of range analysis.
   if (IsRedundantBasedOnRangeInformation(index(), length())) {
@@ -3134,6 +3134,13 @@ static bool IsSafeUse(Value* use, SafeUseCheck check_type) {
 // Right now we are attempting to sink allocation only into
 // deoptimization exit. So candidate should only be used in StoreInstanceField
 // instructions that write into fields of the allocated object.
+//
+// TODO: support partial escape analysis: a use at a call or another
+// escaping instruction should not disqualify the candidate outright, but
+// instead force a materialization (as MaterializeObject already models for
+// deoptimization exits) on the escaping path only, keeping the allocation
+// sunk on paths where it never escapes. This requires splitting the sunk
+// state per path and rewiring dominated uses to the materialized object.
 static bool IsAllocationSinkingCandidate(Definition* alloc,
                                          SafeUseCheck check_type) {
   for (Value* use = alloc->input_use_list(); use != NULL;
@@ -71,6 +71,8 @@ class CallSpecializer : public FlowGraphVisitor {
   // specialization of calls. They are here for historical reasons.
   // Find a better place for them.
   virtual void VisitLoadCodeUnits(LoadCodeUnitsInstr* instr);
+  virtual void VisitAllocateContext(AllocateContextInstr* instr);
+  virtual void VisitCloneContext(CloneContextInstr* instr);
 
  protected:
   Thread* thread() const { return flow_graph_->thread(); }
@@ -121,6 +123,14 @@ class CallSpecializer : public FlowGraphVisitor {
 
   virtual bool TryOptimizeStaticCallUsingStaticTypes(StaticCallInstr* call) = 0;
 
+  // Lowers a generic context allocation or clone into an inlined allocation
+  // followed by explicit initializing stores, making it visible to allocation
+  // sinking and load forwarding.
+  void LowerContextAllocation(
+      Definition* instr,
+      const ZoneGrowableArray<const Slot*>& context_variables,
+      Value* context_value);
+
  protected:
   void InlineImplicitInstanceGetter(Definition* call, const Field& field);
 
@@ -221,6 +221,12 @@ void CompilerPass::PrintGraph(CompilerPassState* state,
   }
 }
 
+// The pipelines below are strictly sequential by design: every pass reads
+// and mutates the one flow graph in the state, including passes that look
+// like pure analyses (range analysis annotates instructions, try-catch and
+// write-barrier passes rewrite them), and the graph lives in the compiling
+// thread's zone. Compile latency is instead hidden by compiling whole
+// functions concurrently on the background compiler's task pool.
 #define INVOKE_PASS(Name)                                                      \
   CompilerPass::Get(CompilerPass::k##Name)->Run(pass_state);
 
@@ -15,7 +15,8 @@ namespace ffi {
 
 // TODO(dartbug.com/36607): Cache the trampolines.
 FunctionPtr TrampolineFunction(const Function& dart_signature,
-                               const Function& c_signature) {
+                               const Function& c_signature,
+                               bool is_leaf) {
   Thread* thread = Thread::Current();
   Zone* zone = thread->zone();
   String& name = String::Handle(zone, Symbols::New(thread, "FfiTrampoline"));
@@ -50,6 +51,7 @@ FunctionPtr TrampolineFunction(const Function& dart_signature,
   }
   function.TruncateUnusedParameterFlags();
   function.SetFfiCSignature(c_signature);
+  function.SetFfiIsLeaf(is_leaf);
 
   Type& type = Type::Handle(zone);
   type ^= function.SignatureType(Nullability::kLegacy);
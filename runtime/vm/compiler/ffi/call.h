@@ -20,7 +20,8 @@ namespace compiler {
 namespace ffi {
 
 FunctionPtr TrampolineFunction(const Function& dart_signature,
-                               const Function& c_signature);
+                               const Function& c_signature,
+                               bool is_leaf);
 
 }  // namespace ffi
 
@@ -4,6 +4,8 @@
 
 #include "vm/compiler/ffi/callback.h"
 
+#include "vm/canonical_tables.h"
+#include "vm/object_store.h"
 #include "vm/symbols.h"
 
 namespace dart {
@@ -16,12 +18,29 @@ FunctionPtr NativeCallbackFunction(const Function& c_signature,
                                    const Function& dart_target,
                                    const Instance& exceptional_return) {
   Thread* const thread = Thread::Current();
+  Zone* const zone = thread->zone();
+  auto* const object_store = thread->isolate()->object_store();
+
+  // Multiple compilations of the same `Pointer.fromFunction` call site (and
+  // different call sites registering the same target) reuse a single callback
+  // function - and with it a single callback ID and trampoline slot - instead
+  // of allocating new ones each time.
+  if (object_store->ffi_callback_functions() != Array::null()) {
+    FfiCallbackFunctionSet set(zone, object_store->ffi_callback_functions());
+    Function& existing = Function::Handle(zone);
+    existing ^= set.GetOrNull(
+        FfiCallbackFunctionKey(c_signature, dart_target, exceptional_return));
+    set.Release();
+    if (!existing.IsNull()) {
+      return existing.raw();
+    }
+  }
+
   const int32_t callback_id = thread->AllocateFfiCallbackId();
 
   // Create a new Function named '<target>_FfiCallback' and stick it in the
   // 'dart:ffi' library. Note that these functions will never be invoked by
   // Dart, so they have may have duplicate names.
-  Zone* const zone = thread->zone();
   const auto& name = String::Handle(
       zone, Symbols::FromConcat(thread, Symbols::FfiCallback(),
                                 String::Handle(zone, dart_target.name())));
@@ -61,6 +80,19 @@ FunctionPtr NativeCallbackFunction(const Function& c_signature,
     function.SetFfiCallbackExceptionalReturn(exceptional_return);
   }
 
+  // Add the new callback to the pool so later lookups find it. The table is
+  // also used to keep the callback functions alive, since they are not
+  // necessarily reachable from any class (see ProgramVisitor::WalkProgram).
+  Array& storage = Array::Handle(zone, object_store->ffi_callback_functions());
+  if (storage.IsNull()) {
+    storage = HashTables::New<FfiCallbackFunctionSet>(/*initial_capacity=*/4,
+                                                      Heap::kOld);
+  }
+  FfiCallbackFunctionSet set(zone, storage.raw());
+  const bool already_present = set.Insert(function);
+  ASSERT(!already_present);
+  object_store->set_ffi_callback_functions(set.Release());
+
   return function.raw();
 }
 
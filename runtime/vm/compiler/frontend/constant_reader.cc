@@ -17,7 +17,8 @@ ConstantReader::ConstantReader(KernelReaderHelper* helper,
       translation_helper_(helper->translation_helper_),
       active_class_(active_class),
       script_(helper->script()),
-      result_(Instance::Handle(zone_)) {}
+      result_(Instance::Handle(zone_)),
+      cache_(zone_) {}
 
 InstancePtr ConstantReader::ReadConstantInitializer() {
   Tag tag = helper_->ReadTag();  // read tag.
@@ -74,6 +75,15 @@ InstancePtr ConstantReader::ReadConstant(intptr_t constant_offset) {
   ASSERT(!H.constants().IsNull());
   ASSERT(!H.constants_table().IsNull());  // raw bytes
 
+  // A constant can be used several times in the compilation this reader
+  // serves (directly or as a sub-constant), so consult the local cache first
+  // to avoid taking the isolate-wide lock below again.
+  const Instance* cached = cache_.LookupValue(constant_offset);
+  if (cached != nullptr) {
+    result_ = cached->raw();
+    return result_.raw();
+  }
+
   // For kernel-level cache (in contrast with script-level caching),
   // we need to access the raw constants array inside the shared
   // KernelProgramInfo directly, so that all scripts will see the
@@ -96,6 +106,7 @@ InstancePtr ConstantReader::ReadConstant(intptr_t constant_offset) {
     ASSERT(insert == result_.raw());
     H.info().set_constants(constant_map.Release());  // update!
   }
+  cache_.Insert(constant_offset, &Instance::ZoneHandle(Z, result_.raw()));
   return result_.raw();
 }
 
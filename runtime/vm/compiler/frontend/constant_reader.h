@@ -10,6 +10,7 @@
 #endif  // defined(DART_PRECOMPILED_RUNTIME)
 
 #include "vm/compiler/frontend/kernel_translation_helper.h"
+#include "vm/hash_map.h"
 #include "vm/hash_table.h"
 #include "vm/object.h"
 
@@ -44,6 +45,10 @@ class ConstantReader {
   ActiveClass* active_class_;
   const Script& script_;
   Instance& result_;
+  // Caches constants resolved during this compilation, so repeated uses of
+  // a constant do not take the isolate-wide lock protecting the shared
+  // constant table again.
+  IntMap<const Instance*> cache_;
 
   DISALLOW_COPY_AND_ASSIGN(ConstantReader);
 };
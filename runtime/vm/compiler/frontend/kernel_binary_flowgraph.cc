@@ -1737,6 +1737,11 @@ Fragment StreamingFlowGraphBuilder::StringInterpolateSingle(
   return flow_graph_builder_->StringInterpolateSingle(position);
 }
 
+Fragment StreamingFlowGraphBuilder::StringInterpolate2(
+    TokenPosition position) {
+  return flow_graph_builder_->StringInterpolate2(position);
+}
+
 Fragment StreamingFlowGraphBuilder::ThrowTypeError() {
   return flow_graph_builder_->ThrowTypeError();
 }
@@ -3427,6 +3432,23 @@ Fragment StreamingFlowGraphBuilder::BuildStringConcatenation(TokenPosition* p) {
     return instructions;
   }
 
+  if (collector.pieces.length() == 2) {
+    // The common "prefix$expr" shape: convert and concatenate the two
+    // pieces directly, which measures both once and copies into a single
+    // allocation, skipping the argument array _interpolate requires.
+    Fragment instructions;
+    for (intptr_t i = 0; i < 2; ++i) {
+      if (collector.pieces[i].literal != nullptr) {
+        instructions += Constant(*collector.pieces[i].literal);
+      } else {
+        AlternativeReadingScope scope(&reader_, collector.pieces[i].offset);
+        instructions += BuildExpression();
+      }
+    }
+    instructions += StringInterpolate2(position);
+    return instructions;
+  }
+
   Fragment instructions;
   instructions += Constant(TypeArguments::ZoneHandle(Z));
   instructions += IntConstant(collector.pieces.length());
@@ -5054,7 +5076,7 @@ Fragment StreamingFlowGraphBuilder::BuildFunctionNode(
 
 Fragment StreamingFlowGraphBuilder::BuildFfiAsFunctionInternal() {
   const intptr_t argc = ReadUInt();               // read argument count.
-  ASSERT(argc == 1);                              // pointer
+  ASSERT(argc == 2);                              // pointer, isLeaf
   const intptr_t list_length = ReadListLength();  // read types list length.
   ASSERT(list_length == 2);  // dart signature, then native signature
   const TypeArguments& type_arguments =
@@ -5062,12 +5084,22 @@ Fragment StreamingFlowGraphBuilder::BuildFfiAsFunctionInternal() {
   Fragment code;
   const intptr_t positional_count =
       ReadListLength();  // read positional argument count
-  ASSERT(positional_count == 1);
+  ASSERT(positional_count == 2);
   code += BuildExpression();  // build first positional argument (pointer)
+
+  // Build second positional argument (isLeaf). The FE ensures it is a
+  // constant boolean.
+  code += BuildExpression();
+  Definition* is_leaf_def = B->Peek();
+  ASSERT(is_leaf_def->IsConstant());
+  const bool is_leaf =
+      Bool::Cast(is_leaf_def->AsConstant()->value()).value();
+  code += Drop();
+
   const intptr_t named_args_len =
       ReadListLength();  // skip (empty) named arguments list
   ASSERT(named_args_len == 0);
-  code += B->BuildFfiAsFunctionInternalCall(type_arguments);
+  code += B->BuildFfiAsFunctionInternalCall(type_arguments, is_leaf);
   return code;
 }
 
@@ -5118,19 +5150,14 @@ Fragment StreamingFlowGraphBuilder::BuildFfiNativeCallbackFunction() {
       ReadListLength();  // skip (empty) named arguments list
   ASSERT(named_args_len == 0);
 
+  // This also registers the callback in the object store's table of FFI
+  // callback functions, which keeps it alive and allows later compilations of
+  // this call site to reuse it.
   const Function& result =
       Function::ZoneHandle(Z, compiler::ffi::NativeCallbackFunction(
                                   native_sig, target, exceptional_return));
   code += Constant(result);
 
-  auto& ffi_callback_functions = GrowableObjectArray::Handle(Z);
-  ffi_callback_functions ^= I->object_store()->ffi_callback_functions();
-  if (ffi_callback_functions.IsNull()) {
-    ffi_callback_functions ^= GrowableObjectArray::New();
-    I->object_store()->set_ffi_callback_functions(ffi_callback_functions);
-  }
-  ffi_callback_functions.Add(result);
-
   return code;
 }
 
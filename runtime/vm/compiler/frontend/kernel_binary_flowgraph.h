@@ -221,6 +221,7 @@ class StreamingFlowGraphBuilder : public KernelReaderHelper {
   Fragment StoreStaticField(TokenPosition position, const Field& field);
   Fragment StringInterpolate(TokenPosition position);
   Fragment StringInterpolateSingle(TokenPosition position);
+  Fragment StringInterpolate2(TokenPosition position);
   Fragment ThrowTypeError();
   Fragment ThrowLateInitializationError(TokenPosition position,
                                         const String& name);
@@ -76,8 +76,7 @@ ISOLATE_UNIT_TEST_CASE(StreamingFlowGraphBuilder_FlattenNestedStringInterp) {
   auto entry = flow_graph->graph_entry()->normal_entry();
   EXPECT(entry != nullptr);
 
-  StoreIndexedInstr* store1 = nullptr;
-  StoreIndexedInstr* store2 = nullptr;
+  StaticCallInstr* call = nullptr;
 
   ILMatcher cursor(flow_graph, entry);
   // clang-format off
@@ -85,30 +84,21 @@ ISOLATE_UNIT_TEST_CASE(StreamingFlowGraphBuilder_FlattenNestedStringInterp) {
     kMatchAndMoveFunctionEntry,
     kMatchAndMoveCheckStackOverflow,
     kMoveDebugStepChecks,
-    kMatchAndMoveCreateArray,
-    {kMatchAndMoveStoreIndexed, &store1},
-    {kMatchAndMoveStoreIndexed, &store2},
-    kMatchAndMoveStringInterpolate,
+    {kMatchAndMoveStaticCall, &call},
     kMoveDebugStepChecks,
     kMatchReturn,
   }));
   // clang-format on
 
-  // StoreIndexed(tmp_array, 0, s)
-  EXPECT(store1->index()->BindsToConstant());
-  EXPECT(store1->index()->BoundConstant().IsInteger());
-  EXPECT(Integer::Cast(store1->index()->BoundConstant()).AsInt64Value() == 0);
-
-  EXPECT(!store1->value()->BindsToConstant());
+  // The flattened two-piece concatenation lowers to _interpolate2(s, "de").
+  EXPECT(call->function().name() == Symbols::Interpolate2().raw());
+  EXPECT(call->ArgumentCount() == 2);
 
-  // StoreIndexed(tmp_array, 1, "de")
-  EXPECT(store2->index()->BindsToConstant());
-  EXPECT(store2->index()->BoundConstant().IsInteger());
-  EXPECT(Integer::Cast(store2->index()->BoundConstant()).AsInt64Value() == 1);
+  EXPECT(!call->ArgumentValueAt(0)->BindsToConstant());
 
-  EXPECT(store2->value()->BindsToConstant());
-  EXPECT(store2->value()->BoundConstant().IsString());
-  EXPECT(String::Cast(store2->value()->BoundConstant()).Equals("de"));
+  EXPECT(call->ArgumentValueAt(1)->BindsToConstant());
+  EXPECT(call->ArgumentValueAt(1)->BoundConstant().IsString());
+  EXPECT(String::Cast(call->ArgumentValueAt(1)->BoundConstant()).Equals("de"));
 }
 
 ISOLATE_UNIT_TEST_CASE(StreamingFlowGraphBuilder_DropEmptyStringInterp) {
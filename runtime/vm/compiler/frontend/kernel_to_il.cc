@@ -375,11 +375,12 @@ Fragment FlowGraphBuilder::InstanceCall(
 }
 
 Fragment FlowGraphBuilder::FfiCall(
-    const compiler::ffi::CallMarshaller& marshaller) {
+    const compiler::ffi::CallMarshaller& marshaller,
+    bool is_leaf) {
   Fragment body;
 
   FfiCallInstr* const call =
-      new (Z) FfiCallInstr(Z, GetNextDeoptId(), marshaller);
+      new (Z) FfiCallInstr(Z, GetNextDeoptId(), marshaller, is_leaf);
 
   for (intptr_t i = call->InputCount() - 1; i >= 0; --i) {
     call->SetInputAt(i, Pop());
@@ -630,6 +631,23 @@ Fragment FlowGraphBuilder::StringInterpolateSingle(TokenPosition position) {
   return instructions;
 }
 
+Fragment FlowGraphBuilder::StringInterpolate2(TokenPosition position) {
+  const int kTypeArgsLen = 0;
+  const int kNumberOfArguments = 2;
+  const Array& kNoArgumentNames = Object::null_array();
+  const Class& cls =
+      Class::Handle(Library::LookupCoreClass(Symbols::StringBase()));
+  ASSERT(!cls.IsNull());
+  const Function& function = Function::ZoneHandle(
+      Z, Resolver::ResolveStatic(
+             cls, Library::PrivateCoreLibName(Symbols::Interpolate2()),
+             kTypeArgsLen, kNumberOfArguments, kNoArgumentNames));
+  Fragment instructions;
+  instructions +=
+      StaticCall(position, function, /* argument_count = */ 2, ICData::kStatic);
+  return instructions;
+}
+
 Fragment FlowGraphBuilder::ThrowTypeError() {
   const Class& klass =
       Class::ZoneHandle(Z, Library::LookupCoreClass(Symbols::TypeError()));
@@ -849,6 +867,11 @@ bool FlowGraphBuilder::IsRecognizedMethodForFlowGraph(
     case MethodRecognizer::kListFactory:
     case MethodRecognizer::kObjectArrayAllocate:
     case MethodRecognizer::kCopyRangeFromUint8ListToOneByteString:
+    case MethodRecognizer::kTypedData_memMove1:
+    case MethodRecognizer::kTypedData_memMove2:
+    case MethodRecognizer::kTypedData_memMove4:
+    case MethodRecognizer::kTypedData_memMove8:
+    case MethodRecognizer::kTypedData_memMove16:
     case MethodRecognizer::kLinkedHashMap_getIndex:
     case MethodRecognizer::kLinkedHashMap_setIndex:
     case MethodRecognizer::kLinkedHashMap_getData:
@@ -1140,6 +1163,24 @@ FlowGraph* FlowGraphBuilder::BuildGraphOfRecognizedMethod(
       body += MemoryCopy(kTypedDataUint8ArrayCid, kOneByteStringCid);
       body += NullConstant();
       break;
+    case MethodRecognizer::kTypedData_memMove1:
+      // Pick a representative typed data cid based on the element size of the
+      // copy: the arguments may be any (internal, view or external) typed
+      // data objects, the cids are only used to determine the element size.
+      body += BuildTypedDataMemMove(function, kTypedDataUint8ArrayCid);
+      break;
+    case MethodRecognizer::kTypedData_memMove2:
+      body += BuildTypedDataMemMove(function, kTypedDataUint16ArrayCid);
+      break;
+    case MethodRecognizer::kTypedData_memMove4:
+      body += BuildTypedDataMemMove(function, kTypedDataUint32ArrayCid);
+      break;
+    case MethodRecognizer::kTypedData_memMove8:
+      body += BuildTypedDataMemMove(function, kTypedDataUint64ArrayCid);
+      break;
+    case MethodRecognizer::kTypedData_memMove16:
+      body += BuildTypedDataMemMove(function, kTypedDataInt32x4ArrayCid);
+      break;
     case MethodRecognizer::kLinkedHashMap_getIndex:
       ASSERT(function.NumParameters() == 1);
       body += LoadLocal(parsed_function_->RawParameterVariable(0));
@@ -1523,6 +1564,21 @@ Fragment FlowGraphBuilder::BuildTypedDataFactoryConstructor(
   return instructions;
 }
 
+Fragment FlowGraphBuilder::BuildTypedDataMemMove(const Function& function,
+                                                 classid_t cid) {
+  ASSERT(function.NumParameters() == 5);
+
+  Fragment body;
+  body += LoadLocal(parsed_function_->RawParameterVariable(0));  // from
+  body += LoadLocal(parsed_function_->RawParameterVariable(1));  // to
+  body += LoadLocal(parsed_function_->RawParameterVariable(2));  // fromStart
+  body += LoadLocal(parsed_function_->RawParameterVariable(3));  // toStart
+  body += LoadLocal(parsed_function_->RawParameterVariable(4));  // count
+  body += MemoryCopy(cid, cid);
+  body += NullConstant();
+  return body;
+}
+
 static const LocalScope* MakeImplicitClosureScope(Zone* Z, const Class& klass) {
   ASSERT(!klass.IsNull());
   // Note that if klass is _Closure, DeclarationType will be _Closure,
@@ -3736,6 +3792,17 @@ FlowGraph* FlowGraphBuilder::BuildGraphOfFfiNative(const Function& function) {
   const auto& marshaller = *new (Z) compiler::ffi::CallMarshaller(Z, function);
 
   const bool signature_contains_handles = marshaller.ContainsHandles();
+  const bool is_leaf = function.FfiIsLeaf();
+
+  // Leaf calls skip the runtime transition, so the native code must not use
+  // the Dart API, which rules out passing or returning handles.
+  if (is_leaf && signature_contains_handles) {
+    const Script& script = Script::Handle(Z, function.script());
+    Report::MessageF(Report::kError, script, function.token_pos(),
+                     Report::AtLocation,
+                     "FFI leaf call must not have Handle arguments or return "
+                     "type.");
+  }
 
   ASSERT(function.CanReceiveDynamicInvocation());
   BuildTypeArgumentTypeChecks(TypeChecksToBuild::kCheckAllTypeParameterBounds,
@@ -3796,7 +3863,7 @@ FlowGraph* FlowGraphBuilder::BuildGraphOfFfiNative(const Function& function) {
   // This can only be Pointer, so it is always safe to LoadUntagged.
   body += LoadUntagged(compiler::target::Pointer::data_field_offset());
   body += ConvertUntaggedToUnboxed(kUnboxedFfiIntPtr);
-  body += FfiCall(marshaller);
+  body += FfiCall(marshaller, is_leaf);
 
   for (intptr_t i = 0; i < marshaller.num_args(); i++) {
     if (marshaller.IsPointer(i)) {
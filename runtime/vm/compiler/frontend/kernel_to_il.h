@@ -139,6 +139,7 @@ class FlowGraphBuilder : public BaseFlowGraphBuilder {
                                                 classid_t cid);
   Fragment BuildTypedDataFactoryConstructor(const Function& function,
                                             classid_t cid);
+  Fragment BuildTypedDataMemMove(const Function& function, classid_t cid);
 
   Fragment EnterScope(intptr_t kernel_offset,
                       const LocalScope** scope = nullptr);
@@ -177,7 +178,8 @@ class FlowGraphBuilder : public BaseFlowGraphBuilder {
       const CallSiteAttributesMetadata* call_site_attrs = nullptr,
       bool receiver_is_not_smi = false);
 
-  Fragment FfiCall(const compiler::ffi::CallMarshaller& marshaller);
+  Fragment FfiCall(const compiler::ffi::CallMarshaller& marshaller,
+                   bool is_leaf);
 
   Fragment ThrowException(TokenPosition position);
   Fragment RethrowException(TokenPosition position, int catch_try_index);
@@ -207,6 +209,7 @@ class FlowGraphBuilder : public BaseFlowGraphBuilder {
                       intptr_t type_args_len = 0,
                       bool use_unchecked_entry = false);
   Fragment StringInterpolateSingle(TokenPosition position);
+  Fragment StringInterpolate2(TokenPosition position);
   Fragment ThrowTypeError();
   Fragment ThrowNoSuchMethodError(const Function& target);
   Fragment ThrowLateInitializationError(TokenPosition position,
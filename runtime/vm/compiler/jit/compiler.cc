@@ -30,6 +30,7 @@
 #include "vm/deopt_instructions.h"
 #include "vm/exceptions.h"
 #include "vm/flags.h"
+#include "vm/json_stream.h"
 #include "vm/kernel.h"
 #include "vm/longjump.h"
 #include "vm/object.h"
@@ -53,6 +54,11 @@ DEFINE_FLAG(
     max_deoptimization_counter_threshold,
     16,
     "How many times we allow deoptimization before we disallow optimization.");
+DEFINE_FLAG(int,
+            max_background_compiler_tasks,
+            2,
+            "Maximum number of tasks processing the background compilation "
+            "queue concurrently.");
 DEFINE_FLAG(charp, optimization_filter, NULL, "Optimize only named function");
 DEFINE_FLAG(bool, print_flow_graph, false, "Print the IR flow graph.");
 DEFINE_FLAG(bool,
@@ -488,6 +494,13 @@ CodePtr CompileParsedFunctionHelper::Compile(CompilationPipeline* pipeline) {
   Zone* const zone = thread()->zone();
   HANDLESCOPE(thread());
 
+#if !defined(PRODUCT)
+  // Set once before the setjmp below, so safe to read after a longjmp.
+  const int64_t compile_start_micros = OS::GetCurrentMonotonicMicros();
+  const int64_t compile_start_cpu_micros = OS::GetCurrentThreadCPUMicros();
+  const intptr_t zone_bytes_before = zone->SizeInBytes();
+#endif
+
   // We may reattempt compilation if the function needs to be assembled using
   // far branches on ARM. In the else branch of the setjmp call, done is set to
   // false, and use_far_branches is set to true if there is a longjmp from the
@@ -690,6 +703,23 @@ CodePtr CompileParsedFunctionHelper::Compile(CompilationPipeline* pipeline) {
       }
     }
   }
+
+#if !defined(PRODUCT)
+  const int64_t wall_micros =
+      OS::GetCurrentMonotonicMicros() - compile_start_micros;
+  const int64_t compile_end_cpu_micros = OS::GetCurrentThreadCPUMicros();
+  const int64_t cpu_micros =
+      ((compile_end_cpu_micros < 0) || (compile_start_cpu_micros < 0))
+          ? -1
+          : compile_end_cpu_micros - compile_start_cpu_micros;
+  isolate()->GetCompileTimeMetric()->Record(wall_micros);
+  if (isolate()->compile_ledger() != nullptr) {
+    isolate()->compile_ledger()->Record(
+        function, optimized(), wall_micros, cpu_micros,
+        zone->SizeInBytes() - zone_bytes_before);
+  }
+#endif
+
   return result->raw();
 }
 
@@ -1010,8 +1040,8 @@ void Compiler::AbortBackgroundCompilation(intptr_t deopt_id, const char* msg) {
 // C-heap allocated background compilation queue element.
 class QueueElement {
  public:
-  explicit QueueElement(const Function& function)
-      : next_(NULL), function_(function.raw()) {}
+  QueueElement(const Function& function, intptr_t priority)
+      : next_(NULL), function_(function.raw()), priority_(priority) {}
 
   virtual ~QueueElement() {
     next_ = NULL;
@@ -1019,6 +1049,7 @@ class QueueElement {
   }
 
   FunctionPtr Function() const { return function_; }
+  intptr_t priority() const { return priority_; }
 
   void set_next(QueueElement* elem) { next_ = elem; }
   QueueElement* next() const { return next_; }
@@ -1029,12 +1060,16 @@ class QueueElement {
  private:
   QueueElement* next_;
   FunctionPtr function_;
+  intptr_t priority_;
 
   DISALLOW_COPY_AND_ASSIGN(QueueElement);
 };
 
 // Allocated in C-heap. Handles both input and output of background compilation.
-// It implements a FIFO queue, using Peek, Add, Remove operations.
+// It implements a priority queue: Remove returns the pending function with the
+// highest usage count first, so the hottest call sites are compiled before
+// functions that barely crossed the optimization threshold. Elements with
+// equal priority keep their insertion order.
 class BackgroundCompilationQueue {
  public:
   BackgroundCompilationQueue() : first_(NULL), last_(NULL) {}
@@ -1055,14 +1090,26 @@ class BackgroundCompilationQueue {
     ASSERT(value != NULL);
     ASSERT(value->next() == NULL);
     if (first_ == NULL) {
-      first_ = value;
       ASSERT(last_ == NULL);
-    } else {
-      ASSERT(last_ != NULL);
-      last_->set_next(value);
+      first_ = last_ = value;
+      return;
+    }
+    ASSERT(last_ != NULL);
+    if (value->priority() > first_->priority()) {
+      value->set_next(first_);
+      first_ = value;
+      return;
+    }
+    QueueElement* p = first_;
+    while ((p->next() != NULL) &&
+           (p->next()->priority() >= value->priority())) {
+      p = p->next();
+    }
+    value->set_next(p->next());
+    p->set_next(value);
+    if (value->next() == NULL) {
+      last_ = value;
     }
-    last_ = value;
-    ASSERT(first_ != NULL && last_ != NULL);
   }
 
   QueueElement* Peek() const { return first_; }
@@ -1112,13 +1159,83 @@ class BackgroundCompilationQueue {
   DISALLOW_COPY_AND_ASSIGN(BackgroundCompilationQueue);
 };
 
+#if !defined(PRODUCT)
+CompileLedger::CompileLedger()
+    : mutex_(),
+      next_(0),
+      total_count_(0),
+      total_wall_micros_(0),
+      total_cpu_micros_(0),
+      total_zone_bytes_(0) {
+  memset(entries_, 0, sizeof(entries_));
+}
+
+CompileLedger::~CompileLedger() {
+  for (intptr_t i = 0; i < kCapacity; i++) {
+    free(entries_[i].name);
+  }
+}
+
+void CompileLedger::Record(const Function& function,
+                           bool optimized,
+                           int64_t wall_micros,
+                           int64_t cpu_micros,
+                           intptr_t zone_bytes) {
+  // Build the name outside the lock; it allocates in the current zone.
+  char* name = strdup(function.ToFullyQualifiedCString());
+  MutexLocker ml(&mutex_);
+  Entry& entry = entries_[next_];
+  free(entry.name);
+  entry.name = name;
+  entry.optimized = optimized;
+  entry.timestamp_micros = OS::GetCurrentTimeMicros();
+  entry.wall_micros = wall_micros;
+  entry.cpu_micros = cpu_micros;
+  entry.zone_bytes = zone_bytes;
+  entry.deopt_count = function.deoptimization_counter();
+  next_ = (next_ + 1) % kCapacity;
+  total_count_++;
+  total_wall_micros_ += wall_micros;
+  if (cpu_micros > 0) {
+    total_cpu_micros_ += cpu_micros;
+  }
+  total_zone_bytes_ += zone_bytes;
+}
+
+void CompileLedger::PrintJSON(JSONStream* stream) const {
+  MutexLocker ml(&mutex_);
+  JSONObject jsobj(stream);
+  jsobj.AddProperty("type", "CompilationLedger");
+  jsobj.AddProperty64("totalCompilations", total_count_);
+  jsobj.AddProperty64("totalWallTimeMicros", total_wall_micros_);
+  jsobj.AddProperty64("totalCpuTimeMicros", total_cpu_micros_);
+  jsobj.AddProperty64("totalZoneBytes", total_zone_bytes_);
+  JSONArray compilations(&jsobj, "compilations");
+  // Walk the ring oldest to newest.
+  for (intptr_t i = 0; i < kCapacity; i++) {
+    const Entry& entry = entries_[(next_ + i) % kCapacity];
+    if (entry.name == NULL) {
+      continue;
+    }
+    JSONObject jsentry(&compilations);
+    jsentry.AddProperty("function", entry.name);
+    jsentry.AddProperty("optimized", entry.optimized);
+    jsentry.AddProperty64("timestamp", entry.timestamp_micros);
+    jsentry.AddProperty64("wallTimeMicros", entry.wall_micros);
+    jsentry.AddProperty64("cpuTimeMicros", entry.cpu_micros);
+    jsentry.AddProperty64("zoneBytes", entry.zone_bytes);
+    jsentry.AddProperty64("deoptCount", entry.deopt_count);
+  }
+}
+#endif  // !defined(PRODUCT)
+
 BackgroundCompiler::BackgroundCompiler(Isolate* isolate, bool optimizing)
     : isolate_(isolate),
       queue_monitor_(),
       function_queue_(new BackgroundCompilationQueue()),
       done_monitor_(),
       running_(false),
-      done_(true),
+      num_running_(0),
       optimizing_(optimizing),
       disabled_depth_(0) {}
 
@@ -1128,7 +1245,7 @@ BackgroundCompiler::~BackgroundCompiler() {
 }
 
 void BackgroundCompiler::Run() {
-  while (running_) {
+  while (true) {
     // Maybe something is already in the queue, check first before waiting
     // to be notified.
     bool result = Thread::EnterIsolateAsHelper(isolate_, Thread::kCompilerTask);
@@ -1139,10 +1256,17 @@ void BackgroundCompiler::Run() {
       Zone* zone = stack_zone.GetZone();
       HANDLESCOPE(thread);
       Function& function = Function::Handle(zone);
+      intptr_t priority = 0;
       {
+        // Take ownership of the highest-priority element. The function stays
+        // reachable through this task's handle, which the GC visits like any
+        // other thread's handles.
         MonitorLocker ml(&queue_monitor_);
-        if (running_) {
-          function = function_queue()->PeekFunction();
+        if (running_ && !function_queue()->IsEmpty()) {
+          QueueElement* qelem = function_queue()->Remove();
+          function = qelem->Function();
+          priority = qelem->priority();
+          delete qelem;
         }
       }
       while (!function.IsNull()) {
@@ -1150,31 +1274,30 @@ void BackgroundCompiler::Run() {
         Compiler::CompileOptimizedFunction(thread, function,
                                            Compiler::kNoOSRDeoptId);
 
-        QueueElement* qelem = NULL;
         {
           MonitorLocker ml(&queue_monitor_);
-          if (!running_ || function_queue()->IsEmpty()) {
-            // We are shutting down, queue was cleared.
-            function = Function::null();
-          } else {
-            qelem = function_queue()->Remove();
-            const Function& old = Function::Handle(qelem->Function());
+          if (running_) {
             // If an optimizable method is not optimized, put it back on
             // the background queue (unless it was passed to foreground).
-            if ((is_optimizing() && !old.HasOptimizedCode() &&
-                 old.IsOptimizable()) ||
+            if ((is_optimizing() && !function.HasOptimizedCode() &&
+                 function.IsOptimizable()) ||
                 FLAG_stress_test_background_compilation) {
-              if (old.is_background_optimizable() &&
-                  Compiler::CanOptimizeFunction(thread, old)) {
-                QueueElement* repeat_qelem = new QueueElement(old);
+              if (function.is_background_optimizable() &&
+                  Compiler::CanOptimizeFunction(thread, function) &&
+                  !function_queue()->ContainsObj(function)) {
+                QueueElement* repeat_qelem = new QueueElement(function,
+                                                              priority);
                 function_queue()->Add(repeat_qelem);
               }
             }
-            function = function_queue()->PeekFunction();
           }
-        }
-        if (qelem != NULL) {
-          delete qelem;
+          function = Function::null();
+          if (running_ && !function_queue()->IsEmpty()) {
+            QueueElement* qelem = function_queue()->Remove();
+            function = qelem->Function();
+            priority = qelem->priority();
+            delete qelem;
+          }
         }
       }
     }
@@ -1185,25 +1308,41 @@ void BackgroundCompiler::Run() {
       while (function_queue()->IsEmpty() && running_) {
         ml.Wait();
       }
+      if (!running_) {
+        break;
+      }
     }
   }  // while running
 
   {
-    // Notify that the thread is done.
+    // Notify that this task is done.
     MonitorLocker ml_done(&done_monitor_);
-    done_ = true;
-    ml_done.Notify();
+    num_running_--;
+    if (num_running_ == 0) {
+      ml_done.NotifyAll();
+    }
   }
 }
 
-void BackgroundCompiler::Compile(const Function& function) {
+void BackgroundCompiler::Compile(const Function& function,
+                                 intptr_t minimum_priority) {
   ASSERT(Thread::Current()->IsMutatorThread());
   MonitorLocker ml(&queue_monitor_);
   ASSERT(running_);
   if (function_queue()->ContainsObj(function)) {
     return;
   }
-  QueueElement* elem = new QueueElement(function);
+  // The usage counter doubles as the queue priority. It is reset to INT32_MIN
+  // once the function is queued; recover the count accumulated so far so the
+  // hottest functions are compiled first.
+  intptr_t priority = function.usage_counter();
+  if (priority < 0) {
+    priority = (priority - INT32_MIN) + FLAG_optimization_counter_threshold;
+  }
+  if (priority < minimum_priority) {
+    priority = minimum_priority;
+  }
+  QueueElement* elem = new QueueElement(function, priority);
   function_queue()->Add(elem);
   ml.Notify();
 }
@@ -1232,17 +1371,24 @@ void BackgroundCompiler::Start() {
   ASSERT(!thread->IsAtSafepoint());
 
   MonitorLocker ml(&done_monitor_);
-  if (running_ || !done_) return;
+  if (running_ || (num_running_ > 0)) return;
   running_ = true;
-  done_ = false;
   // If we ever wanted to run the BG compiler on the
   // `IsolateGroup::mutator_pool()` we would need to ensure the BG compiler
   // stops when it's idle - otherwise the [MutatorThreadPool]-based idle
   // notification would not work anymore.
-  bool task_started = Dart::thread_pool()->Run<BackgroundCompilerTask>(this);
-  if (!task_started) {
+  intptr_t max_tasks = FLAG_max_background_compiler_tasks;
+  if (max_tasks < 1) {
+    max_tasks = 1;
+  }
+  while (num_running_ < max_tasks) {
+    if (!Dart::thread_pool()->Run<BackgroundCompilerTask>(this)) {
+      break;
+    }
+    num_running_++;
+  }
+  if (num_running_ == 0) {
     running_ = false;
-    done_ = true;
   }
 }
 
@@ -1255,12 +1401,12 @@ void BackgroundCompiler::Stop() {
     MonitorLocker ml(&queue_monitor_);
     running_ = false;
     function_queue_->Clear();
-    ml.Notify();  // Stop waiting for the queue.
+    ml.NotifyAll();  // Stop waiting for the queue.
   }
 
   {
     MonitorLocker ml_done(&done_monitor_);
-    while (!done_) {
+    while (num_running_ > 0) {
       ml_done.WaitWithSafepointCheck(thread);
     }
   }
@@ -1338,7 +1484,8 @@ void Compiler::AbortBackgroundCompilation(intptr_t deopt_id, const char* msg) {
   UNREACHABLE();
 }
 
-void BackgroundCompiler::Compile(const Function& function) {
+void BackgroundCompiler::Compile(const Function& function,
+                                 intptr_t minimum_priority) {
   UNREACHABLE();
 }
 
@@ -21,6 +21,7 @@ class CompilationWorkQueue;
 class FlowGraph;
 class Function;
 class IndirectGotoInstr;
+class JSONStream;
 class Library;
 class ParsedFunction;
 class QueueElement;
@@ -113,6 +114,56 @@ class Compiler : public AllStatic {
   static void AbortBackgroundCompilation(intptr_t deopt_id, const char* msg);
 };
 
+#if !defined(PRODUCT) && !defined(DART_PRECOMPILED_RUNTIME)
+// A bounded ring of the most recent JIT compilations together with running
+// totals, so the time and memory the compiler consumed can be attributed
+// after the fact without enabling the timeline. Entries are recorded by
+// CompileParsedFunctionHelper and queried through the _getCompilationLedger
+// service protocol method; the wall time of each compilation also feeds the
+// compile.time isolate metric.
+class CompileLedger {
+ public:
+  CompileLedger();
+  ~CompileLedger();
+
+  // Records one compilation attempt. May be called concurrently from the
+  // mutator and background compiler threads. [cpu_micros] is -1 when the OS
+  // provides no thread CPU clock.
+  void Record(const Function& function,
+              bool optimized,
+              int64_t wall_micros,
+              int64_t cpu_micros,
+              intptr_t zone_bytes);
+
+  void PrintJSON(JSONStream* stream) const;
+
+ private:
+  struct Entry {
+    char* name;  // Fully qualified function name; NULL if the slot is unused.
+    bool optimized;
+    int64_t timestamp_micros;
+    int64_t wall_micros;
+    int64_t cpu_micros;
+    intptr_t zone_bytes;
+    intptr_t deopt_count;
+  };
+
+  // Covers a few hundred compilations - enough to span a compile storm
+  // without letting the ledger grow with the program.
+  static const intptr_t kCapacity = 512;
+
+  mutable Mutex mutex_;
+  Entry entries_[kCapacity];
+  intptr_t next_;  // Ring cursor: the slot the next compilation overwrites.
+  int64_t total_count_;
+  int64_t total_wall_micros_;
+  int64_t total_cpu_micros_;
+  int64_t total_zone_bytes_;
+
+  DISALLOW_COPY_AND_ASSIGN(CompileLedger);
+};
+#endif  // !defined(PRODUCT) && !defined(DART_PRECOMPILED_RUNTIME)
+
 // Class to run optimizing compilation in a background thread.
 // Current implementation: one task per isolate, it dies with the owning
 // isolate.
@@ -157,8 +208,11 @@ class BackgroundCompiler {
   }
 
   // Call to compile (unoptimized or optimized) a function in the background,
-  // enters the function in the compilation queue.
-  void Compile(const Function& function);
+  // enters the function in the compilation queue. The queue priority is
+  // derived from the function's usage counter; minimum_priority raises the
+  // floor, letting callers with stronger evidence of hotness (such as a
+  // tripped loop back-edge counter) jump ahead of counter-triggered work.
+  void Compile(const Function& function, intptr_t minimum_priority = 0);
 
   void VisitPointers(ObjectPointerVisitor* visitor);
 
@@ -174,16 +228,16 @@ class BackgroundCompiler {
   void Enable();
   void Disable();
   bool IsDisabled();
-  bool IsRunning() { return !done_; }
+  bool IsRunning() { return num_running_ > 0; }
 
   Isolate* isolate_;
 
   Monitor queue_monitor_;  // Controls access to the queue.
   BackgroundCompilationQueue* function_queue_;
 
-  Monitor done_monitor_;    // Notify/wait that the thread is done.
+  Monitor done_monitor_;    // Notify/wait that all tasks are done.
   bool running_;            // While true, will try to read queue and compile.
-  bool done_;               // True if the thread is done.
+  intptr_t num_running_;    // Number of tasks processing the queue.
   bool optimizing_;
 
   int16_t disabled_depth_;
@@ -22,11 +22,9 @@ class JitCallSpecializer : public CallSpecializer {
 
   virtual void VisitInstanceCall(InstanceCallInstr* instr);
 
-  // TODO(dartbug.com/30633) these methods have nothing to do with
-  // specialization of calls. They are here for historical reasons.
-  // Find a better place for them.
-  virtual void VisitAllocateContext(AllocateContextInstr* instr);
-  virtual void VisitCloneContext(CloneContextInstr* instr);
+  // TODO(dartbug.com/30633) this method has nothing to do with
+  // specialization of calls. It is here for historical reasons.
+  // Find a better place for it.
   virtual void VisitStoreInstanceField(StoreInstanceFieldInstr* instr);
 
  private:
@@ -34,11 +32,6 @@ class JitCallSpecializer : public CallSpecializer {
 
   virtual bool TryOptimizeStaticCallUsingStaticTypes(StaticCallInstr* call);
 
-  void LowerContextAllocation(
-      Definition* instr,
-      const ZoneGrowableArray<const Slot*>& context_variables,
-      Value* context_value);
-
   void ReplaceWithStaticCall(InstanceCallInstr* instr,
                              const Function& target,
                              intptr_t call_count);
@@ -81,6 +81,11 @@ namespace dart {
   V(::, _toClampedUint8, ConvertIntToClampedUint8, 0x143ed675)                 \
   V(::, copyRangeFromUint8ListToOneByteString,                                 \
     CopyRangeFromUint8ListToOneByteString, 0x89d6a60a)                         \
+  V(::, _memMove1, TypedData_memMove1, 0x6da1fd72)                             \
+  V(::, _memMove2, TypedData_memMove2, 0x3b4f3c18)                             \
+  V(::, _memMove4, TypedData_memMove4, 0x8e6c9c24)                             \
+  V(::, _memMove8, TypedData_memMove8, 0xdab9b2c5)                             \
+  V(::, _memMove16, TypedData_memMove16, 0x5c9a6b13)                           \
   V(_StringBase, _interpolate, StringBaseInterpolate, 0xd5a58efc)              \
   V(_IntegerImplementation, toDouble, IntegerToDouble, 0x5f8db5f5)             \
   V(_Double, _add, DoubleAdd, 0x4326962a)                                      \
@@ -1706,8 +1706,7 @@ static void GenerateWriteBarrierStubHelper(Assembler* assembler,
   }
 
   // Save values being destroyed.
-  __ Push(R2);
-  __ Push(R3);
+  __ PushPair(R3, R2);
   __ Push(R4);
 
   // Atomically set the remembered bit of the object header.
@@ -1742,8 +1741,7 @@ static void GenerateWriteBarrierStubHelper(Assembler* assembler,
   __ CompareImmediate(R2, target::StoreBufferBlock::kSize);
   // Restore values.
   __ Pop(R4);
-  __ Pop(R3);
-  __ Pop(R2);
+  __ PopPair(R3, R2);
   __ b(&overflow, EQ);
   __ ret();
 
@@ -1759,9 +1757,8 @@ static void GenerateWriteBarrierStubHelper(Assembler* assembler,
   __ ret();
 
   __ Bind(&add_to_mark_stack);
-  __ Push(R2);  // Spill.
-  __ Push(R3);  // Spill.
-  __ Push(R4);  // Spill.
+  __ PushPair(R3, R2);  // Spill.
+  __ Push(R4);          // Spill.
 
   // Atomically clear kOldAndNotMarkedBit.
   // Note that we use 32 bit operations here to match the size of the
@@ -1786,9 +1783,8 @@ static void GenerateWriteBarrierStubHelper(Assembler* assembler,
   __ StoreToOffset(R2, R4, target::MarkingStackBlock::top_offset(),
                    kUnsignedWord);
   __ CompareImmediate(R2, target::MarkingStackBlock::kSize);
-  __ Pop(R4);  // Unspill.
-  __ Pop(R3);  // Unspill.
-  __ Pop(R2);  // Unspill.
+  __ Pop(R4);           // Unspill.
+  __ PopPair(R3, R2);   // Unspill.
   __ b(&marking_overflow, EQ);
   __ ret();
 
@@ -1803,9 +1799,8 @@ static void GenerateWriteBarrierStubHelper(Assembler* assembler,
   __ ret();
 
   __ Bind(&lost_race);
-  __ Pop(R4);  // Unspill.
-  __ Pop(R3);  // Unspill.
-  __ Pop(R2);  // Unspill.
+  __ Pop(R4);           // Unspill.
+  __ PopPair(R3, R2);   // Unspill.
   __ ret();
 
   if (cards) {
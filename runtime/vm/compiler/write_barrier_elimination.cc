@@ -70,6 +70,14 @@ typedef DirectChainedHashMap<DefinitionIndexPairTrait> DefinitionIndexMap;
 //
 // See also Thread::RememberLiveTemporaries() and
 // Thread::DeferredMarkLiveTemporaries().
+//
+// An alternative design would skip the barrier dynamically, by comparing the
+// container object against the thread's TLAB bounds in the generated store
+// sequence. We don't do this because the inline barrier already filters
+// new-space containers with a single branch off the object's header bits
+// (see e.g. Assembler::StoreIntoObject), so a bounds compare would only
+// shorten that path by one load, while this pass removes the filter entirely
+// for the common store-into-just-allocated pattern.
 class WriteBarrierElimination : public ValueObject {
  public:
   WriteBarrierElimination(Zone* zone, FlowGraph* flow_graph);
@@ -370,14 +378,21 @@ void WriteBarrierElimination::UpdateVectorForBlock(BlockEntryInstr* entry,
     Instruction* const current = it.Current();
 
     if (finalize) {
+      // Note that we look through redefinitions (CheckNull, type checks and
+      // the narrowing redefinitions the inliner inserts for arguments): a
+      // redefined value is the same object, so a store into a constructor
+      // parameter bound to a fresh allocation at an inlined call site is
+      // still a store into that allocation.
       if (StoreInstanceFieldInstr* instr = current->AsStoreInstanceField()) {
-        Definition* const container = instr->instance()->definition();
+        Definition* const container =
+            instr->instance()->definition()->OriginalDefinition();
         if (IsUsable(container) && vector_->Contains(Index(container))) {
           DEBUG_ASSERT(SlotEligibleForWBE(instr->slot()));
           instr->set_emit_store_barrier(kNoStoreBarrier);
         }
       } else if (StoreIndexedInstr* instr = current->AsStoreIndexed()) {
-        Definition* const array = instr->array()->definition();
+        Definition* const array =
+            instr->array()->definition()->OriginalDefinition();
         if (IsUsable(array) && vector_->Contains(Index(array))) {
           instr->set_emit_store_barrier(StoreBarrierType::kNoStoreBarrier);
         }
@@ -34,6 +34,7 @@
 #include "vm/port.h"
 #include "vm/profiler.h"
 #include "vm/reverse_pc_lookup_cache.h"
+#include "vm/runtime_entry.h"
 #include "vm/service_isolate.h"
 #include "vm/simulator.h"
 #include "vm/snapshot.h"
@@ -49,6 +50,7 @@
 namespace dart {
 
 DECLARE_FLAG(bool, print_class_table);
+DECLARE_FLAG(bool, print_runtime_entry_counters);
 DEFINE_FLAG(bool, keep_code, false, "Keep deoptimized code for profiling.");
 DEFINE_FLAG(bool, trace_shutdown, false, "Trace VM shutdown on stderr");
 DECLARE_FLAG(bool, strong);
@@ -243,6 +245,7 @@ char* Dart::Init(const uint8_t* vm_isolate_snapshot,
   NativeSymbolResolver::Init();
   NOT_IN_PRODUCT(Profiler::Init());
   SemiSpace::Init();
+  OldPage::Init();
   NOT_IN_PRODUCT(Metric::Init());
   StoreBuffer::Init();
   MarkingStack::Init();
@@ -500,6 +503,10 @@ char* Dart::Cleanup() {
     return Utils::StrDup("VM already terminated.");
   }
 
+  if (FLAG_print_runtime_entry_counters) {
+    RuntimeEntry::PrintInvocationCounters();
+  }
+
   if (FLAG_trace_shutdown) {
     OS::PrintErr("[+%" Pd64 "ms] SHUTDOWN: Starting shutdown\n",
                  UptimeMillis());
@@ -636,6 +643,7 @@ char* Dart::Cleanup() {
   StoreBuffer::Cleanup();
   Object::Cleanup();
   SemiSpace::Cleanup();
+  OldPage::Cleanup();
   StubCode::Cleanup();
 #if defined(SUPPORT_TIMELINE)
   if (FLAG_trace_shutdown) {
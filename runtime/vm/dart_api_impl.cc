@@ -705,6 +705,41 @@ FinalizablePersistentHandle* FinalizablePersistentHandle::Cast(
   return reinterpret_cast<FinalizablePersistentHandle*>(handle);
 }
 
+void FinalizablePersistentHandle::UpdateUnreachable(
+    IsolateGroup* isolate_group) {
+  EnsureFreedExternal(isolate_group);
+  if (FLAG_background_finalizers) {
+    DeferFinalization(isolate_group, this);
+  } else {
+    Finalize(isolate_group, this);
+  }
+}
+
+void FinalizablePersistentHandle::DeferFinalization(
+    IsolateGroup* isolate_group,
+    FinalizablePersistentHandle* handle) {
+  if (!handle->raw()->IsHeapObject()) {
+    return;  // Free handle.
+  }
+  Dart_HandleFinalizer callback = handle->callback();
+  ASSERT(callback != NULL);
+  void* peer = handle->peer();
+  ApiState* state = isolate_group->api_state();
+  ASSERT(state != NULL);
+
+  state->QueueFinalizer(callback, peer);
+
+  // Detach the handle before the queue is drained so the next GC does not
+  // consider it pending. The callback only receives the peer, never the
+  // handle, so an auto-deleted handle can be freed right away: the embedder
+  // may not touch it once the referent is unreachable.
+  if (handle->auto_delete()) {
+    state->FreeWeakPersistentHandle(handle);
+  } else {
+    state->ClearWeakPersistentHandle(handle);
+  }
+}
+
 void FinalizablePersistentHandle::Finalize(
     IsolateGroup* isolate_group,
     FinalizablePersistentHandle* handle) {
@@ -1208,6 +1243,22 @@ VM_METRIC_LIST(VM_METRIC_API)
 ISOLATE_GROUP_METRIC_LIST(ISOLATE_GROUP_METRIC_API)
 #undef ISOLATE_GROUP_METRIC_API
 
+#define ISOLATE_GROUP_HISTOGRAM_METRIC_API(variable)                           \
+  DART_EXPORT int64_t Dart_Isolate##variable##HistogramMetric(                 \
+      Dart_Isolate isolate, intptr_t bucket) {                                 \
+    if (isolate == nullptr) {                                                  \
+      FATAL1("%s expects argument 'isolate' to be non-null.", CURRENT_FUNC);   \
+    }                                                                          \
+    if ((bucket < 0) || (bucket >= HistogramMetric::kBucketCount)) {           \
+      return -1;                                                               \
+    }                                                                          \
+    Isolate* iso = reinterpret_cast<Isolate*>(isolate);                        \
+    return iso->group()->Get##variable##Metric()->BucketCountAt(bucket);       \
+  }
+ISOLATE_GROUP_HISTOGRAM_METRIC_API(TimeToSafepoint)
+ISOLATE_GROUP_HISTOGRAM_METRIC_API(GcPauseTime)
+#undef ISOLATE_GROUP_HISTOGRAM_METRIC_API
+
 #if !defined(PRODUCT)
 #define ISOLATE_METRIC_API(type, variable, name, unit)                         \
   DART_EXPORT int64_t Dart_Isolate##variable##Metric(Dart_Isolate isolate) {   \
@@ -1912,9 +1963,18 @@ DART_EXPORT void Dart_NotifyIdle(int64_t deadline) {
   CHECK_ISOLATE(T->isolate());
   API_TIMELINE_BEGIN_END(T);
   TransitionNativeToVM transition(T);
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  if (FLAG_collect_code) {
+    ClassFinalizer::ClearUnusedCode();
+  }
+#endif  // !defined(DART_PRECOMPILED_RUNTIME)
   T->isolate()->group()->idle_time_handler()->NotifyIdle(deadline);
 }
 
+DART_EXPORT void Dart_HintIdle(int64_t deadline) {
+  IdleTimeHandler::HintIdleWindow(deadline);
+}
+
 DART_EXPORT void Dart_NotifyLowMemory() {
   API_TIMELINE_BEGIN_END(Thread::Current());
   Isolate::NotifyLowMemory();
@@ -4700,14 +4760,15 @@ DART_EXPORT Dart_Handle Dart_InvokeConstructor(Dart_Handle object,
                        CURRENT_FUNC);
 }
 
-DART_EXPORT Dart_Handle Dart_Invoke(Dart_Handle target,
-                                    Dart_Handle name,
-                                    int number_of_arguments,
-                                    Dart_Handle* arguments) {
-  DARTSCOPE(Thread::Current());
-  API_TIMELINE_DURATION(T);
-  CHECK_CALLBACK_STATE(T);
-
+// The body of Dart_Invoke, shared with Dart_InvokeBatch so that a batch only
+// pays for thread transition and scope setup once. The caller has entered the
+// API scope; [current_func] is the API function name used in error messages.
+static Dart_Handle InvokeWithScopeEntered(Thread* T,
+                                          const char* current_func,
+                                          Dart_Handle target,
+                                          Dart_Handle name,
+                                          int number_of_arguments,
+                                          Dart_Handle* arguments) {
   String& function_name =
       String::Handle(Z, Api::UnwrapStringHandle(Z, name).raw());
   if (function_name.IsNull()) {
@@ -4716,7 +4777,7 @@ DART_EXPORT Dart_Handle Dart_Invoke(Dart_Handle target,
   if (number_of_arguments < 0) {
     return Api::NewError(
         "%s expects argument 'number_of_arguments' to be non-negative.",
-        CURRENT_FUNC);
+        current_func);
   }
   const Object& obj = Object::Handle(Z, Api::UnwrapHandle(target));
   if (obj.IsError()) {
@@ -4732,7 +4793,7 @@ DART_EXPORT Dart_Handle Dart_Invoke(Dart_Handle target,
     if (!Type::Cast(obj).IsFinalized()) {
       return Api::NewError(
           "%s expects argument 'target' to be a fully resolved type.",
-          CURRENT_FUNC);
+          current_func);
     }
 
     const Class& cls = Class::Handle(Z, Type::Cast(obj).type_class());
@@ -4772,7 +4833,7 @@ DART_EXPORT Dart_Handle Dart_Invoke(Dart_Handle target,
     // Check that the library is loaded.
     if (!lib.Loaded()) {
       return Api::NewError("%s expects library argument 'target' to be loaded.",
-                           CURRENT_FUNC);
+                           current_func);
     }
 
     if (Library::IsPrivate(function_name)) {
@@ -4791,8 +4852,48 @@ DART_EXPORT Dart_Handle Dart_Invoke(Dart_Handle target,
   } else {
     return Api::NewError(
         "%s expects argument 'target' to be an object, type, or library.",
+        current_func);
+  }
+}
+
+DART_EXPORT Dart_Handle Dart_Invoke(Dart_Handle target,
+                                    Dart_Handle name,
+                                    int number_of_arguments,
+                                    Dart_Handle* arguments) {
+  DARTSCOPE(Thread::Current());
+  API_TIMELINE_DURATION(T);
+  CHECK_CALLBACK_STATE(T);
+  return InvokeWithScopeEntered(T, CURRENT_FUNC, target, name,
+                                number_of_arguments, arguments);
+}
+
+DART_EXPORT Dart_Handle Dart_InvokeBatch(intptr_t number_of_invocations,
+                                         Dart_Invocation* invocations) {
+  DARTSCOPE(Thread::Current());
+  API_TIMELINE_DURATION(T);
+  CHECK_CALLBACK_STATE(T);
+  if (number_of_invocations < 0) {
+    return Api::NewError(
+        "%s expects argument 'number_of_invocations' to be non-negative.",
         CURRENT_FUNC);
   }
+  if (invocations == nullptr) {
+    return Api::NewError("%s expects argument 'invocations' to be non-null.",
+                         CURRENT_FUNC);
+  }
+  for (intptr_t i = 0; i < number_of_invocations; i++) {
+    Dart_Invocation* invocation = &invocations[i];
+    Dart_Handle result = InvokeWithScopeEntered(
+        T, CURRENT_FUNC, invocation->target, invocation->name,
+        invocation->number_of_arguments, invocation->arguments);
+    invocation->result = result;
+    if (Dart_IsError(result) &&
+        Object::Handle(Z, Api::UnwrapHandle(result)).IsUnwindError()) {
+      // The isolate is being unwound; later invocations must not run.
+      return result;
+    }
+  }
+  return Api::Success();
 }
 
 DART_EXPORT Dart_Handle Dart_InvokeClosure(Dart_Handle closure,
@@ -1071,39 +1071,65 @@ bool ApiMessageWriter::WriteCObjectInlined(Dart_CObject* object,
         case Dart_TypedData_kUint8:
           class_id = kTypedDataUint8ArrayCid;
           break;
+        case Dart_TypedData_kUint8Clamped:
+          class_id = kTypedDataUint8ClampedArrayCid;
+          break;
+        case Dart_TypedData_kInt16:
+          class_id = kTypedDataInt16ArrayCid;
+          break;
+        case Dart_TypedData_kUint16:
+          class_id = kTypedDataUint16ArrayCid;
+          break;
+        case Dart_TypedData_kInt32:
+          class_id = kTypedDataInt32ArrayCid;
+          break;
         case Dart_TypedData_kUint32:
           class_id = kTypedDataUint32ArrayCid;
           break;
+        case Dart_TypedData_kInt64:
+          class_id = kTypedDataInt64ArrayCid;
+          break;
+        case Dart_TypedData_kUint64:
+          class_id = kTypedDataUint64ArrayCid;
+          break;
+        case Dart_TypedData_kFloat32:
+          class_id = kTypedDataFloat32ArrayCid;
+          break;
+        case Dart_TypedData_kFloat64:
+          class_id = kTypedDataFloat64ArrayCid;
+          break;
+        case Dart_TypedData_kInt32x4:
+          class_id = kTypedDataInt32x4ArrayCid;
+          break;
+        case Dart_TypedData_kFloat32x4:
+          class_id = kTypedDataFloat32x4ArrayCid;
+          break;
+        case Dart_TypedData_kFloat64x2:
+          class_id = kTypedDataFloat64x2ArrayCid;
+          break;
         default:
-          class_id = kTypedDataUint8ArrayCid;
-          UNIMPLEMENTED();
+          return false;
       }
 
-      intptr_t len = object->value.as_typed_data.length;
-      if (len < 0 || len > TypedData::MaxElements(class_id)) {
+      // The length of a Dart_CObject_kTypedData is in bytes; the wire format
+      // carries the element count.
+      const intptr_t element_size =
+          GetTypedDataSizeInBytes(object->value.as_typed_data.type);
+      const intptr_t length_in_bytes = object->value.as_typed_data.length;
+      if ((length_in_bytes < 0) || ((length_in_bytes % element_size) != 0)) {
+        return false;
+      }
+      const intptr_t len = length_in_bytes / element_size;
+      if (len > TypedData::MaxElements(class_id)) {
         return false;
       }
 
       WriteIndexedObject(class_id);
       WriteTags(0);
       WriteSmi(len);
-      switch (class_id) {
-        case kTypedDataInt8ArrayCid:
-        case kTypedDataUint8ArrayCid: {
-          uint8_t* bytes = object->value.as_typed_data.values;
-          Align(Zone::kAlignment);
-          WriteBytes(bytes, len);
-          break;
-        }
-        case kTypedDataUint32ArrayCid: {
-          uint8_t* bytes = object->value.as_typed_data.values;
-          Align(Zone::kAlignment);
-          WriteBytes(bytes, len * sizeof(uint32_t));
-          break;
-        }
-        default:
-          UNIMPLEMENTED();
-      }
+      uint8_t* bytes = object->value.as_typed_data.values;
+      Align(Zone::kAlignment);
+      WriteBytes(bytes, length_in_bytes);
       break;
     }
     case Dart_CObject_kExternalTypedData: {
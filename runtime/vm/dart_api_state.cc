@@ -16,4 +16,72 @@ namespace dart {
 
 RelaxedAtomic<intptr_t> ApiNativeScope::current_memory_usage_ = 0;
 
+namespace {
+
+// Drains the isolate group's finalizer queue outside the GC pause.
+class BackgroundFinalizerTask : public ThreadPool::Task {
+ public:
+  explicit BackgroundFinalizerTask(IsolateGroup* isolate_group)
+      : isolate_group_(isolate_group) {}
+
+  virtual void Run() {
+    ApiState* state = isolate_group_->api_state();
+    ASSERT(state != NULL);
+    state->RunPendingFinalizers(isolate_group_->embedder_data());
+  }
+
+ private:
+  IsolateGroup* isolate_group_;
+
+  DISALLOW_COPY_AND_ASSIGN(BackgroundFinalizerTask);
+};
+
+}  // namespace
+
+void ApiState::QueueFinalizer(Dart_HandleFinalizer callback, void* peer) {
+  MutexLocker ml(&weak_persistent_mutex_);
+  queued_finalizers_.Add({callback, peer});
+}
+
+void ApiState::ScheduleBackgroundFinalization(IsolateGroup* isolate_group) {
+  {
+    MutexLocker ml(&weak_persistent_mutex_);
+    if (queued_finalizers_.is_empty() || finalizer_task_scheduled_) {
+      return;
+    }
+    finalizer_task_scheduled_ = true;
+  }
+  // The task is joined by the thread pool's shutdown before the ApiState is
+  // destroyed, so it cannot outlive the isolate group.
+  ThreadPool* pool = isolate_group->thread_pool();
+  if ((pool == nullptr) || !pool->Run<BackgroundFinalizerTask>(isolate_group)) {
+    // No task could be started (the vm isolate has no thread pool and the
+    // pool stops accepting tasks during shutdown); drain synchronously.
+    RunPendingFinalizers(isolate_group->embedder_data());
+  }
+}
+
+void ApiState::RunPendingFinalizers(void* isolate_group_data) {
+  MallocGrowableArray<PendingFinalizer> batch;
+  for (;;) {
+    {
+      MutexLocker ml(&weak_persistent_mutex_);
+      if (queued_finalizers_.is_empty()) {
+        finalizer_task_scheduled_ = false;
+        return;
+      }
+      for (intptr_t i = 0; i < queued_finalizers_.length(); i++) {
+        batch.Add(queued_finalizers_[i]);
+      }
+      queued_finalizers_.Clear();
+    }
+    // Run the batch without the lock held; a finalizer is allowed to delete
+    // other weak persistent handles.
+    for (intptr_t i = 0; i < batch.length(); i++) {
+      (*batch[i].callback)(isolate_group_data, batch[i].peer);
+    }
+    batch.Clear();
+  }
+}
+
 }  // namespace dart
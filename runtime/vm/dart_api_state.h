@@ -243,11 +243,11 @@ class FinalizablePersistentHandle {
     }
   }
 
-  // Called when the referent becomes unreachable.
-  void UpdateUnreachable(IsolateGroup* isolate_group) {
-    EnsureFreedExternal(isolate_group);
-    Finalize(isolate_group, this);
-  }
+  // Called when the referent becomes unreachable. With
+  // --background-finalizers the finalizer callback is queued on the isolate
+  // group's ApiState and invoked later from a thread pool task; otherwise it
+  // runs right away, inside the GC pause.
+  void UpdateUnreachable(IsolateGroup* isolate_group);
 
   // Called when the referent has moved, potentially between generations.
   void UpdateRelocated(IsolateGroup* isolate_group) {
@@ -293,6 +293,11 @@ class FinalizablePersistentHandle {
   static void Finalize(IsolateGroup* isolate_group,
                        FinalizablePersistentHandle* handle);
 
+  // Detaches the handle from its referent and queues the finalizer callback
+  // on the isolate group's ApiState instead of invoking it.
+  static void DeferFinalization(IsolateGroup* isolate_group,
+                                FinalizablePersistentHandle* handle);
+
   // Overload the raw_ field as a next pointer when adding freed
   // handles to the free list.
   FinalizablePersistentHandle* Next() {
@@ -761,62 +766,62 @@ class ApiState {
   }
 
   PersistentHandle* AllocatePersistentHandle() {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&persistent_mutex_);
     return persistent_handles_.AllocateHandle();
   }
   void FreePersistentHandle(PersistentHandle* ref) {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&persistent_mutex_);
     persistent_handles_.FreeHandle(ref);
   }
 
   FinalizablePersistentHandle* AllocateWeakPersistentHandle() {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&weak_persistent_mutex_);
     return weak_persistent_handles_.AllocateHandle();
   }
   void ClearWeakPersistentHandle(FinalizablePersistentHandle* weak_ref) {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&weak_persistent_mutex_);
     weak_persistent_handles_.ClearHandle(weak_ref);
   }
   void FreeWeakPersistentHandle(FinalizablePersistentHandle* weak_ref) {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&weak_persistent_mutex_);
     weak_persistent_handles_.FreeHandle(weak_ref);
   }
 
   bool IsValidPersistentHandle(Dart_PersistentHandle object) {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&persistent_mutex_);
     return persistent_handles_.IsValidHandle(object);
   }
 
   bool IsActivePersistentHandle(Dart_PersistentHandle object) {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&persistent_mutex_);
     return persistent_handles_.IsValidHandle(object) &&
            !persistent_handles_.IsFreeHandle(object);
   }
 
   bool IsValidWeakPersistentHandle(Dart_WeakPersistentHandle object) {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&weak_persistent_mutex_);
     return weak_persistent_handles_.IsValidHandle(object);
   }
 
   bool IsValidFinalizableHandle(Dart_FinalizableHandle object) {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&weak_persistent_mutex_);
     return weak_persistent_handles_.IsValidHandle(object);
   }
 
   bool IsActiveWeakPersistentHandle(Dart_WeakPersistentHandle object) {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&weak_persistent_mutex_);
     return weak_persistent_handles_.IsValidHandle(object) &&
            !weak_persistent_handles_.IsFreeHandle(object);
   }
 
   bool IsProtectedHandle(PersistentHandle* object) {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&persistent_mutex_);
     if (object == NULL) return false;
     return object == null_ || object == true_ || object == false_;
   }
 
   int CountPersistentHandles() {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&persistent_mutex_);
     return persistent_handles_.CountHandles();
   }
 
@@ -825,7 +830,7 @@ class ApiState {
     // to allocate it when the error actually occurs.
     // When the error occurs there will be outstanding acquires to internal
     // data pointers making it unsafe to allocate objects on the dart heap.
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&persistent_mutex_);
     if (acquired_error_ == nullptr) {
       acquired_error_ = persistent_handles_.AllocateHandle();
       acquired_error_->set_raw(ApiError::typed_data_acquire_error());
@@ -835,25 +840,53 @@ class ApiState {
 
   void RunWithLockedPersistentHandles(
       std::function<void(PersistentHandles&)> fun) {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&persistent_mutex_);
     fun(persistent_handles_);
   }
 
   void RunWithLockedWeakPersistentHandles(
       std::function<void(FinalizablePersistentHandles&)> fun) {
-    MutexLocker ml(&mutex_);
+    MutexLocker ml(&weak_persistent_mutex_);
     fun(weak_persistent_handles_);
   }
 
+  // Queues a finalizer callback for a referent that became unreachable. The
+  // queue is drained in batches by a task on the isolate group's thread pool,
+  // scheduled with ScheduleBackgroundFinalization at the end of each GC.
+  void QueueFinalizer(Dart_HandleFinalizer callback, void* peer);
+
+  // Schedules a thread pool task to drain the finalizer queue, unless the
+  // queue is empty or a task is already pending. Falls back to draining
+  // synchronously when no task can be scheduled (e.g. during shutdown).
+  void ScheduleBackgroundFinalization(IsolateGroup* isolate_group);
+
+  // Invokes all queued finalizer callbacks. Safe to call from any thread;
+  // callbacks run without the ApiState lock held.
+  void RunPendingFinalizers(void* isolate_group_data);
+
   WeakTable* acquired_table() { return &acquired_table_; }
 
  private:
-  Mutex mutex_;
+  struct PendingFinalizer {
+    Dart_HandleFinalizer callback;
+    void* peer;
+  };
+
+  // Persistent and weak persistent handles are allocated and freed from
+  // different embedder threads; separate locks keep high-rate persistent
+  // handle churn from serializing against weak handle (finalizer) churn.
+  Mutex persistent_mutex_;
+  Mutex weak_persistent_mutex_;
 
   PersistentHandles persistent_handles_;
   FinalizablePersistentHandles weak_persistent_handles_;
   WeakTable acquired_table_;
 
+  // Guarded by weak_persistent_mutex_. Finalizers waiting to be run by a
+  // background task.
+  MallocGrowableArray<PendingFinalizer> queued_finalizers_;
+  bool finalizer_task_scheduled_ = false;
+
   // Persistent handles to important objects.
   PersistentHandle* null_;
   PersistentHandle* true_;
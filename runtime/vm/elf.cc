@@ -966,6 +966,21 @@ uword Elf::SymbolAddress(const char* name) const {
   return kNoSectionStart;
 }
 
+// Layout invariants that keep the snapshot cheap to load and share:
+//
+// * Each change in the W/X flags between consecutive allocated sections
+//   starts a new PT_LOAD segment whose memory offset and file offset are
+//   both aligned to kPageSize (see ComputeFileOffsets). The loader in
+//   bin/elf_loader.cc maps each segment straight from the file, so the
+//   read-only and executable segments are backed by clean file pages that
+//   the kernel shares across all processes loading the same snapshot.
+//
+// * The snapshot is emitted as ET_DYN with no dynamic relocations: the only
+//   fixups are BSS-relative references patched into .text while its contents
+//   are generated, before the bytes reach this writer. Thus no mapped page
+//   is dirtied during loading, regardless of the load address.
+//
+// Changes to section ordering or alignment should preserve both properties.
 intptr_t Elf::AddSection(Section* section,
                          const char* name,
                          const char* symbol_name) {
@@ -5,6 +5,7 @@
 #include "vm/field_table.h"
 
 #include "platform/atomic.h"
+#include "platform/utils.h"
 #include "vm/flags.h"
 #include "vm/growable_array.h"
 #include "vm/heap/heap.h"
@@ -36,7 +37,8 @@ void FieldTable::Register(const Field& field) {
   ASSERT(Thread::Current()->IsMutatorThread());
   if (free_head_ < 0) {
     if (top_ == capacity_) {
-      const intptr_t new_capacity = capacity_ + kCapacityIncrement;
+      const intptr_t new_capacity =
+          Utils::Maximum(capacity_ * 2, capacity_ + kCapacityIncrement);
       Grow(new_capacity);
     }
 
@@ -69,7 +71,8 @@ void FieldTable::SetAt(intptr_t index, InstancePtr raw_instance) {
 
 void FieldTable::AllocateIndex(intptr_t index) {
   if (index >= capacity_) {
-    const intptr_t new_capacity = index + kCapacityIncrement;
+    const intptr_t new_capacity =
+        Utils::Maximum(capacity_ * 2, index + kCapacityIncrement);
     Grow(new_capacity);
   }
 
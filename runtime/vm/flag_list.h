@@ -89,6 +89,9 @@ constexpr bool kDartUseBackgroundCompilation = true;
     "-1 means never.")                                                         \
   P(background_compilation, bool, kDartUseBackgroundCompilation,               \
     "Run optimizing compilation in background")                                \
+  P(background_finalizers, bool, false,                                        \
+    "Run finalizers for unreachable weak handles on a background thread "      \
+    "instead of inside the GC pause.")                                         \
   R(code_comments, false, bool, false,                                         \
     "Include comments into code and disassembly.")                             \
   P(collect_code, bool, false, "Attempt to GC infrequently used code.")        \
@@ -106,6 +109,9 @@ constexpr bool kDartUseBackgroundCompilation = true;
   R(dump_megamorphic_stats, false, bool, false,                                \
     "Dump megamorphic cache statistics")                                       \
   R(dump_symbol_stats, false, bool, false, "Dump symbol table statistics")     \
+  P(eager_field_guard_generalization, bool, false,                             \
+    "Generalize a violated field guard to its terminal state at once "         \
+    "instead of settling through intermediate states.")                        \
   R(enable_asserts, false, bool, false, "Enable assert statements.")           \
   R(null_assertions, false, bool, false,                                       \
     "Enable null assertions for parameters.")                                  \
@@ -118,6 +124,9 @@ constexpr bool kDartUseBackgroundCompilation = true;
     "Don't optimize away static field initialization")                         \
   C(force_clone_compiler_objects, false, false, bool, false,                   \
     "Force cloning of objects needed in compiler (ICData and Field).")         \
+  P(gc_worker_pool_size, int, 0,                                               \
+    "The maximum number of threads in the dedicated GC worker pool of each "   \
+    "isolate group (0 means limited only by the number of queued GC tasks).")  \
   P(getter_setter_ratio, int, 13,                                              \
     "Ratio of getter/setter usage used for double field unboxing heuristics")  \
   P(guess_icdata_cid, bool, true,                                              \
@@ -129,6 +138,8 @@ constexpr bool kDartUseBackgroundCompilation = true;
   P(idle_duration_micros, int, 500 * kMicrosecondsPerMillisecond,              \
     "Allow idle tasks to run for this long.")                                  \
   P(interpret_irregexp, bool, false, "Use irregexp bytecode interpreter")      \
+  P(lazy_type_finalization, bool, false,                                       \
+    "Finalize class types on first use instead of at load time.")              \
   P(link_natives_lazily, bool, false, "Link native calls lazily")              \
   R(log_marker_tasks, false, bool, false,                                      \
     "Log debugging information for old gen GC marking tasks.")                 \
@@ -146,6 +157,10 @@ constexpr bool kDartUseBackgroundCompilation = true;
     "Max size of new gen semi space in MB")                                    \
   P(new_gen_semi_initial_size, int, (kWordSize <= 4) ? 1 : 2,                  \
     "Initial size of new gen semi space in MB")                                \
+  P(new_gen_tlab_size, int, 512,                                               \
+    "Size of thread-local allocation buffers in kB. Buffers smaller than a "   \
+    "page let more mutator threads allocate in parallel from a new space of "  \
+    "a given size.")                                                           \
   P(optimization_counter_threshold, int, 30000,                                \
     "Function's usage-counter value before it is optimized, -1 means never")   \
   R(randomize_optimization_counter, false, bool, false,                        \
@@ -183,7 +198,8 @@ constexpr bool kDartUseBackgroundCompilation = true;
   P(retain_function_objects, bool, true,                                       \
     "Serialize function objects for all code objects even if not otherwise "   \
     "needed in the precompiled runtime.")                                      \
-  P(enable_isolate_groups, bool, false, "Enable isolate group support.")       \
+  P(enable_isolate_groups, bool, kDartPrecompiledRuntime,                      \
+    "Enable isolate group support.")                                           \
   P(show_invisible_frames, bool, false,                                        \
     "Show invisible frames in stack traces.")                                  \
   R(support_il_printer, false, bool, true, "Support the IL printer.")          \
@@ -32,6 +32,27 @@ const intptr_t kSmiMin32 = -(static_cast<intptr_t>(1) << kSmiBits32);
 // Number of bytes per BigInt digit.
 const intptr_t kBytesPerBigIntDigit = 4;
 
+// Size of an object pointer field as stored in the heap. With
+// DART_COMPRESSED_POINTERS, fields hold 32-bit offsets from a heap base and
+// the heap is reserved inside a single 4 GB region; without it, fields hold
+// full tagged pointers. Code that computes object sizes and field offsets
+// should use these instead of kWordSize so that it stays correct under both
+// representations.
+#if defined(DART_COMPRESSED_POINTERS)
+#if !defined(ARCH_IS_64_BIT)
+#error DART_COMPRESSED_POINTERS requires a 64-bit architecture.
+#endif
+const intptr_t kCompressedWordSize = kInt32Size;
+const intptr_t kCompressedWordSizeLog2 = kInt32SizeLog2;
+typedef uint32_t compressed_uword;
+typedef int32_t compressed_word;
+#else
+const intptr_t kCompressedWordSize = kWordSize;
+const intptr_t kCompressedWordSizeLog2 = kWordSizeLog2;
+typedef uintptr_t compressed_uword;
+typedef intptr_t compressed_word;
+#endif
+
 // The default old gen heap size in MB, where 0 == unlimited.
 // 32-bit: OS limit is 2 or 3 GB
 // 64-bit: Linux's limit is
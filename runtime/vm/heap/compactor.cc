@@ -171,6 +171,7 @@ void GCCompactor::Compact(OldPage* pages,
                           FreeList* freelist,
                           Mutex* pages_lock) {
   SetupImagePageBoundaries();
+  SetupLargePages();
 
   // Divide the heap.
   // TODO(30978): Try to divide based on live bytes or with work stealing.
@@ -188,18 +189,23 @@ void GCCompactor::Compact(OldPage* pages,
   OldPage** tails = new OldPage*[num_tasks];
 
   {
-    const intptr_t pages_per_task = num_pages / num_tasks;
     intptr_t task_index = 0;
     intptr_t page_index = 0;
+    // Distribute the remainder of num_pages / num_tasks over the first tasks
+    // instead of leaving all of it to the last worker, which is also the
+    // thread that started the compaction.
+    intptr_t task_end = 0;
     OldPage* page = pages;
     OldPage* prev = NULL;
     while (task_index < num_tasks) {
-      if (page_index % pages_per_task == 0) {
+      if (page_index == task_end) {
         heads[task_index] = page;
         tails[task_index] = NULL;
         if (prev != NULL) {
           prev->set_next(NULL);
         }
+        task_end += (num_pages / num_tasks) +
+                    ((task_index < (num_pages % num_tasks)) ? 1 : 0);
         task_index++;
       }
       prev = page;
@@ -245,7 +251,7 @@ void GCCompactor::Compact(OldPage* pages,
     for (intptr_t task_index = 0; task_index < num_tasks; task_index++) {
       if (task_index < (num_tasks - 1)) {
         // Begin compacting on a helper thread.
-        Dart::thread_pool()->Run<CompactorTask>(
+        thread()->isolate_group()->gc_thread_pool()->Run<CompactorTask>(
             thread()->isolate_group(), this, &barrier, &next_forwarding_task,
             heads[task_index], &tails[task_index], freelist);
       } else {
@@ -387,36 +393,27 @@ void CompactorTask::RunEnteredIsolateGroup() {
       intptr_t forwarding_task = next_forwarding_task_->fetch_add(1u);
       switch (forwarding_task) {
         case 0: {
-          TIMELINE_FUNCTION_GC_DURATION(thread, "ForwardLargePages");
-          for (OldPage* large_page =
-                   isolate_group_->heap()->old_space()->large_pages_;
-               large_page != NULL; large_page = large_page->next()) {
-            large_page->VisitObjectPointers(compactor_);
-          }
-          break;
-        }
-        case 1: {
           TIMELINE_FUNCTION_GC_DURATION(thread, "ForwardNewSpace");
           isolate_group_->heap()->new_space()->VisitObjectPointers(compactor_);
           break;
         }
-        case 2: {
+        case 1: {
           TIMELINE_FUNCTION_GC_DURATION(thread, "ForwardRememberedSet");
           isolate_group_->store_buffer()->VisitObjectPointers(compactor_);
           break;
         }
-        case 3: {
+        case 2: {
           TIMELINE_FUNCTION_GC_DURATION(thread, "ForwardWeakTables");
           isolate_group_->heap()->ForwardWeakTables(compactor_);
           break;
         }
-        case 4: {
+        case 3: {
           TIMELINE_FUNCTION_GC_DURATION(thread, "ForwardWeakHandles");
           isolate_group_->VisitWeakPersistentHandles(compactor_);
           break;
         }
 #ifndef PRODUCT
-        case 5: {
+        case 4: {
           TIMELINE_FUNCTION_GC_DURATION(thread, "ForwardObjectIdRing");
           isolate_group_->ForEachIsolate(
               [&](Isolate* isolate) {
@@ -434,6 +431,16 @@ void CompactorTask::RunEnteredIsolateGroup() {
       }
     }
 
+    // Large pages are handed out one at a time, so every worker that has run
+    // out of exclusive forwarding tasks helps drain them.
+    {
+      TIMELINE_FUNCTION_GC_DURATION(thread, "ForwardLargePages");
+      for (OldPage* large_page = compactor_->NextLargePage();
+           large_page != NULL; large_page = compactor_->NextLargePage()) {
+        large_page->VisitObjectPointers(compactor_);
+      }
+    }
+
     barrier_->Sync();
   }
 }
@@ -570,6 +577,19 @@ void CompactorTask::PlanMoveToContiguousSize(intptr_t size) {
   }
 }
 
+void GCCompactor::SetupLargePages() {
+  large_pages_cursor_ = heap_->old_space()->large_pages_;
+}
+
+OldPage* GCCompactor::NextLargePage() {
+  MutexLocker ml(&large_pages_mutex_);
+  OldPage* page = large_pages_cursor_;
+  if (page != nullptr) {
+    large_pages_cursor_ = page->next();
+  }
+  return page;
+}
+
 void GCCompactor::SetupImagePageBoundaries() {
   MallocGrowableArray<ImagePageRange> ranges(4);
 
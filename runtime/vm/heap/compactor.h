@@ -36,6 +36,8 @@ class GCCompactor : public ValueObject,
   friend class CompactorTask;
 
   void SetupImagePageBoundaries();
+  void SetupLargePages();
+  OldPage* NextLargePage();
   void ForwardStackPointers();
   void ForwardPointer(ObjectPtr* ptr);
   void VisitTypedDataViewPointers(TypedDataViewPtr view,
@@ -63,6 +65,11 @@ class GCCompactor : public ValueObject,
   intptr_t image_page_hi_ = 0;
   ImagePageRange* image_page_ranges_ = nullptr;
 
+  // Workers take large pages for pointer forwarding one at a time so that a
+  // heap with many large pages does not serialize behind a single worker.
+  Mutex large_pages_mutex_;
+  OldPage* large_pages_cursor_ = nullptr;
+
   // The typed data views whose inner pointer must be updated after sliding is
   // complete.
   Mutex typed_data_view_mutex_;
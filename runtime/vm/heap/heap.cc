@@ -161,6 +161,14 @@ uword Heap::AllocateOld(intptr_t size, OldPage::PageType type) {
   return 0;
 }
 
+// External allocations are absorbed in tiers rather than with an immediate
+// full GC: new-space external data rides along with scavenges once it
+// exceeds a multiple of the semispace, and old-space external data first
+// counts toward the soft threshold that starts concurrent marking; only
+// crossing the hard threshold forces a synchronous mark-sweep. Native
+// buffer lifetimes are declared through the finalizers passed to
+// Dart_NewExternalTypedData and friends, which is what makes the freed
+// memory visible to this accounting.
 void Heap::AllocatedExternal(intptr_t size, Space space) {
   ASSERT(Thread::Current()->no_safepoint_scope_depth() == 0);
   if (space == kNew) {
@@ -419,6 +427,11 @@ void Heap::NotifyIdle(int64_t deadline) {
     } else if (phase == PageSpace::kDone) {
       TIMELINE_FUNCTION_GC_DURATION(thread, "IdleGC");
       StartConcurrentMarking(thread);
+    } else if (phase == PageSpace::kMarking) {
+      // Help the concurrent markers within our pause budget, so that less
+      // work remains for the stop-the-world finalization.
+      TIMELINE_FUNCTION_GC_DURATION(thread, "IdleGC");
+      old_space_.IncrementalMarkWithTimeBudget(deadline);
     }
   }
 }
@@ -892,6 +905,8 @@ const char* Heap::GCReasonToString(GCReason gc_reason) {
       return "debugging";
     case kSendAndExit:
       return "send_and_exit";
+    case kEphemeral:
+      return "ephemeral";
     default:
       UNREACHABLE();
       return "";
@@ -1019,6 +1034,7 @@ static double AvgCollectionPeriod(int64_t run_time, intptr_t collections) {
 void Heap::RecordAfterGC(GCType type) {
   stats_.after_.micros_ = OS::GetCurrentMonotonicMicros();
   int64_t delta = stats_.after_.micros_ - stats_.before_.micros_;
+  isolate_group_->GetGcPauseTimeMetric()->Record(delta);
   if (stats_.type_ == kScavenge) {
     new_space_.AddGCTime(delta);
     new_space_.IncrementCollections();
@@ -1195,6 +1211,48 @@ void Heap::PrintStatsToTimeline(TimelineEventScope* event, GCReason reason) {
                         RoundWordsToKB(stats_.before_.old_.external_in_words));
   event->FormatArgument(arguments + 12, "After.Old.External (kB)", "%" Pd "",
                         RoundWordsToKB(stats_.after_.old_.external_in_words));
+
+  // Phase durations and auxiliary data, named per collector. The slot
+  // meanings mirror the RecordTime/RecordData ids in Scavenger and
+  // PageSpace; keep them in sync when those change.
+  static const char* const scavenger_times[GCStats::kTimeEntries] = {
+      nullptr,          "SafePoint (us)",      "VisitIsolateRoots (us)",
+      "IterateStoreBuffers (us)", "ProcessToSpace (us)", "IterateWeaks (us)",
+  };
+  static const char* const page_space_times[GCStats::kTimeEntries] = {
+      "ConcurrentSweep (us)", "SafePoint (us)",  "MarkObjects (us)",
+      "ResetFreeLists (us)",  "SweepPages (us)", "SweepLargePages (us)",
+  };
+  static const char* const scavenger_data[GCStats::kDataEntries] = {
+      "StoreBufferEntries", nullptr, nullptr, nullptr,
+  };
+  static const char* const page_space_data[GCStats::kDataEntries] = {
+      "GarbageRatio", "GCTimeFraction", "PageGrowth", "AllowedGrowth",
+  };
+  const bool is_scavenge = (stats_.type_ == kScavenge);
+  const char* const* time_names =
+      is_scavenge ? scavenger_times : page_space_times;
+  const char* const* data_names =
+      is_scavenge ? scavenger_data : page_space_data;
+  intptr_t extra = 0;
+  for (intptr_t i = 0; i < GCStats::kTimeEntries; i++) {
+    if (time_names[i] != nullptr) extra++;
+  }
+  for (intptr_t i = 0; i < GCStats::kDataEntries; i++) {
+    if (data_names[i] != nullptr) extra++;
+  }
+  event->SetNumArguments(arguments + 13 + extra);
+  intptr_t argument = arguments + 13;
+  for (intptr_t i = 0; i < GCStats::kTimeEntries; i++) {
+    if (time_names[i] == nullptr) continue;
+    event->FormatArgument(argument, time_names[i], "%" Pd64, stats_.times_[i]);
+    argument++;
+  }
+  for (intptr_t i = 0; i < GCStats::kDataEntries; i++) {
+    if (data_names[i] == nullptr) continue;
+    event->FormatArgument(argument, data_names[i], "%" Pd, stats_.data_[i]);
+    argument++;
+  }
 #endif  // !defined(PRODUCT)
 }
 
@@ -1208,6 +1266,21 @@ Heap::Space Heap::SpaceForExternal(intptr_t size) const {
   }
 }
 
+EphemeralRegionScope::EphemeralRegionScope(Thread* thread,
+                                           intptr_t headroom_in_bytes)
+    : ThreadStackResource(thread),
+      headroom_in_words_(headroom_in_bytes >> kWordSizeLog2) {
+  thread->heap()->new_space()->BeginEphemeralRegion(headroom_in_words_);
+}
+
+EphemeralRegionScope::~EphemeralRegionScope() {
+  Heap* heap = thread()->heap();
+  heap->new_space()->EndEphemeralRegion(headroom_in_words_);
+  // Objects that escaped the scope survive the scavenge and are promoted by
+  // the regular aging policy; everything else is released wholesale.
+  heap->CollectGarbage(Heap::kScavenge, Heap::kEphemeral);
+}
+
 NoHeapGrowthControlScope::NoHeapGrowthControlScope()
     : ThreadStackResource(Thread::Current()) {
   Heap* heap = isolate()->heap();
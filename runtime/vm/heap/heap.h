@@ -68,6 +68,7 @@ class Heap {
     kLowMemory,    // Dart_NotifyLowMemory
     kDebugging,    // service request, etc.
     kSendAndExit,  // SendPort.sendAndExit
+    kEphemeral,    // Heap::EphemeralRegionScope was left.
   };
 
   // Pattern for unused new space and swept old space.
@@ -465,6 +466,22 @@ class HeapIterationScope : public ThreadStackResource {
   DISALLOW_COPY_AND_ASSIGN(HeapIterationScope);
 };
 
+// Scopes an operation that builds a large, mostly short-lived object graph,
+// such as decoding a big payload. While the scope is active, new space may
+// grow by [headroom_in_bytes] beyond its normal maximum so the graph is
+// bump-allocated in the young generation instead of spilling into old space.
+// Leaving the scope scavenges: objects that escaped the scope are promoted
+// and the rest of the region is released wholesale.
+class EphemeralRegionScope : public ThreadStackResource {
+ public:
+  EphemeralRegionScope(Thread* thread, intptr_t headroom_in_bytes);
+  ~EphemeralRegionScope();
+
+ private:
+  const intptr_t headroom_in_words_;
+  DISALLOW_COPY_AND_ASSIGN(EphemeralRegionScope);
+};
+
 class NoHeapGrowthControlScope : public ThreadStackResource {
  public:
   NoHeapGrowthControlScope();
@@ -5,10 +5,12 @@
 #include "vm/heap/marker.h"
 
 #include "platform/atomic.h"
+#include "platform/utils.h"
 #include "vm/allocation.h"
 #include "vm/dart_api_state.h"
 #include "vm/heap/pages.h"
 #include "vm/heap/pointer_block.h"
+#include "vm/heap/weak_table.h"
 #include "vm/isolate.h"
 #include "vm/log.h"
 #include "vm/object_id_ring.h"
@@ -35,6 +37,8 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
         work_list_(marking_stack),
         deferred_work_list_(deferred_marking_stack),
         delayed_weak_properties_(nullptr),
+        prefetch_head_(0),
+        prefetch_count_(0),
         marked_bytes_(0),
         marked_micros_(0) {
     ASSERT(thread_->isolate_group() == isolate_group);
@@ -72,10 +76,34 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
     return marked;
   }
 
+  // Refills the prefetch queue from the marking stack and pops its oldest
+  // entry. Objects spend a few iterations in the queue between being popped
+  // from the marking stack and being scanned, giving the prefetch of their
+  // header time to complete. Returns nullptr only when both the queue and the
+  // marking stack are empty, so a visitor with an empty queue holds no work.
+  ObjectPtr PopPrefetched() {
+    while (prefetch_count_ < kPrefetchQueueDepth) {
+      ObjectPtr raw_obj = work_list_.Pop();
+      if (raw_obj == nullptr) break;
+      Utils::Prefetch(raw_obj->ptr());
+      prefetch_queue_[(prefetch_head_ + prefetch_count_) &
+                      (kPrefetchQueueDepth - 1)] = raw_obj;
+      prefetch_count_++;
+    }
+    if (prefetch_count_ == 0) {
+      return nullptr;
+    }
+    ObjectPtr raw_obj =
+        prefetch_queue_[prefetch_head_ & (kPrefetchQueueDepth - 1)];
+    prefetch_head_++;
+    prefetch_count_--;
+    return raw_obj;
+  }
+
   void DrainMarkingStack() {
-    ObjectPtr raw_obj = work_list_.Pop();
+    ObjectPtr raw_obj = PopPrefetched();
     if ((raw_obj == nullptr) && ProcessPendingWeakProperties()) {
-      raw_obj = work_list_.Pop();
+      raw_obj = PopPrefetched();
     }
 
     if (raw_obj == nullptr) {
@@ -95,8 +123,17 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
           size = ProcessWeakProperty(raw_weak, /* did_mark */ true);
         }
         marked_bytes_ += size;
+        if (size > kPrefetchRevisitSize) {
+          // Scanning a large object may have evicted the queued objects'
+          // headers from the cache; ask for them again.
+          for (intptr_t i = 0; i < prefetch_count_; i++) {
+            Utils::Prefetch(prefetch_queue_[(prefetch_head_ + i) &
+                                            (kPrefetchQueueDepth - 1)]
+                                ->ptr());
+          }
+        }
 
-        raw_obj = work_list_.Pop();
+        raw_obj = PopPrefetched();
       } while (raw_obj != nullptr);
 
       // Marking stack is empty.
@@ -104,10 +141,65 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
 
       // Check whether any further work was pushed either by other markers or
       // by the handling of weak properties.
-      raw_obj = work_list_.Pop();
+      raw_obj = PopPrefetched();
     } while (raw_obj != nullptr);
   }
 
+  // Drains the marking stack until the deadline passes, checking the clock
+  // only every kDeadlineCheckBatch objects to keep the hot loop cheap. Unlike
+  // DrainMarkingStack, pending weak properties are kept for a later slice or
+  // for finalization, and work may remain on the marking stack on return.
+  void DrainMarkingStackWithPauseBudget(int64_t deadline) {
+    intptr_t countdown = kDeadlineCheckBatch;
+    for (;;) {
+      ObjectPtr raw_obj = PopPrefetched();
+      if (raw_obj == nullptr) {
+        return;
+      }
+
+      const intptr_t class_id = raw_obj->GetClassId();
+      intptr_t size;
+      if (class_id != kWeakPropertyCid) {
+        size = raw_obj->ptr()->VisitPointersNonvirtual(this);
+      } else {
+        WeakPropertyPtr raw_weak = static_cast<WeakPropertyPtr>(raw_obj);
+        size = ProcessWeakProperty(raw_weak, /* did_mark */ true);
+      }
+      marked_bytes_ += size;
+
+      if (--countdown == 0) {
+        countdown = kDeadlineCheckBatch;
+        if (OS::GetCurrentMonotonicMicros() >= deadline) {
+          FlushPrefetchQueue();
+          return;
+        }
+      }
+    }
+  }
+
+  // Detaches and returns this visitor's weak properties whose keys have not
+  // yet been marked, linked through their next_ fields.
+  WeakPropertyPtr TakePendingWeakProperties() {
+    WeakPropertyPtr head = delayed_weak_properties_;
+    delayed_weak_properties_ = nullptr;
+    return head;
+  }
+
+  // Splices a list of weak properties produced by another visitor onto this
+  // visitor's delayed list, so they are considered during weak reference
+  // processing even though the producing visitor has been retired.
+  void AdoptPendingWeakProperties(WeakPropertyPtr head) {
+    if (head == nullptr) {
+      return;
+    }
+    WeakPropertyPtr tail = head;
+    while (tail->ptr()->next_ != 0) {
+      tail = static_cast<WeakPropertyPtr>(tail->ptr()->next_);
+    }
+    tail->ptr()->next_ = static_cast<uword>(delayed_weak_properties_);
+    delayed_weak_properties_ = head;
+  }
+
   // Races: The concurrent marker is racing with the mutator, but this race is
   // harmless. The concurrent marker will only visit objects that were created
   // before the marker started. It will ignore all new-space objects based on
@@ -204,6 +296,17 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
   }
 
  private:
+  // Returns the queued objects to the marking stack, so that no work is
+  // stranded in this visitor when a budgeted drain runs out of time.
+  void FlushPrefetchQueue() {
+    while (prefetch_count_ > 0) {
+      work_list_.Push(
+          prefetch_queue_[prefetch_head_ & (kPrefetchQueueDepth - 1)]);
+      prefetch_head_++;
+      prefetch_count_--;
+    }
+  }
+
   void PushMarked(ObjectPtr raw_obj) {
     ASSERT(raw_obj->IsHeapObject());
     ASSERT(raw_obj->IsOldObject());
@@ -262,11 +365,22 @@ class MarkingVisitorBase : public ObjectPointerVisitor {
     PushMarked(raw_obj);
   }
 
+  // Must be a power of two so the queue indices can wrap with a mask.
+  static const intptr_t kPrefetchQueueDepth = 8;
+  // Scanning an object bigger than this likely evicts the prefetched headers
+  // of the queued objects.
+  static const intptr_t kPrefetchRevisitSize = 2 * KB;
+  // How many objects a budgeted drain scans between deadline checks.
+  static const intptr_t kDeadlineCheckBatch = 64;
+
   Thread* thread_;
   PageSpace* page_space_;
   MarkerWorkList work_list_;
   MarkerWorkList deferred_work_list_;
   WeakPropertyPtr delayed_weak_properties_;
+  ObjectPtr prefetch_queue_[kPrefetchQueueDepth];
+  intptr_t prefetch_head_;
+  intptr_t prefetch_count_;
   uintptr_t marked_bytes_;
   int64_t marked_micros_;
 
@@ -373,16 +487,19 @@ void GCMarker::IterateRoots(ObjectPointerVisitor* visitor) {
 
 enum WeakSlices {
   kWeakHandles = 0,
-  kWeakTables,
   kObjectIdRing,
   kRememberedSet,
-  kNumWeakSlices,
+  kNumFixedWeakSlices,
+  // Plus one slice per old-space weak table selector, so that no single
+  // worker is stuck processing all of the tables.
 };
 
 void GCMarker::IterateWeakRoots(Thread* thread) {
+  const intptr_t num_weak_slices =
+      kNumFixedWeakSlices + Heap::kNumWeakSelectors;
   for (;;) {
     intptr_t slice = weak_slices_started_.fetch_add(1);
-    if (slice >= kNumWeakSlices) {
+    if (slice >= num_weak_slices) {
       return;  // No more slices.
     }
 
@@ -390,9 +507,6 @@ void GCMarker::IterateWeakRoots(Thread* thread) {
       case kWeakHandles:
         ProcessWeakHandles(thread);
         break;
-      case kWeakTables:
-        ProcessWeakTables(thread);
-        break;
       case kObjectIdRing:
         ProcessObjectIdTable(thread);
         break;
@@ -400,7 +514,8 @@ void GCMarker::IterateWeakRoots(Thread* thread) {
         ProcessRememberedSet(thread);
         break;
       default:
-        UNREACHABLE();
+        ProcessWeakTable(thread, slice - kNumFixedWeakSlices);
+        break;
     }
   }
 }
@@ -411,19 +526,23 @@ void GCMarker::ProcessWeakHandles(Thread* thread) {
   ApiState* state = isolate_group_->api_state();
   ASSERT(state != NULL);
   isolate_group_->VisitWeakPersistentHandles(&visitor);
+  if (FLAG_background_finalizers) {
+    state->ScheduleBackgroundFinalization(isolate_group_);
+  }
 }
 
-void GCMarker::ProcessWeakTables(Thread* thread) {
-  TIMELINE_FUNCTION_GC_DURATION(thread, "ProcessWeakTables");
-  for (int sel = 0; sel < Heap::kNumWeakSelectors; sel++) {
-    WeakTable* table =
-        heap_->GetWeakTable(Heap::kOld, static_cast<Heap::WeakSelector>(sel));
-    intptr_t size = table->size();
+void GCMarker::ProcessWeakTable(Thread* thread, intptr_t sel) {
+  TIMELINE_FUNCTION_GC_DURATION(thread, "ProcessWeakTable");
+  WeakTable* table =
+      heap_->GetWeakTable(Heap::kOld, static_cast<Heap::WeakSelector>(sel));
+  for (intptr_t s = 0; s < WeakTable::kNumShards; s++) {
+    WeakTable::Shard* shard = table->GetShard(s);
+    intptr_t size = shard->size();
     for (intptr_t i = 0; i < size; i++) {
-      if (table->IsValidEntryAtExclusive(i)) {
-        ObjectPtr raw_obj = table->ObjectAtExclusive(i);
+      if (shard->IsValidEntryAtExclusive(i)) {
+        ObjectPtr raw_obj = shard->ObjectAtExclusive(i);
         if (raw_obj->IsHeapObject() && !raw_obj->ptr()->IsMarked()) {
-          table->InvalidateAtExclusive(i);
+          shard->InvalidateAtExclusive(i);
         }
       }
     }
@@ -700,6 +819,7 @@ GCMarker::GCMarker(IsolateGroup* isolate_group, Heap* heap)
       heap_(heap),
       marking_stack_(),
       visitors_(),
+      incremental_visitor_(NULL),
       marked_bytes_(0),
       marked_micros_(0) {
   visitors_ = new SyncMarkingVisitor*[FLAG_marker_tasks];
@@ -717,6 +837,10 @@ GCMarker::~GCMarker() {
       visitors_[i]->AbandonWork();
       delete visitors_[i];
     }
+    if (incremental_visitor_ != NULL) {
+      incremental_visitor_->AbandonWork();
+      delete incremental_visitor_;
+    }
   }
   delete[] visitors_;
 }
@@ -746,7 +870,7 @@ void GCMarker::StartConcurrentMark(PageSpace* page_space) {
         isolate_group_, page_space, &marking_stack_, &deferred_marking_stack_);
 
     // Begin marking on a helper thread.
-    bool result = Dart::thread_pool()->Run<ConcurrentMarkTask>(
+    bool result = isolate_group_->gc_thread_pool()->Run<ConcurrentMarkTask>(
         this, isolate_group_, page_space, visitors_[i]);
     ASSERT(result);
   }
@@ -760,6 +884,43 @@ void GCMarker::StartConcurrentMark(PageSpace* page_space) {
   }
 }
 
+void GCMarker::IncrementalMarkWithTimeBudget(PageSpace* page_space,
+                                             int64_t deadline) {
+  // Only safepoint operations call this, so even though the visitor survives
+  // across slices it is never used by two threads at once. The concurrent
+  // marker tasks only share the marking stack with it, which is thread-safe.
+  Thread* thread = Thread::Current();
+  TIMELINE_FUNCTION_GC_DURATION(thread, "IncrementalMark");
+  int64_t start = OS::GetCurrentMonotonicMicros();
+  if (incremental_visitor_ == NULL) {
+    incremental_visitor_ = new SyncMarkingVisitor(
+        isolate_group_, page_space, &marking_stack_, &deferred_marking_stack_);
+  }
+  incremental_visitor_->DrainMarkingStackWithPauseBudget(deadline);
+  int64_t stop = OS::GetCurrentMonotonicMicros();
+  incremental_visitor_->AddMicros(stop - start);
+}
+
+template <class MarkingVisitorType>
+void GCMarker::RetireIncrementalVisitor(MarkingVisitorType* target) {
+  if (incremental_visitor_ == NULL) {
+    return;
+  }
+  // Weak properties the incremental visitor could not yet resolve move to a
+  // visitor that survives until weak reference processing; its unprocessed
+  // work returns to the marking stack.
+  target->AdoptPendingWeakProperties(
+      incremental_visitor_->TakePendingWeakProperties());
+  {
+    MutexLocker ml(&stats_mutex_);
+    marked_bytes_ += incremental_visitor_->marked_bytes();
+    marked_micros_ += incremental_visitor_->marked_micros();
+  }
+  incremental_visitor_->AbandonWork();
+  delete incremental_visitor_;
+  incremental_visitor_ = NULL;
+}
+
 void GCMarker::MarkObjects(PageSpace* page_space) {
   if (isolate_group_->marking_stack() != NULL) {
     isolate_group_->DisableIncrementalBarrier();
@@ -775,6 +936,7 @@ void GCMarker::MarkObjects(PageSpace* page_space) {
       // Mark everything on main thread.
       UnsyncMarkingVisitor mark(isolate_group_, page_space, &marking_stack_,
                                 &deferred_marking_stack_);
+      RetireIncrementalVisitor(&mark);
       ResetSlices();
       IterateRoots(&mark);
       mark.ProcessDeferredMarking();
@@ -801,9 +963,12 @@ void GCMarker::MarkObjects(PageSpace* page_space) {
               new SyncMarkingVisitor(isolate_group_, page_space,
                                      &marking_stack_, &deferred_marking_stack_);
         }
+        if (i == 0) {
+          RetireIncrementalVisitor(visitor);
+        }
         if (i < (num_tasks - 1)) {
           // Begin marking on a helper thread.
-          bool result = Dart::thread_pool()->Run<ParallelMarkTask>(
+          bool result = isolate_group_->gc_thread_pool()->Run<ParallelMarkTask>(
               this, isolate_group_, &marking_stack_, &barrier, visitor,
               &num_busy);
           ASSERT(result);
@@ -38,6 +38,12 @@ class GCMarker {
   // Marking must later be finalized by calling MarkObjects.
   void StartConcurrentMark(PageSpace* page_space);
 
+  // Drain some of the marking queue on the caller's thread until the deadline
+  // (in monotonic micros) passes. Called between StartConcurrentMark and
+  // MarkObjects to pay down marking debt with idle time, shortening the
+  // eventual finalizing pause. Must only be called by safepoint operations.
+  void IncrementalMarkWithTimeBudget(PageSpace* page_space, int64_t deadline);
+
   // (Re)mark roots, drain the marking queue and finalize weak references.
   // Does not required StartConcurrentMark to have been previously called.
   void MarkObjects(PageSpace* page_space);
@@ -52,7 +58,7 @@ class GCMarker {
   void IterateRoots(ObjectPointerVisitor* visitor);
   void IterateWeakRoots(Thread* thread);
   void ProcessWeakHandles(Thread* thread);
-  void ProcessWeakTables(Thread* thread);
+  void ProcessWeakTable(Thread* thread, intptr_t sel);
   void ProcessRememberedSet(Thread* thread);
   void ProcessObjectIdTable(Thread* thread);
 
@@ -60,11 +66,17 @@ class GCMarker {
   template <class MarkingVisitorType>
   void FinalizeResultsFrom(MarkingVisitorType* visitor);
 
+  // Transfers the incremental visitor's pending weak properties to 'target'
+  // and returns its unprocessed work to the marking queue, then deletes it.
+  template <class MarkingVisitorType>
+  void RetireIncrementalVisitor(MarkingVisitorType* target);
+
   IsolateGroup* const isolate_group_;
   Heap* const heap_;
   MarkingStack marking_stack_;
   MarkingStack deferred_marking_stack_;
   MarkingVisitorBase<true>** visitors_;
+  MarkingVisitorBase<true>* incremental_visitor_;
 
   NewPage* new_page_;
   Monitor root_slices_monitor_;
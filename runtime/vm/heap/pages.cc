@@ -6,6 +6,7 @@
 
 #include "platform/assert.h"
 #include "platform/leak_sanitizer.h"
+#include "platform/memory_sanitizer.h"
 #include "vm/dart.h"
 #include "vm/heap/become.h"
 #include "vm/heap/compactor.h"
@@ -43,16 +44,60 @@ DEFINE_FLAG(bool,
             "Print free list statistics after a GC");
 DEFINE_FLAG(bool, log_growth, false, "Log PageSpace growth policy decisions.");
 
+// Old-space counterpart to the semispace page cache in scavenger.cc. In a
+// process that churns through isolates, recycling pages here avoids repeated
+// mmap/munmap calls for the fixed-size data pages. Unlike the semispace
+// cache, cached pages are decommitted so they hold on to address space but
+// not physical memory.
+static constexpr intptr_t kPageCacheCapacity = 8 * kWordSize;
+static Mutex* page_cache_mutex = nullptr;
+static VirtualMemory* page_cache[kPageCacheCapacity] = {nullptr};
+static intptr_t page_cache_size = 0;
+
+void OldPage::Init() {
+  ASSERT(page_cache_mutex == nullptr);
+  page_cache_mutex = new Mutex(NOT_IN_PRODUCT("page_cache_mutex"));
+}
+
+void OldPage::Cleanup() {
+  {
+    MutexLocker ml(page_cache_mutex);
+    ASSERT(page_cache_size >= 0);
+    ASSERT(page_cache_size <= kPageCacheCapacity);
+    while (page_cache_size > 0) {
+      delete page_cache[--page_cache_size];
+    }
+  }
+  delete page_cache_mutex;
+  page_cache_mutex = nullptr;
+}
+
+intptr_t OldPage::CachedSize() {
+  return page_cache_size * kOldPageSize;
+}
+
 OldPage* OldPage::Allocate(intptr_t size_in_words,
                            PageType type,
                            const char* name) {
   const bool executable = type == kExecutable;
 
-  VirtualMemory* memory = VirtualMemory::AllocateAligned(
-      size_in_words << kWordSizeLog2, kOldPageSize, executable, name);
+  VirtualMemory* memory = nullptr;
+  if (!executable && (size_in_words == kOldPageSizeInWords)) {
+    MutexLocker ml(page_cache_mutex);
+    ASSERT(page_cache_size >= 0);
+    ASSERT(page_cache_size <= kPageCacheCapacity);
+    if (page_cache_size > 0) {
+      memory = page_cache[--page_cache_size];
+    }
+  }
+  if (memory == nullptr) {
+    memory = VirtualMemory::AllocateAligned(size_in_words << kWordSizeLog2,
+                                            kOldPageSize, executable, name);
+  }
   if (memory == NULL) {
     return NULL;
   }
+  MSAN_UNPOISON(memory->address(), size_in_words << kWordSizeLog2);
 
   OldPage* result = reinterpret_cast<OldPage*>(memory->address());
   ASSERT(result != NULL);
@@ -61,6 +106,7 @@ OldPage* OldPage::Allocate(intptr_t size_in_words,
   result->used_in_bytes_ = 0;
   result->forwarding_page_ = NULL;
   result->card_table_ = NULL;
+  result->sweep_claim_ = 0;
   result->type_ = type;
 
   LSAN_REGISTER_ROOT_REGION(result, sizeof(*result));
@@ -80,9 +126,24 @@ void OldPage::Deallocate() {
     LSAN_UNREGISTER_ROOT_REGION(this, sizeof(*this));
   }
 
-  // For a regular heap pages, the memory for this object will become
-  // unavailable after the delete below.
-  delete memory_;
+  // For a regular heap page, the memory for this object will become
+  // unavailable after the recycle or delete below.
+  VirtualMemory* memory = memory_;
+  if (!image_page && (type_ != kExecutable) &&
+      (memory->size() == kOldPageSize)) {
+    MutexLocker ml(page_cache_mutex);
+    ASSERT(page_cache_size >= 0);
+    ASSERT(page_cache_size <= kPageCacheCapacity);
+    if (page_cache_size < kPageCacheCapacity) {
+      // Return the physical memory to the OS, so an idle cached page costs
+      // only address space.
+      VirtualMemory::DontNeed(memory->address(), memory->size());
+      MSAN_POISON(memory->address(), memory->size());
+      page_cache[page_cache_size++] = memory;
+      memory = nullptr;
+    }
+  }
+  delete memory;
 
   // For a heap page from a snapshot, the OldPage object lives in the malloc
   // heap rather than the page itself.
@@ -136,6 +197,15 @@ void OldPage::VisitRememberedCards(ObjectPointerVisitor* visitor) {
 
   const intptr_t size = card_table_size();
   for (intptr_t i = 0; i < size; i++) {
+    // Skip runs of clean cards a word at a time. For a large page that saw
+    // few stores since the last scavenge, walking the table dominates over
+    // visiting the dirty cards.
+    if (((i % sizeof(uword)) == 0) &&
+        ((size - i) >= static_cast<intptr_t>(sizeof(uword))) &&
+        (*reinterpret_cast<const uword*>(&card_table_[i]) == 0)) {
+      i += sizeof(uword) - 1;  // Loop increment adds 1.
+      continue;
+    }
     if (card_table_[i] != 0) {
       ObjectPtr* card_from =
           reinterpret_cast<ObjectPtr*>(this) + (i << kSlotsPerCardLog2);
@@ -425,6 +495,16 @@ void PageSpace::FreePage(OldPage* page, OldPage* previous_page) {
   {
     MutexLocker ml(&pages_lock_);
     IncreaseCapacityInWordsLocked(-(page->memory_->size() >> kWordSizeLog2));
+    // Keep the unswept cursor away from the page being removed.
+    if (sweep_regular_ == page) {
+      sweep_regular_ = (page == sweep_regular_last_) ? nullptr : page->next();
+    }
+    if (sweep_regular_last_ == page) {
+      sweep_regular_last_ = previous_page;
+      if (previous_page == nullptr) {
+        sweep_regular_ = nullptr;
+      }
+    }
     if (is_exec) {
       RemoveExecPageLocked(page, previous_page);
     } else {
@@ -532,6 +612,47 @@ uword PageSpace::TryAllocateInFreshLargePage(intptr_t size,
   return result;
 }
 
+uword PageSpace::TryAllocateFromUnsweptPages(FreeList* freelist,
+                                             intptr_t size,
+                                             bool is_locked) {
+  GCSweeper sweeper;
+  for (;;) {
+    OldPage* page;
+    {
+      // The claim must be taken while holding pages_lock_: the sweeper task
+      // reacquires the lock in FreePage before deallocating a page it swept,
+      // so a page popped from the cursor cannot disappear under us here.
+      MutexLocker ml(&pages_lock_);
+      do {
+        page = sweep_regular_;
+        if (page == nullptr) {
+          return 0;  // No concurrent sweep in progress, or it passed us.
+        }
+        sweep_regular_ =
+            (page == sweep_regular_last_) ? nullptr : page->next();
+      } while (!page->TryClaimSweep());
+    }
+    ASSERT(page->type() == OldPage::kData);
+    bool page_in_use = sweeper.SweepPage(page, freelist, is_locked);
+    if (!page_in_use) {
+      // The page is completely free. Unlinking it would race with the
+      // sweeper task's traversal of the page list, so keep it and hand its
+      // whole span to the freelist instead.
+      intptr_t free_size = page->object_end() - page->object_start();
+      if (is_locked) {
+        freelist->FreeLocked(page->object_start(), free_size);
+      } else {
+        freelist->Free(page->object_start(), free_size);
+      }
+    }
+    uword result = is_locked ? freelist->TryAllocateLocked(size, false)
+                             : freelist->TryAllocate(size, false);
+    if (result != 0) {
+      return result;
+    }
+  }
+}
+
 uword PageSpace::TryAllocateInternal(intptr_t size,
                                      FreeList* freelist,
                                      OldPage::PageType type,
@@ -547,6 +668,22 @@ uword PageSpace::TryAllocateInternal(intptr_t size,
     } else {
       result = freelist->TryAllocate(size, is_protected);
     }
+    if ((result == 0) && (type == OldPage::kData)) {
+      // Before growing the heap, try to reclaim free space from pages the
+      // concurrent sweeper has not reached yet.
+      result = TryAllocateFromUnsweptPages(freelist, size, is_locked);
+    }
+    if ((result == 0) && (type == OldPage::kData) && !is_locked) {
+      // This thread's data freelist shard is empty; steal from the other
+      // shards before growing the heap.
+      const intptr_t num_shards = num_freelists_ - 1;
+      for (intptr_t i = 0; i < num_shards; i++) {
+        FreeList* shard = DataFreeList(i);
+        if (shard == freelist) continue;
+        result = shard->TryAllocate(size, is_protected);
+        if (result != 0) break;
+      }
+    }
     if (result == 0) {
       result = TryAllocateInFreshPage(size, freelist, type, growth_policy,
                                       is_locked);
@@ -1127,6 +1264,20 @@ void PageSpace::CollectGarbage(bool compact, bool finalize) {
   }
 }
 
+void PageSpace::IncrementalMarkWithTimeBudget(int64_t deadline) {
+  {
+    MonitorLocker ml(tasks_lock());
+    if (phase() != kMarking) {
+      return;
+    }
+  }
+  // A safepoint operation holds off the finalizing collection that would
+  // delete the marker, so it remains valid even if the concurrent marker
+  // tasks finish while we mark.
+  ASSERT(marker_ != NULL);
+  marker_->IncrementalMarkWithTimeBudget(this, deadline);
+}
+
 void PageSpace::CollectGarbageHelper(bool compact,
                                      bool finalize,
                                      int64_t pre_wait_for_sweepers,
@@ -1334,6 +1485,18 @@ void PageSpace::Sweep() {
 }
 
 void PageSpace::ConcurrentSweep(IsolateGroup* isolate_group) {
+  {
+    // Publish the unswept data pages, so allocating threads can sweep them
+    // on demand instead of waiting for the sweeper task. Still at a
+    // safepoint, so claims from the previous sweep can be reset in place.
+    MutexLocker ml(&pages_lock_);
+    for (OldPage* page = pages_; page != nullptr; page = page->next()) {
+      page->ResetSweepClaim();
+    }
+    sweep_regular_ = pages_;
+    sweep_regular_last_ = pages_tail_;
+  }
+
   // Start the concurrent sweeper task now.
   GCSweeper::SweepConcurrent(isolate_group, pages_, pages_tail_, large_pages_,
                              large_pages_tail_, &freelists_[OldPage::kData]);
@@ -1424,6 +1587,7 @@ void PageSpace::SetupImagePage(void* pointer, uword size, bool is_executable) {
   page->used_in_bytes_ = page->object_end_ - page->object_start();
   page->forwarding_page_ = NULL;
   page->card_table_ = NULL;
+  page->sweep_claim_ = 0;
   if (is_executable) {
     page->type_ = OldPage::kExecutable;
   } else {
@@ -41,6 +41,10 @@ class OldPage {
  public:
   enum PageType { kExecutable = 0, kData };
 
+  static void Init();
+  static void Cleanup();
+  static intptr_t CachedSize();
+
   OldPage* next() const { return next_; }
   void set_next(OldPage* next) { next_ = next; }
 
@@ -58,6 +62,17 @@ class OldPage {
   ForwardingPage* forwarding_page() const { return forwarding_page_; }
   void AllocateForwardingPage();
 
+  // During concurrent sweeping, the first thread to claim a page sweeps it:
+  // either the sweeper task during its traversal of the page list, or an
+  // allocating thread that pulled the page from the unswept cursor because
+  // its freelist was empty. Claims are reset when the next sweep starts.
+  bool TryClaimSweep() {
+    uword expected = 0;
+    return sweep_claim_.compare_exchange_strong(expected, 1,
+                                                std::memory_order_acq_rel);
+  }
+  void ResetSweepClaim() { sweep_claim_ = 0; }
+
   PageType type() const { return type_; }
 
   bool is_image_page() const { return !memory_->vm_owns_region(); }
@@ -168,6 +183,7 @@ class OldPage {
   uword used_in_bytes_;
   ForwardingPage* forwarding_page_;
   uint8_t* card_table_;  // Remembered set, not marking.
+  RelaxedAtomic<uword> sweep_claim_;
   PageType type_;
 
   friend class PageSpace;
@@ -232,6 +248,12 @@ class PageSpaceController {
 
   void set_last_usage(SpaceUsage current) { last_usage_ = current; }
 
+  // The observed fraction of wall time spent in the mutator over the sliding
+  // window of recent collections, in percent.
+  int MutatorUtilization() {
+    return 100 - history_.GarbageCollectionTimeFraction();
+  }
+
   void Enable() { is_enabled_ = true; }
   void Disable() { is_enabled_ = false; }
   bool is_enabled() { return is_enabled_; }
@@ -303,7 +325,10 @@ class PageSpace {
     bool is_protected =
         (type == OldPage::kExecutable) && FLAG_write_protect_code;
     bool is_locked = false;
-    return TryAllocateInternal(size, &freelists_[type], type, growth_policy,
+    FreeList* freelist = (type == OldPage::kData)
+                             ? DataFreeListForThread(Thread::Current())
+                             : &freelists_[type];
+    return TryAllocateInternal(size, freelist, type, growth_policy,
                                is_protected, is_locked);
   }
 
@@ -326,6 +351,10 @@ class PageSpace {
   }
   void HintFreed(intptr_t size) { page_space_controller_.HintFreed(size); }
 
+  int mutator_utilization() {
+    return page_space_controller_.MutatorUtilization();
+  }
+
   int64_t UsedInWords() const { return usage_.used_in_words; }
   int64_t CapacityInWords() const {
     MutexLocker ml(&pages_lock_);
@@ -377,6 +406,11 @@ class PageSpace {
   // Collect the garbage in the page space using mark-sweep or mark-compact.
   void CollectGarbage(bool compact, bool finalize);
 
+  // Pay down some marking debt on the caller's thread until the deadline (in
+  // monotonic micros) passes. Does nothing unless concurrent marking is in
+  // progress. Must only be called by safepoint operations.
+  void IncrementalMarkWithTimeBudget(int64_t deadline);
+
   void AddRegionsToObjectSet(ObjectSet* set) const;
 
   void InitGrowthControl() {
@@ -434,6 +468,15 @@ class PageSpace {
   FreeList* DataFreeList(intptr_t i = 0) {
     return &freelists_[OldPage::kData + i];
   }
+
+  // Spreads old-space allocations from different mutator threads over the
+  // data freelist shards, so they do not all contend on a single freelist
+  // mutex. The sweeper already refills the shards round-robin.
+  FreeList* DataFreeListForThread(Thread* thread) {
+    const intptr_t num_shards = num_freelists_ - 1;
+    const uword hash = reinterpret_cast<uword>(thread) >> 6;
+    return DataFreeList(hash % num_shards);
+  }
   void AcquireLock(FreeList* freelist);
   void ReleaseLock(FreeList* freelist);
 
@@ -522,6 +565,9 @@ class PageSpace {
   uword TryAllocateInFreshLargePage(intptr_t size,
                                     OldPage::PageType type,
                                     GrowthPolicy growth_policy);
+  uword TryAllocateFromUnsweptPages(FreeList* freelist,
+                                    intptr_t size,
+                                    bool is_locked);
 
   void EvaluateConcurrentMarking(GrowthPolicy growth_policy);
 
@@ -587,6 +633,13 @@ class PageSpace {
   OldPage* large_pages_tail_ = nullptr;
   OldPage* image_pages_ = nullptr;
 
+  // Cursor over the data pages that the current concurrent sweep has not yet
+  // reached. Allocating threads whose freelist is empty may take and sweep
+  // pages from here instead of growing the heap or waiting for the sweeper.
+  // Guarded by pages_lock_.
+  OldPage* sweep_regular_ = nullptr;
+  OldPage* sweep_regular_last_ = nullptr;
+
   // Various sizes being tracked for this generation.
   intptr_t max_capacity_in_words_;
 
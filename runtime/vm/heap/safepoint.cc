@@ -5,8 +5,10 @@
 #include "vm/heap/safepoint.h"
 
 #include "vm/heap/heap.h"
+#include "vm/os.h"
 #include "vm/thread.h"
 #include "vm/thread_registry.h"
+#include "vm/timeline.h"
 
 namespace dart {
 
@@ -84,6 +86,8 @@ SafepointHandler::SafepointHandler(IsolateGroup* isolate_group)
     : isolate_group_(isolate_group),
       safepoint_lock_(),
       number_threads_not_at_safepoint_(0),
+      last_to_check_in_name_(NULL),
+      last_to_check_in_tag_(VMTag::kInvalidTagId),
       safepoint_operation_count_(0),
       owner_(NULL) {}
 
@@ -97,6 +101,7 @@ void SafepointHandler::SafepointThreads(Thread* T) {
   ASSERT(T->no_safepoint_scope_depth() == 0);
   ASSERT(T->execution_state() == Thread::kThreadInVM);
 
+  int64_t start_time = 0;
   {
     // First grab the threads list lock for this isolate
     // and check if a safepoint is already in progress. This
@@ -120,6 +125,13 @@ void SafepointHandler::SafepointThreads(Thread* T) {
     // Set safepoint in progress state by this thread.
     SetSafepointInProgress(T);
 
+    {
+      MonitorLocker sl(&safepoint_lock_);
+      last_to_check_in_name_ = NULL;
+      last_to_check_in_tag_ = VMTag::kInvalidTagId;
+    }
+    start_time = OS::GetCurrentMonotonicMicros();
+
     // Go over the active thread list and ensure that all threads active
     // in the isolate reach a safepoint.
     Thread* current = isolate_group()->thread_registry()->active_list();
@@ -145,6 +157,8 @@ void SafepointHandler::SafepointThreads(Thread* T) {
     }
   }
   // Now wait for all threads that are not already at a safepoint to check-in.
+  const char* last_name = NULL;
+  uword last_tag = VMTag::kInvalidTagId;
   {
     MonitorLocker sl(&safepoint_lock_);
     intptr_t num_attempts = 0;
@@ -167,7 +181,30 @@ void SafepointHandler::SafepointThreads(Thread* T) {
         }
       }
     }
+    last_name = last_to_check_in_name_;
+    last_tag = last_to_check_in_tag_;
+  }
+  const int64_t end_time = OS::GetCurrentMonotonicMicros();
+  isolate_group()->GetTimeToSafepointMaxMetric()->SetValue(end_time -
+                                                           start_time);
+  isolate_group()->GetTimeToSafepointMetric()->Record(end_time - start_time);
+#if defined(SUPPORT_TIMELINE)
+  TimelineStream* stream = Timeline::GetVMStream();
+  ASSERT(stream != nullptr);
+  TimelineEvent* event = stream->StartEvent();
+  if (event != nullptr) {
+    event->Duration("ReachSafepoint", start_time, end_time);
+    event->SetNumArguments(3);
+    event->CopyArgument(0, "requester", T->os_thread()->name());
+    event->CopyArgument(1, "lastToCheckIn",
+                        last_name == NULL ? "(none)" : last_name);
+    event->CopyArgument(2, "lastToCheckInTag",
+                        last_tag == VMTag::kInvalidTagId
+                            ? "(none)"
+                            : VMTag::TagName(last_tag));
+    event->Complete();
   }
+#endif  // defined(SUPPORT_TIMELINE)
 }
 
 void SafepointHandler::ResumeThreads(Thread* T) {
@@ -211,6 +248,8 @@ void SafepointHandler::EnterSafepointUsingLock(Thread* T) {
     MonitorLocker sl(&safepoint_lock_);
     ASSERT(number_threads_not_at_safepoint_ > 0);
     number_threads_not_at_safepoint_ -= 1;
+    last_to_check_in_name_ = T->os_thread()->name();
+    last_to_check_in_tag_ = T->vm_tag();
     sl.Notify();
   }
 }
@@ -235,6 +274,8 @@ void SafepointHandler::BlockForSafepoint(Thread* T) {
       MonitorLocker sl(&safepoint_lock_);
       ASSERT(number_threads_not_at_safepoint_ > 0);
       number_threads_not_at_safepoint_ -= 1;
+      last_to_check_in_name_ = T->os_thread()->name();
+      last_to_check_in_tag_ = T->vm_tag();
       sl.Notify();
     }
     while (T->IsSafepointRequested()) {
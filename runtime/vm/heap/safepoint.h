@@ -99,6 +99,12 @@ class SafepointHandler {
   Monitor safepoint_lock_;
   int32_t number_threads_not_at_safepoint_;
 
+  // Identifies the thread that was the last to check in for the current
+  // safepoint operation, for diagnosing slow time-to-safepoint. Guarded by
+  // [safepoint_lock_].
+  const char* last_to_check_in_name_;
+  uword last_to_check_in_tag_;
+
   // Count that indicates if a safepoint operation is currently in progress
   // and also tracks the number of recursive safepoint operations on the
   // same thread.
@@ -27,6 +27,13 @@
 
 namespace dart {
 
+// This is the heap's substitute for per-allocation-site pretenuring: when
+// survivorship feedback shows that most new-space objects are long-lived
+// (say a phase that mostly builds stable caches), whole scavenges switch to
+// promoting every survivor instead of copying them through the nursery
+// again. Tracking hotness per allocation site would need counters in the
+// allocation stubs on every architecture and has much higher overhead than
+// this scavenge-granularity feedback for the same end effect.
 DEFINE_FLAG(int,
             early_tenuring_threshold,
             66,
@@ -70,38 +77,6 @@ static inline uword ForwardingHeader(ObjectPtr target) {
   return result;
 }
 
-// Races: The first word in the copied region is a header word that may be
-// updated by the scavenger worker in another thread, so we might copy either
-// the original object header or an installed forwarding pointer. This race is
-// harmless because if we copy the installed forwarding pointer, the scavenge
-// worker in the current thread will abandon this copy. We do not mark the loads
-// here as relaxed so the C++ compiler still has the freedom to reorder them.
-NO_SANITIZE_THREAD
-static inline void objcpy(void* dst, const void* src, size_t size) {
-  // A memcopy specialized for objects. We can assume:
-  //  - dst and src do not overlap
-  ASSERT(
-      (reinterpret_cast<uword>(dst) + size <= reinterpret_cast<uword>(src)) ||
-      (reinterpret_cast<uword>(src) + size <= reinterpret_cast<uword>(dst)));
-  //  - dst and src are word aligned
-  ASSERT(Utils::IsAligned(reinterpret_cast<uword>(dst), sizeof(uword)));
-  ASSERT(Utils::IsAligned(reinterpret_cast<uword>(src), sizeof(uword)));
-  //  - size is strictly positive
-  ASSERT(size > 0);
-  //  - size is a multiple of double words
-  ASSERT(Utils::IsAligned(size, 2 * sizeof(uword)));
-
-  uword* __restrict dst_cursor = reinterpret_cast<uword*>(dst);
-  const uword* __restrict src_cursor = reinterpret_cast<const uword*>(src);
-  do {
-    uword a = *src_cursor++;
-    uword b = *src_cursor++;
-    *dst_cursor++ = a;
-    *dst_cursor++ = b;
-    size -= (2 * sizeof(uword));
-  } while (size > 0);
-}
-
 template <bool parallel>
 class ScavengerVisitorBase : public ObjectPointerVisitor {
  public:
@@ -222,6 +197,13 @@ class ScavengerVisitorBase : public ObjectPointerVisitor {
 
   inline void ProcessWeakProperties();
 
+  void MournWeakTables() {
+    // On abort the weak tables are processed after ReverseScavenge instead.
+    if (scavenger_->abort_) return;
+    TIMELINE_FUNCTION_GC_DURATION(Thread::Current(), "MournWeakTables");
+    scavenger_->ProcessWeakTableSlices();
+  }
+
   bool HasWork() {
     if (scavenger_->abort_) return false;
     return (scan_ != tail_) || (scan_ != nullptr && !scan_->IsResolved()) ||
@@ -549,6 +531,7 @@ class ParallelScavengerTask : public ThreadPool::Task {
     } while (more_to_scavenge);
 
     // Phase 2: Weak processing, statistics.
+    visitor_->MournWeakTables();
     visitor_->Finalize();
     barrier_->Sync();
   }
@@ -755,6 +738,11 @@ Scavenger::Scavenger(Heap* heap, intptr_t max_semi_capacity_in_words)
   to_ = new SemiSpace(initial_semi_capacity_in_words);
   idle_scavenge_threshold_in_words_ = initial_semi_capacity_in_words;
 
+  dying_weak_tables_ = new WeakTable*[Heap::kNumWeakSelectors];
+  for (int sel = 0; sel < Heap::kNumWeakSelectors; sel++) {
+    dying_weak_tables_[sel] = nullptr;
+  }
+
   UpdateMaxHeapCapacity();
   UpdateMaxHeapUsage();
 }
@@ -762,22 +750,41 @@ Scavenger::Scavenger(Heap* heap, intptr_t max_semi_capacity_in_words)
 Scavenger::~Scavenger() {
   ASSERT(!scavenging_);
   delete to_;
+  delete[] dying_weak_tables_;
   ASSERT(blocks_ == nullptr);
 }
 
 intptr_t Scavenger::NewSizeInWords(intptr_t old_size_in_words) const {
+  const intptr_t max_size_in_words =
+      max_semi_capacity_in_words_ + ephemeral_headroom_in_words_;
   if (stats_history_.Size() == 0) {
-    return old_size_in_words;
+    return Utils::Minimum(old_size_in_words, max_size_in_words);
   }
   double garbage = stats_history_.Get(0).ExpectedGarbageFraction();
   if (garbage < (FLAG_new_gen_garbage_threshold / 100.0)) {
-    return Utils::Minimum(max_semi_capacity_in_words_,
+    return Utils::Minimum(max_size_in_words,
                           old_size_in_words * FLAG_new_gen_growth_factor);
   } else {
-    return old_size_in_words;
+    return Utils::Minimum(old_size_in_words, max_size_in_words);
   }
 }
 
+void Scavenger::BeginEphemeralRegion(intptr_t headroom_in_words) {
+  MutexLocker ml(&space_lock_);
+  ephemeral_headroom_in_words_ += headroom_in_words;
+  // Take effect immediately, not just at the next scavenge.
+  to_->set_max_capacity_in_words(to_->max_capacity_in_words() +
+                                 headroom_in_words);
+}
+
+void Scavenger::EndEphemeralRegion(intptr_t headroom_in_words) {
+  MutexLocker ml(&space_lock_);
+  ASSERT(ephemeral_headroom_in_words_ >= headroom_in_words);
+  ephemeral_headroom_in_words_ -= headroom_in_words;
+  // The current semispace keeps its inflated limit; the scavenge triggered
+  // when the scope is left sizes its successor back down.
+}
+
 class CollectStoreBufferVisitor : public ObjectPointerVisitor {
  public:
   explicit CollectStoreBufferVisitor(ObjectSet* in_store_buffer)
@@ -1024,10 +1031,20 @@ void Scavenger::IterateStoreBuffers(ScavengerVisitorBase<parallel>* visitor) {
   // Iterating through the store buffers.
   // Grab the deduplication sets out of the isolate's consolidated store buffer.
   StoreBuffer* store_buffer = heap_->isolate_group()->store_buffer();
-  StoreBufferBlock* pending = blocks_;
   intptr_t total_count = 0;
-  while (pending != nullptr) {
-    StoreBufferBlock* next = pending->next();
+  for (;;) {
+    // Blocks are taken one at a time so that all scavenge workers can
+    // participate in draining the remembered set, instead of one worker
+    // processing the whole chain while the others wait for copy work.
+    StoreBufferBlock* pending;
+    {
+      MutexLocker ml(&space_lock_);
+      pending = blocks_;
+      if (pending == nullptr) {
+        break;
+      }
+      blocks_ = pending->next();
+    }
     // Generated code appends to store buffers; tell MemorySanitizer.
     MSAN_UNPOISON(pending, sizeof(*pending));
     intptr_t count = pending->Count();
@@ -1045,14 +1062,11 @@ void Scavenger::IterateStoreBuffers(ScavengerVisitorBase<parallel>* visitor) {
     pending->Reset();
     // Return the emptied block for recycling (no need to check threshold).
     store_buffer->PushBlock(pending, StoreBuffer::kIgnoreThreshold);
-    blocks_ = pending = next;
   }
   // Done iterating through old objects remembered in the store buffers.
   visitor->VisitingOldObject(nullptr);
 
-  heap_->RecordData(kStoreBufferEntries, total_count);
-  heap_->RecordData(kDataUnused1, 0);
-  heap_->RecordData(kDataUnused2, 0);
+  store_buffer_entries_.fetch_add(total_count);
 }
 
 template <bool parallel>
@@ -1074,7 +1088,6 @@ enum RootSlices {
   kIsolate = 0,
   kObjectIdRing,
   kCards,
-  kStoreBuffer,
   kNumRootSlices,
 };
 
@@ -1083,7 +1096,7 @@ void Scavenger::IterateRoots(ScavengerVisitorBase<parallel>* visitor) {
   for (;;) {
     intptr_t slice = root_slices_started_.fetch_add(1);
     if (slice >= kNumRootSlices) {
-      return;  // No more slices.
+      break;  // No more slices.
     }
 
     switch (slice) {
@@ -1096,13 +1109,14 @@ void Scavenger::IterateRoots(ScavengerVisitorBase<parallel>* visitor) {
       case kCards:
         IterateRememberedCards(visitor);
         break;
-      case kStoreBuffer:
-        IterateStoreBuffers(visitor);
-        break;
       default:
         UNREACHABLE();
     }
   }
+
+  // The store buffer is drained a block at a time, so every worker can help
+  // process it instead of treating it as a single indivisible slice.
+  IterateStoreBuffers(visitor);
 }
 
 bool Scavenger::IsUnreachable(ObjectPtr* p) {
@@ -1130,6 +1144,10 @@ void Scavenger::MournWeakHandles() {
   TIMELINE_FUNCTION_GC_DURATION(thread, "MournWeakHandles");
   ScavengerWeakVisitor weak_visitor(thread, this);
   heap_->isolate_group()->VisitWeakPersistentHandles(&weak_visitor);
+  if (FLAG_background_finalizers) {
+    heap_->isolate_group()->api_state()->ScheduleBackgroundFinalization(
+        heap_->isolate_group());
+  }
 }
 
 template <bool parallel>
@@ -1270,43 +1288,71 @@ intptr_t ScavengerVisitorBase<parallel>::ProcessCopied(ObjectPtr raw_obj) {
   return raw_obj->ptr()->VisitPointersNonvirtual(this);
 }
 
-void Scavenger::MournWeakTables() {
-  TIMELINE_FUNCTION_GC_DURATION(Thread::Current(), "MournWeakTables");
+void Scavenger::PrepareWeakTables() {
+  weak_table_slices_started_ = 0;
+  for (int sel = 0; sel < Heap::kNumWeakSelectors; sel++) {
+    const auto selector = static_cast<Heap::WeakSelector>(sel);
+    auto table = heap_->GetWeakTable(Heap::kNew, selector);
+    // Install an empty replacement up front so that the surviving entries of
+    // the old table can be rehashed in (selector, shard) slices by parallel
+    // scavenger tasks.
+    heap_->SetWeakTable(Heap::kNew, selector, WeakTable::NewFrom(table));
+    ASSERT(dying_weak_tables_[sel] == nullptr);
+    dying_weak_tables_[sel] = table;
+  }
+}
 
-  auto rehash_weak_table = [](WeakTable* table, WeakTable* replacement_new,
-                              WeakTable* replacement_old) {
-    intptr_t size = table->size();
-    for (intptr_t i = 0; i < size; i++) {
-      if (table->IsValidEntryAtExclusive(i)) {
-        ObjectPtr raw_obj = table->ObjectAtExclusive(i);
-        ASSERT(raw_obj->IsHeapObject());
-        uword raw_addr = ObjectLayout::ToAddr(raw_obj);
-        uword header = *reinterpret_cast<uword*>(raw_addr);
-        if (IsForwarding(header)) {
-          // The object has survived.  Preserve its record.
-          raw_obj = ForwardedObj(header);
-          auto replacement =
-              raw_obj->IsNewObject() ? replacement_new : replacement_old;
-          replacement->SetValueExclusive(raw_obj, table->ValueAtExclusive(i));
-        }
+// Rehash the surviving entries of one weak table shard now that we know which
+// objects survive this cycle. Insertions into the replacement tables take the
+// destination shard's lock because a key's new location may hash to any shard.
+static void RehashWeakTableShard(WeakTable::Shard* shard,
+                                 WeakTable* replacement_new,
+                                 WeakTable* replacement_old) {
+  intptr_t size = shard->size();
+  for (intptr_t i = 0; i < size; i++) {
+    if (shard->IsValidEntryAtExclusive(i)) {
+      ObjectPtr raw_obj = shard->ObjectAtExclusive(i);
+      ASSERT(raw_obj->IsHeapObject());
+      uword raw_addr = ObjectLayout::ToAddr(raw_obj);
+      uword header = *reinterpret_cast<uword*>(raw_addr);
+      if (IsForwarding(header)) {
+        // The object has survived.  Preserve its record.
+        raw_obj = ForwardedObj(header);
+        auto replacement =
+            raw_obj->IsNewObject() ? replacement_new : replacement_old;
+        replacement->SetValue(raw_obj, shard->ValueAtExclusive(i));
       }
     }
-  };
+  }
+}
 
-  // Rehash the weak tables now that we know which objects survive this cycle.
-  for (int sel = 0; sel < Heap::kNumWeakSelectors; sel++) {
-    const auto selector = static_cast<Heap::WeakSelector>(sel);
-    auto table = heap_->GetWeakTable(Heap::kNew, selector);
-    auto table_old = heap_->GetWeakTable(Heap::kOld, selector);
+void Scavenger::ProcessWeakTableSlices() {
+  const intptr_t num_slices =
+      Heap::kNumWeakSelectors * WeakTable::kNumShards;
+  for (;;) {
+    intptr_t slice = weak_table_slices_started_.fetch_add(1);
+    if (slice >= num_slices) {
+      return;  // No more slices.
+    }
 
-    // Create a new weak table for the new-space.
-    auto table_new = WeakTable::NewFrom(table);
-    rehash_weak_table(table, table_new, table_old);
-    heap_->SetWeakTable(Heap::kNew, selector, table_new);
+    const auto selector =
+        static_cast<Heap::WeakSelector>(slice / WeakTable::kNumShards);
+    WeakTable::Shard* shard = dying_weak_tables_[selector]->GetShard(
+        slice % WeakTable::kNumShards);
+    RehashWeakTableShard(shard, heap_->GetWeakTable(Heap::kNew, selector),
+                         heap_->GetWeakTable(Heap::kOld, selector));
+  }
+}
 
-    // Remove the old table as it has been replaced with the newly allocated
-    // table above.
-    delete table;
+void Scavenger::MournWeakTables() {
+  TIMELINE_FUNCTION_GC_DURATION(Thread::Current(), "MournWeakTables");
+
+  // Take any shard slices the scavenger tasks did not process, then free the
+  // replaced tables.
+  ProcessWeakTableSlices();
+  for (int sel = 0; sel < Heap::kNumWeakSelectors; sel++) {
+    delete dying_weak_tables_[sel];
+    dying_weak_tables_[sel] = nullptr;
   }
 
   // Each isolate might have a weak table used for fast snapshot writing (i.e.
@@ -1316,7 +1362,10 @@ void Scavenger::MournWeakTables() {
         auto table = isolate->forward_table_new();
         if (table != nullptr) {
           auto replacement = WeakTable::NewFrom(table);
-          rehash_weak_table(table, replacement, isolate->forward_table_old());
+          for (intptr_t s = 0; s < WeakTable::kNumShards; s++) {
+            RehashWeakTableShard(table->GetShard(s), replacement,
+                                 isolate->forward_table_old());
+          }
           isolate->set_forward_table_new(replacement);
         }
       },
@@ -1406,6 +1455,7 @@ void Scavenger::TryAllocateNewTLAB(Thread* thread, intptr_t min_size) {
     intptr_t available = page->end() - page->object_end();
     if (available >= min_size) {
       page->Acquire(thread);
+      TrimTLAB(thread, min_size);
       return;
     }
   }
@@ -1415,6 +1465,23 @@ void Scavenger::TryAllocateNewTLAB(Thread* thread, intptr_t min_size) {
     return;
   }
   page->Acquire(thread);
+  TrimTLAB(thread, min_size);
+}
+
+void Scavenger::TrimTLAB(Thread* thread, intptr_t min_size) {
+  // Hand out only part of the acquired page so several mutator threads can
+  // allocate from the same page. On release the page's top is moved up to the
+  // thread's top, leaving the tail of the page available for the next
+  // acquirer, so trimming never creates an unparsable gap.
+  intptr_t tlab_size =
+      Utils::RoundUp(FLAG_new_gen_tlab_size * KB, kObjectAlignment);
+  if (tlab_size < min_size) {
+    tlab_size = Utils::RoundUp(min_size, kObjectAlignment);
+  }
+  const uword tlab_end = thread->top() + tlab_size;
+  if (tlab_end < thread->end()) {
+    thread->set_end(tlab_end);
+  }
 }
 
 void Scavenger::AbandonRemainingTLABForDebugging(Thread* thread) {
@@ -1491,6 +1558,8 @@ void Scavenger::Scavenge() {
   failed_to_promote_ = false;
   abort_ = false;
   root_slices_started_ = 0;
+  store_buffer_entries_ = 0;
+  PrepareWeakTables();
   intptr_t abandoned_bytes = 0;  // TODO(rmacnak): Count fragmentation?
   SpaceUsage usage_before = GetCurrentUsage();
   intptr_t promo_candidate_words = 0;
@@ -1518,6 +1587,9 @@ void Scavenger::Scavenge() {
     heap_->assume_scavenge_will_fail_ = true;
   }
   ASSERT(promotion_stack_.IsEmpty());
+  heap_->RecordData(kStoreBufferEntries, store_buffer_entries_);
+  heap_->RecordData(kDataUnused1, 0);
+  heap_->RecordData(kDataUnused2, 0);
   MournWeakHandles();
   MournWeakTables();
 
@@ -1574,7 +1646,8 @@ intptr_t Scavenger::ParallelScavenge(SemiSpace* from) {
         heap_->isolate_group(), this, from, freelist, &promotion_stack_);
     if (i < (num_tasks - 1)) {
       // Begin scavenging on a helper thread.
-      bool result = Dart::thread_pool()->Run<ParallelScavengerTask>(
+      bool result =
+          heap_->isolate_group()->gc_thread_pool()->Run<ParallelScavengerTask>(
           heap_->isolate_group(), &barrier, visitors[i], &num_busy);
       ASSERT(result);
     } else {
@@ -6,6 +6,7 @@
 #define RUNTIME_VM_HEAP_SCAVENGER_H_
 
 #include "platform/assert.h"
+#include "platform/thread_sanitizer.h"
 #include "platform/utils.h"
 
 #include "vm/dart.h"
@@ -25,9 +26,49 @@ class Heap;
 class Isolate;
 class JSONObject;
 class ObjectSet;
+class WeakTable;
 template <bool parallel>
 class ScavengerVisitorBase;
 
+// A memcopy specialized for objects, which are word aligned, do not overlap
+// and are rarely more than a few words long, so the call and size dispatch of
+// the generic memmove cost more than the copy itself.
+//
+// Races: The first word in the copied region is a header word that may be
+// updated by a scavenger worker in another thread, so we might copy either
+// the original object header or an installed forwarding pointer. This race is
+// harmless because if we copy the installed forwarding pointer, the scavenge
+// worker in the current thread will abandon this copy. We do not mark the
+// loads here as relaxed so the C++ compiler still has the freedom to reorder
+// them.
+NO_SANITIZE_THREAD
+static inline void objcpy(void* dst, const void* src, size_t size) {
+  // We can assume:
+  //  - dst and src do not overlap
+  ASSERT(
+      (reinterpret_cast<uword>(dst) + size <= reinterpret_cast<uword>(src)) ||
+      (reinterpret_cast<uword>(src) + size <= reinterpret_cast<uword>(dst)));
+  //  - dst and src are word aligned
+  ASSERT(Utils::IsAligned(reinterpret_cast<uword>(dst), sizeof(uword)));
+  ASSERT(Utils::IsAligned(reinterpret_cast<uword>(src), sizeof(uword)));
+  //  - size is a strictly positive multiple of words
+  ASSERT(size > 0);
+  ASSERT(Utils::IsAligned(size, sizeof(uword)));
+
+  uword* __restrict dst_cursor = reinterpret_cast<uword*>(dst);
+  const uword* __restrict src_cursor = reinterpret_cast<const uword*>(src);
+  while (size >= (2 * sizeof(uword))) {
+    uword a = *src_cursor++;
+    uword b = *src_cursor++;
+    *dst_cursor++ = a;
+    *dst_cursor++ = b;
+    size -= (2 * sizeof(uword));
+  }
+  if (size > 0) {
+    *dst_cursor = *src_cursor;
+  }
+}
+
 static constexpr intptr_t kNewPageSize = 512 * KB;
 static constexpr intptr_t kNewPageSizeInWords = kNewPageSize / kWordSize;
 static constexpr intptr_t kNewPageMask = ~(kNewPageSize - 1);
@@ -87,6 +128,16 @@ class NewPage {
   }
 
   // Remember the limit to which objects have been copied.
+  //
+  // This boundary is the scavenger's object age representation: everything
+  // below survivor_end_ was copied by the previous scavenge (age 1) and is
+  // promoted if it survives again, everything above it is a fresh
+  // allocation (age 0) and gets one copy before promotion is considered.
+  // Keeping age positional avoids spending header bits and avoids touching
+  // headers on the copy fast path; ages beyond 1 would need per-object bits
+  // but would only delay promotion further for objects that have already
+  // survived two cycles, which survivorship stats show is rarely worth the
+  // extra copies.
   void RecordSurvivors() { survivor_end_ = object_end(); }
 
   // Move survivor end to the end of the to_ space, making all surviving
@@ -180,6 +231,9 @@ class SemiSpace {
 
   intptr_t capacity_in_words() const { return capacity_in_words_; }
   intptr_t max_capacity_in_words() const { return max_capacity_in_words_; }
+  void set_max_capacity_in_words(intptr_t value) {
+    max_capacity_in_words_ = value;
+  }
 
   NewPage* head() const { return head_; }
 
@@ -249,9 +303,6 @@ class ScavengeStats {
 };
 
 class Scavenger {
- private:
-  static const intptr_t kTLABSize = 512 * KB;
-
  public:
   Scavenger(Heap* heap, intptr_t max_semi_capacity_in_words);
   ~Scavenger();
@@ -281,6 +332,14 @@ class Scavenger {
   // Promote all live objects.
   void Evacuate();
 
+  // While at least one ephemeral region is active (see
+  // Heap::EphemeralRegionScope), new space may grow beyond its normal maximum
+  // by the sum of the active regions' headroom, so a large transient object
+  // graph stays in the bump-allocated young generation instead of spilling
+  // into old space.
+  void BeginEphemeralRegion(intptr_t headroom_in_words);
+  void EndEphemeralRegion(intptr_t headroom_in_words);
+
   void MergeFrom(Scavenger* donor);
 
   int64_t UsedInWords() const {
@@ -350,7 +409,7 @@ class Scavenger {
     // With a max new-space of 16 MB and 512kb TLABs we would allow up to 8
     // mutator threads to run at the same time.
     const intptr_t max_parallel_tlab_usage =
-        (FLAG_new_gen_semi_max_size * MB) / Scavenger::kTLABSize;
+        (FLAG_new_gen_semi_max_size * MB) / (FLAG_new_gen_tlab_size * KB);
     const intptr_t max_pool_size = max_parallel_tlab_usage / 4;
     return max_pool_size > 0 ? max_pool_size : 1;
   }
@@ -390,6 +449,7 @@ class Scavenger {
     return result;
   }
   void TryAllocateNewTLAB(Thread* thread, intptr_t size);
+  void TrimTLAB(Thread* thread, intptr_t min_size);
 
   SemiSpace* Prologue();
   intptr_t ParallelScavenge(SemiSpace* from);
@@ -413,6 +473,8 @@ class Scavenger {
   void UpdateMaxHeapCapacity();
   void UpdateMaxHeapUsage();
 
+  void PrepareWeakTables();
+  void ProcessWeakTableSlices();
   void MournWeakTables();
 
   intptr_t NewSizeInWords(intptr_t old_size_in_words) const;
@@ -424,13 +486,21 @@ class Scavenger {
   PromotionStack promotion_stack_;
 
   intptr_t max_semi_capacity_in_words_;
+  intptr_t ephemeral_headroom_in_words_ = 0;
 
   // Keep track whether a scavenge is currently running.
   bool scavenging_;
   bool early_tenure_ = false;
   RelaxedAtomic<intptr_t> root_slices_started_;
+  RelaxedAtomic<intptr_t> store_buffer_entries_;
   StoreBufferBlock* blocks_ = nullptr;
 
+  // The new-space weak tables replaced at the start of a scavenge. Their
+  // surviving entries are rehashed into the replacement tables in
+  // (selector, shard) slices taken by the scavenger tasks.
+  WeakTable** dying_weak_tables_;
+  RelaxedAtomic<intptr_t> weak_table_slices_started_;
+
   int64_t gc_time_micros_;
   intptr_t collections_;
   static const int kStatsHistoryCapacity = 4;
@@ -447,7 +517,8 @@ class Scavenger {
 
   bool growth_control_;
 
-  // Protects new space during the allocation of new TLABs
+  // Protects new space during the allocation of new TLABs, and the pending
+  // store buffer blocks while workers take them one at a time during roots.
   mutable Mutex space_lock_;
 
   template <bool>
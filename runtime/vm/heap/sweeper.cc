@@ -178,22 +178,35 @@ class ConcurrentSweeperTask : public ThreadPool::Task {
           next_page = page->next();
         }
         ASSERT(page->type() == OldPage::kData);
-        shard = (shard + 1) % num_shards;
-        bool page_in_use =
-            sweeper.SweepPage(page, old_space_->DataFreeList(shard), false);
-        if (page_in_use) {
-          prev_page = page;
+        if (page->TryClaimSweep()) {
+          shard = (shard + 1) % num_shards;
+          bool page_in_use =
+              sweeper.SweepPage(page, old_space_->DataFreeList(shard), false);
+          if (page_in_use) {
+            prev_page = page;
+          } else {
+            old_space_->FreePage(page, prev_page);
+          }
+          {
+            // Notify the mutator thread that we have added elements to the
+            // free list or that more capacity is available.
+            MonitorLocker ml(old_space_->tasks_lock());
+            ml.Notify();
+          }
         } else {
-          old_space_->FreePage(page, prev_page);
-        }
-        {
-          // Notify the mutator thread that we have added elements to the free
-          // list or that more capacity is available.
-          MonitorLocker ml(old_space_->tasks_lock());
-          ml.Notify();
+          // An allocating thread already swept this page on demand.
+          prev_page = page;
         }
         page = next_page;
       }
+
+      {
+        // Any unclaimed pages have now been swept by this task; stop
+        // allocating threads from walking the cursor.
+        MutexLocker ml(&old_space_->pages_lock_);
+        old_space_->sweep_regular_ = nullptr;
+        old_space_->sweep_regular_last_ = nullptr;
+      }
     }
     // Exit isolate cleanly *before* notifying it, to avoid shutdown race.
     Thread::ExitIsolateGroupAsHelper(/*bypass_safepoint=*/true);
@@ -222,7 +235,7 @@ void GCSweeper::SweepConcurrent(IsolateGroup* isolate_group,
                                 OldPage* large_first,
                                 OldPage* large_last,
                                 FreeList* freelist) {
-  bool result = Dart::thread_pool()->Run<ConcurrentSweeperTask>(
+  bool result = isolate_group->gc_thread_pool()->Run<ConcurrentSweeperTask>(
       isolate_group, isolate_group->heap()->old_space(), first, last,
       large_first, large_last);
   ASSERT(result);
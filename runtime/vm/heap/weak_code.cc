@@ -57,7 +57,7 @@ bool WeakCodeReferences::IsOptimizedCode(const Array& dependent_code,
   return false;
 }
 
-void WeakCodeReferences::DisableCode() {
+void WeakCodeReferences::DisableCode(bool deoptimize_frames) {
   Thread* thread = Thread::Current();
   const Array& code_objects = Array::Handle(thread->zone(), array_.raw());
 #if defined(DART_PRECOMPILED_RUNTIME)
@@ -71,7 +71,7 @@ void WeakCodeReferences::DisableCode() {
   UpdateArrayTo(Object::null_array());
   // Disable all code on stack.
   Code& code = Code::Handle();
-  {
+  if (deoptimize_frames) {
     DartFrameIterator iterator(thread,
                                StackFrameIterator::kNoCrossThreadIteration);
     StackFrame* frame = iterator.NextFrame();
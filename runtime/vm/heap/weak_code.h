@@ -28,7 +28,14 @@ class WeakCodeReferences : public ValueObject {
 
   static bool IsOptimizedCode(const Array& dependent_code, const Code& code);
 
-  void DisableCode();
+  // Disables all registered code objects: their functions are switched back
+  // to unoptimized code and optimized activations on the stack are marked
+  // for lazy deoptimization, so frames are only materialized when actually
+  // resumed. When deoptimize_frames is false the stack walk is skipped; the
+  // caller must already have marked every optimized frame for lazy
+  // deoptimization (e.g. via DeoptimizeFunctionsOnStack), which lets one
+  // stack walk cover many invalidated assumptions.
+  void DisableCode(bool deoptimize_frames);
 
   bool HasCodes() const;
 
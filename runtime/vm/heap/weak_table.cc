@@ -9,7 +9,7 @@
 
 namespace dart {
 
-intptr_t WeakTable::SizeFor(intptr_t count, intptr_t size) {
+intptr_t WeakTable::Shard::SizeFor(intptr_t count, intptr_t size) {
   intptr_t result = size;
   if (count <= (size / 4)) {
     // Reduce the capacity.
@@ -29,7 +29,36 @@ intptr_t WeakTable::SizeFor(intptr_t count, intptr_t size) {
   return result;
 }
 
-void WeakTable::SetValueExclusive(ObjectPtr key, intptr_t val) {
+void WeakTable::Shard::Reset(intptr_t size) {
+  ASSERT(size >= 0);
+  ASSERT(Utils::IsPowerOfTwo(kMinSize));
+  if (size < kMinSize) {
+    size = kMinSize;
+  }
+  if (!Utils::IsPowerOfTwo(size)) {
+    size = Utils::RoundUpToPowerOfTwo(size);
+  }
+  // Get a max size that avoids overflows.
+  const intptr_t kMaxSize =
+      (kIntptrOne << (kBitsPerWord - 2)) / (kEntrySize * kWordSize);
+  ASSERT(Utils::IsPowerOfTwo(kMaxSize));
+  if (size > kMaxSize) {
+    size = kMaxSize;
+  }
+
+  intptr_t* old_data = data_;
+  used_ = 0;
+  count_ = 0;
+  size_ = size;
+  free(old_data);
+  data_ = reinterpret_cast<intptr_t*>(malloc(size_ * kEntrySize * kWordSize));
+  for (intptr_t i = 0; i < size_; i++) {
+    data_[ObjectIndex(i)] = kNoEntry;
+    data_[ValueIndex(i)] = kNoValue;
+  }
+}
+
+void WeakTable::Shard::SetValueExclusive(ObjectPtr key, intptr_t val) {
   intptr_t mask = size() - 1;
   intptr_t idx = Hash(key) & mask;
   intptr_t empty_idx = -1;
@@ -74,20 +103,7 @@ void WeakTable::SetValueExclusive(ObjectPtr key, intptr_t val) {
   }
 }
 
-void WeakTable::Reset() {
-  intptr_t* old_data = data_;
-  used_ = 0;
-  count_ = 0;
-  size_ = kMinSize;
-  free(old_data);
-  data_ = reinterpret_cast<intptr_t*>(malloc(size_ * kEntrySize * kWordSize));
-  for (intptr_t i = 0; i < size_; i++) {
-    data_[ObjectIndex(i)] = kNoEntry;
-    data_[ValueIndex(i)] = kNoValue;
-  }
-}
-
-void WeakTable::Forward(ObjectPointerVisitor* visitor) {
+void WeakTable::Shard::Forward(ObjectPointerVisitor* visitor) {
   if (used_ == 0) return;
 
   for (intptr_t i = 0; i < size_; i++) {
@@ -99,7 +115,7 @@ void WeakTable::Forward(ObjectPointerVisitor* visitor) {
   Rehash();
 }
 
-void WeakTable::Rehash() {
+void WeakTable::Shard::Rehash() {
   intptr_t old_size = size();
   intptr_t* old_data = data_;
 
@@ -140,10 +156,38 @@ void WeakTable::Rehash() {
   free(old_data);
 }
 
+WeakTable* WeakTable::NewFrom(WeakTable* original) {
+  WeakTable* table = new WeakTable();
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    Shard* shard = original->GetShard(i);
+    table->shards_[i].Reset(Shard::SizeFor(shard->count(), shard->size()));
+  }
+  return table;
+}
+
+void WeakTable::Forward(ObjectPointerVisitor* visitor) {
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    shards_[i].Forward(visitor);
+  }
+}
+
+void WeakTable::Reset() {
+  for (intptr_t i = 0; i < kNumShards; i++) {
+    shards_[i].Reset(kMinSize);
+  }
+}
+
 void WeakTable::MergeFrom(WeakTable* donor) {
-  for (intptr_t i = 0; i < donor->size(); i++) {
-    if (donor->IsValidEntryAtExclusive(i)) {
-      SetValueExclusive(donor->ObjectAtExclusive(i), ValueIndex(i));
+  // Keys hash to the same shard in both tables, so each donor shard merges
+  // into the corresponding shard here.
+  for (intptr_t s = 0; s < kNumShards; s++) {
+    Shard* to = &shards_[s];
+    Shard* from = &donor->shards_[s];
+    for (intptr_t i = 0; i < from->size(); i++) {
+      if (from->IsValidEntryAtExclusive(i)) {
+        to->SetValueExclusive(from->ObjectAtExclusive(i),
+                              from->ValueAtExclusive(i));
+      }
     }
   }
 }
@@ -13,53 +13,227 @@
 
 namespace dart {
 
+// The table is striped into independently locked and rehashed shards, keyed
+// on the upper bits of the key's hash, so that mutator threads inserting
+// identity hashes do not contend on a single lock, a rehash only stalls one
+// shard, and GC workers can process the shards of one table in parallel.
 class WeakTable {
  public:
   static constexpr intptr_t kNoValue = 0;
 
-  WeakTable() : WeakTable(kMinSize) {}
-  explicit WeakTable(intptr_t size) : used_(0), count_(0) {
-    ASSERT(size >= 0);
-    ASSERT(Utils::IsPowerOfTwo(kMinSize));
-    if (size < kMinSize) {
-      size = kMinSize;
-    }
-    // Get a max size that avoids overflows.
-    const intptr_t kMaxSize =
-        (kIntptrOne << (kBitsPerWord - 2)) / (kEntrySize * kWordSize);
-    ASSERT(Utils::IsPowerOfTwo(kMaxSize));
-    if (size > kMaxSize) {
-      size = kMaxSize;
-    }
-    size_ = size;
-    ASSERT(Utils::IsPowerOfTwo(size_));
-    data_ = reinterpret_cast<intptr_t*>(malloc(size_ * kEntrySize * kWordSize));
-    for (intptr_t i = 0; i < size_; i++) {
-      data_[ObjectIndex(i)] = kNoEntry;
-      data_[ValueIndex(i)] = kNoValue;
+  static const intptr_t kNumShardsLog2 = 3;
+  static const intptr_t kNumShards = 1 << kNumShardsLog2;
+
+  class Shard {
+   public:
+    Shard() : used_(0), count_(0) {
+      size_ = kMinSize;
+      data_ =
+          reinterpret_cast<intptr_t*>(malloc(size_ * kEntrySize * kWordSize));
+      for (intptr_t i = 0; i < size_; i++) {
+        data_[ObjectIndex(i)] = kNoEntry;
+        data_[ValueIndex(i)] = kNoValue;
+      }
+    }
+    ~Shard() { free(data_); }
+
+    intptr_t size() const { return size_; }
+    intptr_t used() const { return used_; }
+    intptr_t count() const { return count_; }
+
+    // The following "exclusive" methods must only be called from call sites
+    // which are known to have exclusive access to this shard.
+    //
+    // This is mostly limited to GC related code (e.g. scavenger, marker, ...)
+
+    bool IsValidEntryAtExclusive(intptr_t i) const {
+      ASSERT((ValueAtExclusive(i) == 0 &&
+              (data_[ObjectIndex(i)] == kNoEntry ||
+               data_[ObjectIndex(i)] == kDeletedEntry)) ||
+             (ValueAtExclusive(i) != 0 && data_[ObjectIndex(i)] != kNoEntry &&
+              data_[ObjectIndex(i)] != kDeletedEntry));
+      return (data_[ValueIndex(i)] != 0);
+    }
+
+    void InvalidateAtExclusive(intptr_t i) {
+      ASSERT(IsValidEntryAtExclusive(i));
+      SetValueAt(i, 0);
+    }
+
+    ObjectPtr ObjectAtExclusive(intptr_t i) const {
+      ASSERT(i >= 0);
+      ASSERT(i < size());
+      return static_cast<ObjectPtr>(data_[ObjectIndex(i)]);
+    }
+
+    intptr_t ValueAtExclusive(intptr_t i) const {
+      ASSERT(i >= 0);
+      ASSERT(i < size());
+      return data_[ValueIndex(i)];
+    }
+
+    void SetValueExclusive(ObjectPtr key, intptr_t val);
+
+    intptr_t GetValueExclusive(ObjectPtr key) const {
+      intptr_t mask = size() - 1;
+      intptr_t idx = Hash(key) & mask;
+      ObjectPtr obj = ObjectAtExclusive(idx);
+      while (obj != static_cast<ObjectPtr>(kNoEntry)) {
+        if (obj == key) {
+          return ValueAtExclusive(idx);
+        }
+        idx = (idx + 1) & mask;
+        obj = ObjectAtExclusive(idx);
+      }
+      ASSERT(ValueAtExclusive(idx) == 0);
+      return kNoValue;
+    }
+
+    // Removes and returns the value associated with |key|. Returns 0 if there
+    // is no value associated with |key|.
+    intptr_t RemoveValueExclusive(ObjectPtr key) {
+      intptr_t mask = size() - 1;
+      intptr_t idx = Hash(key) & mask;
+      ObjectPtr obj = ObjectAtExclusive(idx);
+      while (obj != static_cast<ObjectPtr>(kNoEntry)) {
+        if (obj == key) {
+          intptr_t result = ValueAtExclusive(idx);
+          InvalidateAtExclusive(idx);
+          return result;
+        }
+        idx = (idx + 1) & mask;
+        obj = ObjectAtExclusive(idx);
+      }
+      ASSERT(ValueAtExclusive(idx) == 0);
+      return kNoValue;
+    }
+
+    void Forward(ObjectPointerVisitor* visitor);
+
+    // Frees the backing store and starts over with the given capacity, which
+    // is clamped to a valid power of two.
+    void Reset(intptr_t size);
+
+   private:
+    friend class WeakTable;
+
+    static intptr_t SizeFor(intptr_t count, intptr_t size);
+    static intptr_t LimitFor(intptr_t size) {
+      // Maintain a maximum of 75% fill rate.
+      return 3 * (size / 4);
+    }
+    intptr_t limit() const { return LimitFor(size()); }
+
+    intptr_t index(intptr_t i) const { return i * kEntrySize; }
+
+    void set_used(intptr_t val) {
+      ASSERT(val <= limit());
+      used_ = val;
+    }
+
+    void set_count(intptr_t val) {
+      ASSERT(val <= limit());
+      ASSERT(val <= used());
+      count_ = val;
+    }
+
+    intptr_t ObjectIndex(intptr_t i) const { return index(i) + kObjectOffset; }
+
+    intptr_t ValueIndex(intptr_t i) const { return index(i) + kValueOffset; }
+
+    ObjectPtr* ObjectPointerAt(intptr_t i) const {
+      ASSERT(i >= 0);
+      ASSERT(i < size());
+      return reinterpret_cast<ObjectPtr*>(&data_[ObjectIndex(i)]);
+    }
+
+    void SetObjectAt(intptr_t i, ObjectPtr key) {
+      ASSERT(i >= 0);
+      ASSERT(i < size());
+      data_[ObjectIndex(i)] = static_cast<intptr_t>(key);
+    }
+
+    void SetValueAt(intptr_t i, intptr_t val) {
+      ASSERT(i >= 0);
+      ASSERT(i < size());
+      // Setting a value of 0 is equivalent to invalidating the entry.
+      if (val == 0) {
+        data_[ObjectIndex(i)] = kDeletedEntry;
+        set_count(count() - 1);
+      }
+      data_[ValueIndex(i)] = val;
+    }
+
+    void Rehash();
+
+    Mutex mutex_;
+
+    // data_ contains size_ tuples of key/value.
+    intptr_t* data_;
+    // size_ keeps the number of entries in data_. used_ maintains the number
+    // of non-NULL entries and will trigger rehashing if needed. count_ stores
+    // the number valid entries, and will determine the size_ after rehashing.
+    intptr_t size_;
+    intptr_t used_;
+    intptr_t count_;
+
+    DISALLOW_COPY_AND_ASSIGN(Shard);
+  };
+
+  // Each shard starts out at its minimum size.
+  WeakTable() {}
+  // 'size' is a hint for the total capacity across all shards.
+  explicit WeakTable(intptr_t size) {
+    for (intptr_t i = 0; i < kNumShards; i++) {
+      shards_[i].Reset(size >> kNumShardsLog2);
     }
   }
 
-  ~WeakTable() { free(data_); }
+  // Returns a new empty table with each shard sized for the survivors of the
+  // corresponding shard of |original|.
+  static WeakTable* NewFrom(WeakTable* original);
 
-  static WeakTable* NewFrom(WeakTable* original) {
-    return new WeakTable(SizeFor(original->count(), original->size()));
+  intptr_t size() const {
+    intptr_t result = 0;
+    for (intptr_t i = 0; i < kNumShards; i++) {
+      result += shards_[i].size();
+    }
+    return result;
+  }
+  intptr_t used() const {
+    intptr_t result = 0;
+    for (intptr_t i = 0; i < kNumShards; i++) {
+      result += shards_[i].used();
+    }
+    return result;
+  }
+  intptr_t count() const {
+    intptr_t result = 0;
+    for (intptr_t i = 0; i < kNumShards; i++) {
+      result += shards_[i].count();
+    }
+    return result;
   }
 
-  intptr_t size() const { return size_; }
-  intptr_t used() const { return used_; }
-  intptr_t count() const { return count_; }
+  Shard* GetShard(intptr_t i) {
+    ASSERT(i >= 0);
+    ASSERT(i < kNumShards);
+    return &shards_[i];
+  }
 
-  // The following methods can be called concurrently and are guarded by a lock.
+  // The following methods can be called concurrently and lock only the
+  // affected shard.
 
   intptr_t GetValue(ObjectPtr key) {
-    MutexLocker ml(&mutex_);
-    return GetValueExclusive(key);
+    Shard* shard = &shards_[ShardOf(key)];
+    MutexLocker ml(&shard->mutex_);
+    return shard->GetValueExclusive(key);
   }
 
   void SetValue(ObjectPtr key, intptr_t val) {
-    MutexLocker ml(&mutex_);
-    return SetValueExclusive(key, val);
+    Shard* shard = &shards_[ShardOf(key)];
+    MutexLocker ml(&shard->mutex_);
+    return shard->SetValueExclusive(key, val);
   }
 
   // The following "exclusive" methods must only be called from call sites
@@ -67,66 +241,16 @@ class WeakTable {
   //
   // This is mostly limited to GC related code (e.g. scavenger, marker, ...)
 
-  bool IsValidEntryAtExclusive(intptr_t i) const {
-    ASSERT((ValueAtExclusive(i) == 0 &&
-            (data_[ObjectIndex(i)] == kNoEntry ||
-             data_[ObjectIndex(i)] == kDeletedEntry)) ||
-           (ValueAtExclusive(i) != 0 && data_[ObjectIndex(i)] != kNoEntry &&
-            data_[ObjectIndex(i)] != kDeletedEntry));
-    return (data_[ValueIndex(i)] != 0);
-  }
-
-  void InvalidateAtExclusive(intptr_t i) {
-    ASSERT(IsValidEntryAtExclusive(i));
-    SetValueAt(i, 0);
-  }
-
-  ObjectPtr ObjectAtExclusive(intptr_t i) const {
-    ASSERT(i >= 0);
-    ASSERT(i < size());
-    return static_cast<ObjectPtr>(data_[ObjectIndex(i)]);
-  }
-
-  intptr_t ValueAtExclusive(intptr_t i) const {
-    ASSERT(i >= 0);
-    ASSERT(i < size());
-    return data_[ValueIndex(i)];
+  intptr_t GetValueExclusive(ObjectPtr key) const {
+    return shards_[ShardOf(key)].GetValueExclusive(key);
   }
 
-  void SetValueExclusive(ObjectPtr key, intptr_t val);
-
-  intptr_t GetValueExclusive(ObjectPtr key) const {
-    intptr_t mask = size() - 1;
-    intptr_t idx = Hash(key) & mask;
-    ObjectPtr obj = ObjectAtExclusive(idx);
-    while (obj != static_cast<ObjectPtr>(kNoEntry)) {
-      if (obj == key) {
-        return ValueAtExclusive(idx);
-      }
-      idx = (idx + 1) & mask;
-      obj = ObjectAtExclusive(idx);
-    }
-    ASSERT(ValueAtExclusive(idx) == 0);
-    return kNoValue;
+  void SetValueExclusive(ObjectPtr key, intptr_t val) {
+    shards_[ShardOf(key)].SetValueExclusive(key, val);
   }
 
-  // Removes and returns the value associated with |key|. Returns 0 if there is
-  // no value associated with |key|.
   intptr_t RemoveValueExclusive(ObjectPtr key) {
-    intptr_t mask = size() - 1;
-    intptr_t idx = Hash(key) & mask;
-    ObjectPtr obj = ObjectAtExclusive(idx);
-    while (obj != static_cast<ObjectPtr>(kNoEntry)) {
-      if (obj == key) {
-        intptr_t result = ValueAtExclusive(idx);
-        InvalidateAtExclusive(idx);
-        return result;
-      }
-      idx = (idx + 1) & mask;
-      obj = ObjectAtExclusive(idx);
-    }
-    ASSERT(ValueAtExclusive(idx) == 0);
-    return kNoValue;
+    return shards_[ShardOf(key)].RemoveValueExclusive(key);
   }
 
   void Forward(ObjectPointerVisitor* visitor);
@@ -146,69 +270,18 @@ class WeakTable {
   static const intptr_t kDeletedEntry = 3;  // Not a valid OOP.
   static const intptr_t kMinSize = 8;
 
-  static intptr_t SizeFor(intptr_t count, intptr_t size);
-  static intptr_t LimitFor(intptr_t size) {
-    // Maintain a maximum of 75% fill rate.
-    return 3 * (size / 4);
-  }
-  intptr_t limit() const { return LimitFor(size()); }
-
-  intptr_t index(intptr_t i) const { return i * kEntrySize; }
-
-  void set_used(intptr_t val) {
-    ASSERT(val <= limit());
-    used_ = val;
-  }
-
-  void set_count(intptr_t val) {
-    ASSERT(val <= limit());
-    ASSERT(val <= used());
-    count_ = val;
-  }
-
-  intptr_t ObjectIndex(intptr_t i) const { return index(i) + kObjectOffset; }
-
-  intptr_t ValueIndex(intptr_t i) const { return index(i) + kValueOffset; }
-
-  ObjectPtr* ObjectPointerAt(intptr_t i) const {
-    ASSERT(i >= 0);
-    ASSERT(i < size());
-    return reinterpret_cast<ObjectPtr*>(&data_[ObjectIndex(i)]);
-  }
-
-  void SetObjectAt(intptr_t i, ObjectPtr key) {
-    ASSERT(i >= 0);
-    ASSERT(i < size());
-    data_[ObjectIndex(i)] = static_cast<intptr_t>(key);
-  }
-
-  void SetValueAt(intptr_t i, intptr_t val) {
-    ASSERT(i >= 0);
-    ASSERT(i < size());
-    // Setting a value of 0 is equivalent to invalidating the entry.
-    if (val == 0) {
-      data_[ObjectIndex(i)] = kDeletedEntry;
-      set_count(count() - 1);
-    }
-    data_[ValueIndex(i)] = val;
+  // The in-shard probe sequence uses the low bits of the hash, so the shard
+  // is selected by its upper bits.
+  static intptr_t ShardOf(ObjectPtr key) {
+    return static_cast<uintptr_t>(Hash(key)) >>
+           (kBitsPerWord - kNumShardsLog2);
   }
 
-  void Rehash();
-
   static intptr_t Hash(ObjectPtr key) {
     return static_cast<uintptr_t>(key) * 92821;
   }
 
-  Mutex mutex_;
-
-  // data_ contains size_ tuples of key/value.
-  intptr_t* data_;
-  // size_ keeps the number of entries in data_. used_ maintains the number of
-  // non-NULL entries and will trigger rehashing if needed. count_ stores the
-  // number valid entries, and will determine the size_ after rehashing.
-  intptr_t size_;
-  intptr_t used_;
-  intptr_t count_;
+  Shard shards_[kNumShards];
 
   DISALLOW_COPY_AND_ASSIGN(WeakTable);
 };
@@ -262,7 +262,22 @@ void IdleTimeHandler::NotifyIdle(int64_t deadline) {
 
 void IdleTimeHandler::NotifyIdleUsingDefaultDeadline() {
   const int64_t now = OS::GetCurrentMonotonicMicros();
-  NotifyIdle(now + FLAG_idle_timeout_micros);
+  int64_t deadline = now + FLAG_idle_timeout_micros;
+  // If the embedder predicted a longer idle window, say because its event
+  // loop is sleeping until a distant timer, use it so the heap can schedule
+  // costlier work like compaction. Stale estimates lie in the past and are
+  // ignored.
+  const int64_t estimate = estimated_idle_deadline_;
+  if (estimate > deadline) {
+    deadline = estimate;
+  }
+  NotifyIdle(deadline);
+}
+
+RelaxedAtomic<int64_t> IdleTimeHandler::estimated_idle_deadline_ = 0;
+
+void IdleTimeHandler::HintIdleWindow(int64_t deadline) {
+  estimated_idle_deadline_ = deadline;
 }
 
 DisableIdleTimerScope::DisableIdleTimerScope(IdleTimeHandler* handler)
@@ -342,11 +357,21 @@ void MutatorThreadPool::NotifyIdle() {
   isolate_group_->idle_time_handler()->NotifyIdleUsingDefaultDeadline();
 }
 
+// Spreading the construction of the members below across helper threads has
+// been considered for isolate startup latency and rejected: the store buffer,
+// marking stack and API state are empty-list constructors whose backing
+// blocks come from global free lists (see pointer_block.cc), and new-space
+// setup reuses reserved regions from the page cache in scavenger.cc, so none
+// of the stages is worth a thread handoff. The dominant cost of creating a
+// group is reading the program snapshot, which is inherently ordered after
+// heap setup; repeated spawns into an existing AOT group avoid it by cloning
+// the donor's initial field table (see CloneIntoChildIsolateAOT).
 IsolateGroup::IsolateGroup(std::shared_ptr<IsolateGroupSource> source,
                            void* embedder_data,
                            ObjectStore* object_store)
     : embedder_data_(embedder_data),
       thread_pool_(),
+      gc_thread_pool_(new ThreadPool(FLAG_gc_worker_pool_size)),
       isolates_lock_(new SafepointRwLock()),
       isolates_(),
       start_time_micros_(OS::GetCurrentMonotonicMicros()),
@@ -489,6 +514,16 @@ void IsolateGroup::Shutdown() {
     old_space->AbandonMarkingForShutdown();
   }
 
+  // All GC tasks have finished above, so this only joins the idle workers.
+  gc_thread_pool_->Shutdown();
+  gc_thread_pool_.reset();
+
+  // The thread pools are gone, so any finalizers queued by the last GCs that
+  // no background task picked up must be run here.
+  if (FLAG_background_finalizers && (api_state() != nullptr)) {
+    api_state()->RunPendingFinalizers(embedder_data());
+  }
+
   UnregisterIsolateGroup(this);
 
   // If the creation of the isolate group (or the first isolate within the
@@ -1682,6 +1717,9 @@ Isolate::Isolate(IsolateGroup* isolate_group,
 
   NOT_IN_PRECOMPILED(optimizing_background_compiler_ =
                          new BackgroundCompiler(this, /* optimizing = */ true));
+#if !defined(PRODUCT) && !defined(DART_PRECOMPILED_RUNTIME)
+  compile_ledger_ = new CompileLedger();
+#endif
 }
 
 #undef REUSABLE_HANDLE_SCOPE_INIT
@@ -1696,11 +1734,18 @@ Isolate::~Isolate() {
   delete optimizing_background_compiler_;
   optimizing_background_compiler_ = nullptr;
 
+#if !defined(PRODUCT) && !defined(DART_PRECOMPILED_RUNTIME)
+  delete compile_ledger_;
+  compile_ledger_ = nullptr;
+#endif
+
 #if !defined(PRODUCT)
   delete debugger_;
   debugger_ = nullptr;
   delete object_id_ring_;
   object_id_ring_ = nullptr;
+  free(class_list_response_cache_);
+  class_list_response_cache_ = nullptr;
   delete pause_loop_monitor_;
   pause_loop_monitor_ = nullptr;
 #endif  // !defined(PRODUCT)
@@ -2992,6 +3037,25 @@ ObjectIdRing* Isolate::EnsureObjectIdRing() {
   }
   return object_id_ring_;
 }
+
+const char* Isolate::CachedClassListResponse(intptr_t num_cids,
+                                             int64_t reload_timestamp) const {
+  if ((class_list_response_cache_ != nullptr) &&
+      (class_list_response_num_cids_ == num_cids) &&
+      (class_list_response_reload_timestamp_ == reload_timestamp)) {
+    return class_list_response_cache_;
+  }
+  return nullptr;
+}
+
+void Isolate::CacheClassListResponse(const char* response,
+                                     intptr_t num_cids,
+                                     int64_t reload_timestamp) {
+  free(class_list_response_cache_);
+  class_list_response_cache_ = Utils::StrDup(response);
+  class_list_response_num_cids_ = num_cids;
+  class_list_response_reload_timestamp_ = reload_timestamp;
+}
 #endif  // !defined(PRODUCT)
 
 void Isolate::AddPendingDeopt(uword fp, uword pc) {
@@ -48,6 +48,7 @@ class ApiState;
 class BackgroundCompiler;
 class Capability;
 class CodeIndexTable;
+class CompileLedger;
 class Debugger;
 class DeoptContext;
 class ExternalTypedData;
@@ -288,9 +289,15 @@ class IdleTimeHandler : public ValueObject {
   // we have time for the GC until [deadline].
   void NotifyIdle(int64_t deadline);
 
-  // Calls [NotifyIdle] with the default deadline.
+  // Calls [NotifyIdle] with the default deadline, extended to the embedder's
+  // estimated idle window if a later one was provided via [HintIdleWindow].
   void NotifyIdleUsingDefaultDeadline();
 
+  // Records the embedder's estimate of when the current idle period will end,
+  // e.g. when its event loop's next timer fires. Shared by all isolate groups
+  // and may be called from any thread.
+  static void HintIdleWindow(int64_t deadline);
+
  private:
   friend class DisableIdleTimerScope;
 
@@ -298,6 +305,8 @@ class IdleTimeHandler : public ValueObject {
   Heap* heap_ = nullptr;
   intptr_t disabled_counter_ = 0;
   int64_t idle_start_time_ = 0;
+
+  static RelaxedAtomic<int64_t> estimated_idle_deadline_;
 };
 
 // Disables firing of the idle timer while this object is alive.
@@ -624,6 +633,11 @@ class IsolateGroup : public IntrusiveDListEntry<IsolateGroup> {
 
   MutatorThreadPool* thread_pool() { return thread_pool_.get(); }
 
+  // The dedicated pool for GC helper tasks (marking, sweeping, compacting,
+  // scavenging), so they never queue behind compiler or message handling
+  // tasks on the general thread pool.
+  ThreadPool* gc_thread_pool() { return gc_thread_pool_.get(); }
+
  private:
   friend class Dart;  // For `object_store_ = ` in Dart::Init
   friend class Heap;
@@ -659,6 +673,7 @@ class IsolateGroup : public IntrusiveDListEntry<IsolateGroup> {
 
   IdleTimeHandler idle_time_handler_;
   std::unique_ptr<MutatorThreadPool> thread_pool_;
+  std::unique_ptr<ThreadPool> gc_thread_pool_;
   std::unique_ptr<SafepointRwLock> isolates_lock_;
   IntrusiveDList<Isolate> isolates_;
   intptr_t isolate_count_ = 0;
@@ -873,6 +888,18 @@ class Isolate : public BaseIsolate, public IntrusiveDListEntry<Isolate> {
 
   int64_t UptimeMicros() const;
 
+  // CPU time consumed while this isolate's mutator was scheduled, updated
+  // when the mutator is unscheduled and at interrupt checks. Compared
+  // against --isolate_cpu_quota by Thread::HandleInterrupts.
+  int64_t accumulated_cpu_time_micros() const {
+    return accumulated_cpu_time_micros_;
+  }
+  void AccumulateCPUTimeMicros(int64_t micros) {
+    accumulated_cpu_time_micros_ += micros;
+  }
+  bool cpu_quota_exceeded() const { return cpu_quota_exceeded_; }
+  void set_cpu_quota_exceeded() { cpu_quota_exceeded_ = true; }
+
   Dart_Port main_port() const { return main_port_; }
   void set_main_port(Dart_Port port) {
     ASSERT(main_port_ == 0);  // Only set main port once.
@@ -1061,6 +1088,15 @@ class Isolate : public BaseIsolate, public IntrusiveDListEntry<Isolate> {
 #if !defined(PRODUCT)
   ObjectIdRing* object_id_ring() const { return object_id_ring_; }
   ObjectIdRing* EnsureObjectIdRing();
+
+  // Cache for service responses describing immutable program structure
+  // (currently getClassList). The cached body is replayed while the class
+  // table size and reload timestamp given at caching time are unchanged.
+  const char* CachedClassListResponse(intptr_t num_cids,
+                                      int64_t reload_timestamp) const;
+  void CacheClassListResponse(const char* response,
+                              intptr_t num_cids,
+                              int64_t reload_timestamp);
 #endif  // !defined(PRODUCT)
 
   void AddPendingDeopt(uword fp, uword pc);
@@ -1084,6 +1120,11 @@ class Isolate : public BaseIsolate, public IntrusiveDListEntry<Isolate> {
     return optimizing_background_compiler_;
   }
 
+#if !defined(PRODUCT)
+  // Ledger of recent JIT compilations; null in the precompiled runtime.
+  CompileLedger* compile_ledger() const { return compile_ledger_; }
+#endif
+
   intptr_t BlockClassFinalization() {
     ASSERT(defer_finalization_count_ >= 0);
     return defer_finalization_count_++;
@@ -1480,6 +1521,9 @@ class Isolate : public BaseIsolate, public IntrusiveDListEntry<Isolate> {
   // shared in AOT(same pointer as on IsolateGroup), not shared in JIT
   std::shared_ptr<ClassTable> class_table_;
 
+  int64_t accumulated_cpu_time_micros_ = 0;
+  bool cpu_quota_exceeded_ = false;
+
 #if !defined(DART_PRECOMPILED_RUNTIME)
   NativeCallbackTrampolines native_callback_trampolines_;
 #endif
@@ -1525,6 +1569,10 @@ class Isolate : public BaseIsolate, public IntrusiveDListEntry<Isolate> {
   // Optimized background compilation.
   BackgroundCompiler* optimizing_background_compiler_ = nullptr;
 
+#if !defined(PRODUCT)
+  CompileLedger* compile_ledger_ = nullptr;
+#endif
+
 // Fields that aren't needed in a product build go here with boolean flags at
 // the top.
 #if !defined(PRODUCT)
@@ -1559,6 +1607,10 @@ class Isolate : public BaseIsolate, public IntrusiveDListEntry<Isolate> {
   IsolateReloadContext* reload_context_ = nullptr;
   // Ring buffer of objects assigned an id.
   ObjectIdRing* object_id_ring_ = nullptr;
+  // Cached service response body and the program state it was computed for.
+  char* class_list_response_cache_ = nullptr;
+  intptr_t class_list_response_num_cids_ = 0;
+  int64_t class_list_response_reload_timestamp_ = 0;
 #endif  // !defined(PRODUCT)
 
   // All other fields go here.
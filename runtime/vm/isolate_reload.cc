@@ -70,11 +70,28 @@ DECLARE_FLAG(bool, trace_deoptimization);
 class ObjectLocator : public ObjectVisitor {
  public:
   explicit ObjectLocator(IsolateGroupReloadContext* context)
-      : context_(context), count_(0) {}
+      : table_size_(0), morpher_by_cid_(nullptr), count_(0) {
+    // The locator visits every object in the heap, so flatten the
+    // cid -> morpher mapping into a directly indexed table and keep the
+    // per-object dispatch to a bounds check and a load.
+    for (intptr_t i = 0; i < context->instance_morphers_.length(); ++i) {
+      table_size_ = Utils::Maximum(
+          table_size_, context->instance_morphers_[i]->cid() + 1);
+    }
+    morpher_by_cid_ = context->zone_->Alloc<InstanceMorpher*>(table_size_);
+    memset(morpher_by_cid_, 0, table_size_ * sizeof(InstanceMorpher*));
+    for (intptr_t i = 0; i < context->instance_morphers_.length(); ++i) {
+      InstanceMorpher* morpher = context->instance_morphers_[i];
+      morpher_by_cid_[morpher->cid()] = morpher;
+    }
+  }
 
   void VisitObject(ObjectPtr obj) {
-    InstanceMorpher* morpher =
-        context_->instance_morpher_by_cid_.LookupValue(obj->GetClassId());
+    const intptr_t cid = obj->GetClassId();
+    if (cid >= table_size_) {
+      return;
+    }
+    InstanceMorpher* morpher = morpher_by_cid_[cid];
     if (morpher != NULL) {
       morpher->AddObject(obj);
       count_++;
@@ -85,7 +102,8 @@ class ObjectLocator : public ObjectVisitor {
   intptr_t count() { return count_; }
 
  private:
-  IsolateGroupReloadContext* context_;
+  intptr_t table_size_;
+  InstanceMorpher** morpher_by_cid_;
   intptr_t count_;
 };
 
@@ -445,7 +463,6 @@ IsolateGroupReloadContext::IsolateGroupReloadContext(
       saved_size_table_(nullptr),
       instance_morphers_(zone_, 0),
       reasons_to_cancel_reload_(zone_, 0),
-      instance_morpher_by_cid_(zone_),
       root_lib_url_(String::Handle(Z, String::null())),
       root_url_prefix_(String::null()),
       old_root_url_prefix_(String::null()) {}
@@ -1237,6 +1254,12 @@ void IsolateReloadContext::DeoptimizeDependentCode() {
   TIMELINE_SCOPE(DeoptimizeDependentCode);
   ClassTable* class_table = I->class_table();
 
+  // Mark every optimized frame for lazy deoptimization once up front, so
+  // that disabling the dependent code of each class and field below does
+  // not need its own stack walk. Frames are only materialized when they are
+  // actually resumed.
+  DeoptimizeFunctionsOnStack();
+
   const intptr_t bottom = Dart::vm_isolate()->class_table()->NumCids();
   const intptr_t top = I->class_table()->NumCids();
   Class& cls = Class::Handle();
@@ -1252,7 +1275,7 @@ void IsolateReloadContext::DeoptimizeDependentCode() {
     cls = class_table->At(cls_idx);
     ASSERT(!cls.IsNull());
 
-    cls.DisableAllCHAOptimizedCode();
+    cls.DisableAllCHAOptimizedCode(/*deoptimize_frames=*/false);
 
     // Deoptimize field guard code.
     fields = cls.fields();
@@ -1260,7 +1283,7 @@ void IsolateReloadContext::DeoptimizeDependentCode() {
     for (intptr_t field_idx = 0; field_idx < fields.Length(); field_idx++) {
       field = Field::RawCast(fields.At(field_idx));
       ASSERT(!field.IsNull());
-      field.DeoptimizeDependentCode();
+      field.DeoptimizeDependentCode(/*deoptimize_frames=*/false);
     }
   }
 
@@ -1760,7 +1783,6 @@ void IsolateGroupReloadContext::EnsureHasInstanceMorpherFor(
     }
   }
   instance_morphers_.Add(instance_morpher);
-  instance_morpher_by_cid_.Insert(instance_morpher);
   ASSERT(instance_morphers_[instance_morphers_.length() - 1]->cid() == cid);
 }
 
@@ -1970,7 +1992,7 @@ void IsolateReloadContext::ResetUnoptimizedICsOnStack() {
 }
 
 void IsolateReloadContext::ResetMegamorphicCaches() {
-  object_store()->set_megamorphic_cache_table(GrowableObjectArray::Handle());
+  object_store()->set_megamorphic_cache_table(Array::Handle());
   // Since any current optimized code will not make any more calls, it may be
   // better to clear the table instead of clearing each of the caches, allow
   // the current megamorphic caches get GC'd and any new optimized code allocate
@@ -249,27 +249,12 @@ class IsolateGroupReloadContext {
   intptr_t num_received_procedures_ = -1;
   intptr_t num_saved_libs_ = -1;
 
-  // Required trait for the instance_morpher_by_cid_;
-  struct MorpherTrait {
-    typedef InstanceMorpher* Value;
-    typedef intptr_t Key;
-    typedef InstanceMorpher* Pair;
-
-    static Key KeyOf(Pair kv) { return kv->cid(); }
-    static Value ValueOf(Pair kv) { return kv; }
-    static intptr_t Hashcode(Key key) { return key; }
-    static bool IsKeyEqual(Pair kv, Key key) { return kv->cid() == key; }
-  };
-
   // Collect the necessary instance transformation for schema changes.
   GrowableArray<InstanceMorpher*> instance_morphers_;
 
   // Collects the reasons for cancelling the reload.
   GrowableArray<ReasonForCancelling*> reasons_to_cancel_reload_;
 
-  // Hash map from cid to InstanceMorpher.
-  DirectChainedHashMap<MorpherTrait> instance_morpher_by_cid_;
-
   // A bit vector indicating which of the original libraries were modified.
   BitVector* modified_libs_ = nullptr;
 
@@ -770,11 +770,16 @@ ObjectPtr KernelLoader::LoadProgram(bool process_pending_classes) {
 void KernelLoader::LoadLibrary(const Library& library) {
   ASSERT(!library.Loaded());
 
+  // Compare directly against the canonical name strings in the binary, so
+  // that scanning for the right library does not intern a symbol for the URI
+  // of every candidate.
   const auto& uri = String::Handle(Z, library.url());
+  const char* const uri_cstring = uri.ToCString();
   const intptr_t num_libraries = program_->library_count();
   for (intptr_t i = 0; i < num_libraries; ++i) {
-    const String& library_uri = LibraryUri(i);
-    if (library_uri.Equals(uri)) {
+    const StringIndex library_uri_index =
+        H.CanonicalNameString(library_canonical_name(i));
+    if (H.StringEquals(library_uri_index, uri_cstring)) {
       LoadLibrary(i);
       return;
     }
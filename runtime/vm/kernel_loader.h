@@ -97,10 +97,23 @@ class LibraryIndex {
   }
 
   intptr_t SizeOfClassAtOffset(intptr_t class_offset) const {
-    for (intptr_t i = 0, offset = class_index_offset_; i < class_count_;
-         ++i, offset += 4) {
-      if (static_cast<intptr_t>(reader_.ReadUInt32At(offset)) == class_offset) {
-        return reader_.ReadUInt32At(offset + 4) - class_offset;
+    // Classes are serialized in order, so the offsets in the class index are
+    // ascending and we can binary search. This is called once per class when
+    // class loading is finished lazily, so a linear scan would make loading
+    // all classes of a library quadratic in the number of classes.
+    intptr_t lo = 0;
+    intptr_t hi = class_count_ - 1;
+    while (lo <= hi) {
+      const intptr_t mid = lo + (hi - lo) / 2;
+      const intptr_t mid_offset =
+          reader_.ReadUInt32At(class_index_offset_ + mid * 4);
+      if (mid_offset < class_offset) {
+        lo = mid + 1;
+      } else if (mid_offset > class_offset) {
+        hi = mid - 1;
+      } else {
+        return reader_.ReadUInt32At(class_index_offset_ + (mid + 1) * 4) -
+               class_offset;
       }
     }
     UNREACHABLE();
@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 #include "vm/compiler/jit/compiler.h"
+#include "vm/hash_table.h"
 #include "vm/object.h"
 #include "vm/object_store.h"
 #include "vm/stub_code.h"
@@ -13,6 +14,43 @@
 
 namespace dart {
 
+// Hashes and compares a (target name, arguments descriptor) pair before a
+// MegamorphicCache for it exists.
+class MegamorphicCacheEntryKey : public ValueObject {
+ public:
+  MegamorphicCacheEntryKey(const String& name, const Array& descriptor)
+      : name_(name), descriptor_(descriptor) {}
+
+  const String& name() const { return name_; }
+  const Array& descriptor() const { return descriptor_; }
+
+ private:
+  const String& name_;
+  const Array& descriptor_;
+};
+
+bool MegamorphicCacheTableTraits::IsMatch(const Object& a, const Object& b) {
+  const MegamorphicCache& cache_a = MegamorphicCache::Cast(a);
+  const MegamorphicCache& cache_b = MegamorphicCache::Cast(b);
+  return (cache_a.target_name() == cache_b.target_name()) &&
+         (cache_a.arguments_descriptor() == cache_b.arguments_descriptor());
+}
+
+bool MegamorphicCacheTableTraits::IsMatch(const MegamorphicCacheEntryKey& a,
+                                          const Object& b) {
+  const MegamorphicCache& cache = MegamorphicCache::Cast(b);
+  return (a.name().raw() == cache.target_name()) &&
+         (a.descriptor().raw() == cache.arguments_descriptor());
+}
+
+uword MegamorphicCacheTableTraits::Hash(const Object& obj) {
+  return String::HashRawSymbol(MegamorphicCache::Cast(obj).target_name());
+}
+
+uword MegamorphicCacheTableTraits::Hash(const MegamorphicCacheEntryKey& key) {
+  return String::HashRawSymbol(key.name().raw());
+}
+
 MegamorphicCachePtr MegamorphicCacheTable::Lookup(Thread* thread,
                                                   const String& name,
                                                   const Array& descriptor) {
@@ -22,25 +60,22 @@ MegamorphicCachePtr MegamorphicCacheTable::Lookup(Thread* thread,
   ASSERT(name.IsSymbol());
   // TODO(rmacnak): ASSERT(descriptor.IsCanonical());
 
-  // TODO(rmacnak): Make a proper hashtable a la symbol table.
-  GrowableObjectArray& table = GrowableObjectArray::Handle(
-      isolate->object_store()->megamorphic_cache_table());
-  MegamorphicCache& cache = MegamorphicCache::Handle();
-  if (table.IsNull()) {
-    table = GrowableObjectArray::New(Heap::kOld);
-    isolate->object_store()->set_megamorphic_cache_table(table);
-  } else {
-    for (intptr_t i = 0; i < table.Length(); i++) {
-      cache ^= table.At(i);
-      if ((cache.target_name() == name.raw()) &&
-          (cache.arguments_descriptor() == descriptor.raw())) {
-        return cache.raw();
-      }
-    }
+  Zone* zone = thread->zone();
+  Array& backing = Array::Handle(
+      zone, isolate->object_store()->megamorphic_cache_table());
+  if (backing.IsNull()) {
+    backing = HashTables::New<MegamorphicCacheSet>(16, Heap::kOld);
   }
-
-  cache = MegamorphicCache::New(name, descriptor);
-  table.Add(cache, Heap::kOld);
+  MegamorphicCacheSet table(zone, backing.raw());
+  MegamorphicCache& cache = MegamorphicCache::Handle(zone);
+  MegamorphicCacheEntryKey key(name, descriptor);
+  cache ^= table.GetOrNull(key);
+  if (cache.IsNull()) {
+    cache = MegamorphicCache::New(name, descriptor);
+    bool present = table.Insert(cache);
+    ASSERT(!present);
+  }
+  isolate->object_store()->set_megamorphic_cache_table(table.Release());
   return cache.raw();
 }
 
@@ -49,12 +84,14 @@ void MegamorphicCacheTable::PrintSizes(Isolate* isolate) {
   intptr_t size = 0;
   MegamorphicCache& cache = MegamorphicCache::Handle();
   Array& buckets = Array::Handle();
-  const GrowableObjectArray& table = GrowableObjectArray::Handle(
-      isolate->object_store()->megamorphic_cache_table());
-  if (table.IsNull()) return;
+  const Array& backing =
+      Array::Handle(isolate->object_store()->megamorphic_cache_table());
+  if (backing.IsNull()) return;
+  MegamorphicCacheSet table(zone.GetZone(), backing.raw());
   intptr_t max_size = 0;
-  for (intptr_t i = 0; i < table.Length(); i++) {
-    cache ^= table.At(i);
+  MegamorphicCacheSet::Iterator it(&table);
+  while (it.MoveNext()) {
+    cache ^= table.GetKey(it.Current());
     buckets = cache.buckets();
     size += MegamorphicCache::InstanceSize();
     size += Array::InstanceSize(buckets.Length());
@@ -62,8 +99,8 @@ void MegamorphicCacheTable::PrintSizes(Isolate* isolate) {
       max_size = buckets.Length();
     }
   }
-  OS::PrintErr("%" Pd " megamorphic caches using %" Pd "KB.\n", table.Length(),
-               size / 1024);
+  OS::PrintErr("%" Pd " megamorphic caches using %" Pd "KB.\n",
+               table.NumOccupied(), size / 1024);
 
   intptr_t* probe_counts = new intptr_t[max_size];
   intptr_t entry_count = 0;
@@ -71,8 +108,9 @@ void MegamorphicCacheTable::PrintSizes(Isolate* isolate) {
   for (intptr_t i = 0; i < max_size; i++) {
     probe_counts[i] = 0;
   }
-  for (intptr_t i = 0; i < table.Length(); i++) {
-    cache ^= table.At(i);
+  MegamorphicCacheSet::Iterator probe_it(&table);
+  while (probe_it.MoveNext()) {
+    cache ^= table.GetKey(probe_it.Current());
     buckets = cache.buckets();
     intptr_t mask = cache.mask();
     intptr_t capacity = mask + 1;
@@ -110,6 +148,7 @@ void MegamorphicCacheTable::PrintSizes(Isolate* isolate) {
                      static_cast<double>(entry_count));
   }
   delete[] probe_counts;
+  ASSERT(table.Release().raw() == backing.raw());
 }
 
 }  // namespace dart
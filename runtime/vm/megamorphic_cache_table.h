@@ -12,9 +12,27 @@ namespace dart {
 
 class Array;
 class Isolate;
+class MegamorphicCacheEntryKey;
+class Object;
 class String;
 class Thread;
 
+template <typename KeyTraits>
+class UnorderedHashSet;
+
+// Keys the set of megamorphic caches by their (target name, arguments
+// descriptor) pair.
+class MegamorphicCacheTableTraits {
+ public:
+  static const char* Name() { return "MegamorphicCacheTableTraits"; }
+  static bool ReportStats() { return false; }
+  static bool IsMatch(const Object& a, const Object& b);
+  static bool IsMatch(const MegamorphicCacheEntryKey& a, const Object& b);
+  static uword Hash(const Object& obj);
+  static uword Hash(const MegamorphicCacheEntryKey& key);
+};
+typedef UnorderedHashSet<MegamorphicCacheTableTraits> MegamorphicCacheSet;
+
 class MegamorphicCacheTable : public AllStatic {
  public:
   static MegamorphicCachePtr Lookup(Thread* thread,
@@ -275,4 +275,63 @@ void MessageQueue::PrintJSON(JSONStream* stream) {
 #endif  // !PRODUCT
 }
 
+MessageInbox::MessageInbox() : head_(nullptr) {}
+
+MessageInbox::~MessageInbox() {
+  // Ensure that all pending messages have been released.
+  Clear();
+  ASSERT(head_.load() == nullptr);
+}
+
+void MessageInbox::Push(std::unique_ptr<Message> msg0) {
+  Message* msg = msg0.release();
+
+  // Make sure messages are not reused.
+  ASSERT(msg->next_ == NULL);
+  Message* old_head = head_.load(std::memory_order_relaxed);
+  do {
+    msg->next_ = old_head;
+  } while (!head_.compare_exchange_weak(old_head, msg));
+}
+
+void MessageInbox::DrainTo(MessageQueue* queue, MessageQueue* oob_queue) {
+  Message* msg = TakeAll();
+  while (msg != nullptr) {
+    Message* next = msg->next_;
+    msg->next_ = nullptr;
+    std::unique_ptr<Message> message(msg);
+    if (message->IsOOB()) {
+      oob_queue->Enqueue(std::move(message), false);
+    } else {
+      queue->Enqueue(std::move(message), false);
+    }
+    msg = next;
+  }
+}
+
+Message* MessageInbox::TakeAll() {
+  Message* head = head_.exchange(nullptr);
+  // Pushes link the newest message first; reverse to get arrival order.
+  Message* reversed = nullptr;
+  while (head != nullptr) {
+    Message* next = head->next_;
+    head->next_ = reversed;
+    reversed = head;
+    head = next;
+  }
+  return reversed;
+}
+
+void MessageInbox::Clear() {
+  std::unique_ptr<Message> cur(TakeAll());
+  while (cur != nullptr) {
+    std::unique_ptr<Message> next(cur->next_);
+    cur->next_ = nullptr;
+    if (cur->RedirectToDeliveryFailurePort()) {
+      PortMap::PostMessage(std::move(cur));
+    }
+    cur = std::move(next);
+  }
+}
+
 }  // namespace dart
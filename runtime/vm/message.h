@@ -5,6 +5,7 @@
 #ifndef RUNTIME_VM_MESSAGE_H_
 #define RUNTIME_VM_MESSAGE_H_
 
+#include <atomic>
 #include <memory>
 #include <utility>
 
@@ -130,6 +131,7 @@ class Message {
   static const char* PriorityAsString(Priority priority);
 
  private:
+  friend class MessageInbox;
   friend class MessageQueue;
 
   Message* next_;
@@ -200,6 +202,36 @@ class MessageQueue {
   DISALLOW_COPY_AND_ASSIGN(MessageQueue);
 };
 
+// A lock-free multi-producer inbox feeding a message handler. Producers push
+// messages without taking the handler's monitor; whoever holds the monitor
+// drains the pushed messages into the FIFO message queues.
+class MessageInbox {
+ public:
+  MessageInbox();
+  ~MessageInbox();
+
+  // Pushes a message. Safe to call concurrently from any thread.
+  void Push(std::unique_ptr<Message> msg);
+
+  // Moves all pushed messages into the given queues in push order, OOB
+  // messages into 'oob_queue' and the rest into 'queue'. Drainers must be
+  // serialized externally by the handler's monitor.
+  void DrainTo(MessageQueue* queue, MessageQueue* oob_queue);
+
+  bool IsEmpty() const { return head_.load() == nullptr; }
+
+  // Clear all messages from the inbox.
+  void Clear();
+
+ private:
+  // Removes all pushed messages and returns them linked in push order.
+  Message* TakeAll();
+
+  std::atomic<Message*> head_;  // Newest message first.
+
+  DISALLOW_COPY_AND_ASSIGN(MessageInbox);
+};
+
 }  // namespace dart
 
 #endif  // RUNTIME_VM_MESSAGE_H_
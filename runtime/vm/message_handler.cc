@@ -69,6 +69,7 @@ MessageHandler::MessageHandler()
       paused_timestamp_(-1),
 #endif
       task_running_(false),
+      direct_deliveries_(0),
       delete_me_(false),
       pool_(NULL),
       start_callback_(NULL),
@@ -124,56 +125,93 @@ void MessageHandler::Run(ThreadPool* pool,
 
 void MessageHandler::PostMessage(std::unique_ptr<Message> message,
                                  bool before_events) {
-  Message::Priority saved_priority;
-
-  {
-    MonitorLocker ml(&monitor_);
-    if (FLAG_trace_isolates) {
-      Isolate* source_isolate = Isolate::Current();
-      if (source_isolate != nullptr) {
-        OS::PrintErr(
-            "[>] Posting message:\n"
-            "\tlen:        %" Pd "\n\tsource:     (%" Pd64
-            ") %s\n\tdest:       %s\n"
-            "\tdest_port:  %" Pd64 "\n",
-            message->Size(), static_cast<int64_t>(source_isolate->main_port()),
-            source_isolate->name(), name(), message->dest_port());
-      } else {
-        OS::PrintErr(
-            "[>] Posting message:\n"
-            "\tlen:        %" Pd
-            "\n\tsource:     <native code>\n"
-            "\tdest:       %s\n"
-            "\tdest_port:  %" Pd64 "\n",
-            message->Size(), name(), message->dest_port());
-      }
+  if (FLAG_trace_isolates) {
+    Isolate* source_isolate = Isolate::Current();
+    if (source_isolate != nullptr) {
+      OS::PrintErr(
+          "[>] Posting message:\n"
+          "\tlen:        %" Pd "\n\tsource:     (%" Pd64
+          ") %s\n\tdest:       %s\n"
+          "\tdest_port:  %" Pd64 "\n",
+          message->Size(), static_cast<int64_t>(source_isolate->main_port()),
+          source_isolate->name(), name(), message->dest_port());
+    } else {
+      OS::PrintErr(
+          "[>] Posting message:\n"
+          "\tlen:        %" Pd
+          "\n\tsource:     <native code>\n"
+          "\tdest:       %s\n"
+          "\tdest_port:  %" Pd64 "\n",
+          message->Size(), name(), message->dest_port());
     }
+  }
 
-    saved_priority = message->priority();
+  const Message::Priority saved_priority = message->priority();
+  if (before_events) {
+    // Isolate library control messages must be spliced ahead of pending
+    // events. This is rare, so take the monitor and enqueue directly after
+    // draining the inbox to preserve the arrival order.
+    MonitorLocker ml(&monitor_);
+    DrainInboxLocked();
     if (message->IsOOB()) {
-      oob_queue_->Enqueue(std::move(message), before_events);
+      oob_queue_->Enqueue(std::move(message), true);
     } else {
-      queue_->Enqueue(std::move(message), before_events);
+      queue_->Enqueue(std::move(message), true);
     }
     if (paused_for_messages_) {
       ml.Notify();
     }
-
     if (pool_ != nullptr && !task_running_) {
       ASSERT(!delete_me_);
       task_running_ = true;
       const bool launched_successfully = pool_->Run<MessageHandlerTask>(this);
       ASSERT(launched_successfully);
     }
+  } else {
+    inbox_.Push(std::move(message));
+    // A consumer about to block publishes its state before re-checking the
+    // inbox, and the push above is sequentially consistent with the loads
+    // below, so either we observe the flags and wake the consumer up, or
+    // the consumer observes our message.
+    if (paused_for_messages_.load() || !task_running_.load()) {
+      MonitorLocker ml(&monitor_);
+      if (paused_for_messages_) {
+        ml.Notify();
+      }
+      if (pool_ != nullptr && !task_running_) {
+        ASSERT(!delete_me_);
+        task_running_ = true;
+        const bool launched_successfully = pool_->Run<MessageHandlerTask>(this);
+        ASSERT(launched_successfully);
+      }
+    }
   }
 
   // Invoke any custom message notification.
   MessageNotify(saved_priority);
 }
 
+void MessageHandler::DrainInboxLocked() {
+  ASSERT(monitor_.IsOwnedByCurrentThread());
+  inbox_.DrainTo(queue_, oob_queue_);
+}
+
+void MessageHandler::EndTaskLocked() {
+  ASSERT(monitor_.IsOwnedByCurrentThread());
+  ASSERT(task_running_);
+  task_running_ = false;
+  // A producer that observed task_running_ still set will not have scheduled
+  // a task for its message; claim such messages by scheduling one ourselves.
+  if (!inbox_.IsEmpty() && (pool_ != nullptr)) {
+    task_running_ = true;
+    const bool launched_successfully = pool_->Run<MessageHandlerTask>(this);
+    ASSERT(launched_successfully);
+  }
+}
+
 std::unique_ptr<Message> MessageHandler::DequeueMessage(
     Message::Priority min_priority) {
-  // TODO(turnidge): Add assert that monitor_ is held here.
+  DrainInboxLocked();
   std::unique_ptr<Message> message = oob_queue_->Dequeue();
   if ((message == nullptr) && (min_priority < Message::kOOBPriority)) {
     message = queue_->Dequeue();
@@ -182,6 +220,7 @@ std::unique_ptr<Message> MessageHandler::DequeueMessage(
 }
 
 void MessageHandler::ClearOOBQueue() {
+  DrainInboxLocked();
   oob_queue_->Clear();
 }
 
@@ -302,7 +341,11 @@ MessageHandler::MessageStatus MessageHandler::PauseAndHandleAllMessages(
 #if defined(DEBUG)
   CheckAccess();
 #endif
+  // Publish that we are about to block before re-checking the inbox, so a
+  // concurrent producer either sees the flag and notifies us or we see its
+  // message.
   paused_for_messages_ = true;
+  DrainInboxLocked();
   while (queue_->IsEmpty() && oob_queue_->IsEmpty()) {
     Monitor::WaitResult wr;
     {
@@ -316,6 +359,7 @@ MessageHandler::MessageStatus MessageHandler::PauseAndHandleAllMessages(
     if (wr == Monitor::kTimedOut) {
       break;
     }
+    DrainInboxLocked();
     if (queue_->IsEmpty()) {
       // There are only OOB messages. Handle them and then continue waiting for
       // normal messages unless there is an error.
@@ -368,11 +412,13 @@ bool MessageHandler::ShouldPauseOnExit(MessageStatus status) const {
 
 bool MessageHandler::HasOOBMessages() {
   MonitorLocker ml(&monitor_);
+  DrainInboxLocked();
   return !oob_queue_->IsEmpty();
 }
 
 bool MessageHandler::HasMessages() {
   MonitorLocker ml(&monitor_);
+  DrainInboxLocked();
   return !queue_->IsEmpty();
 }
 
@@ -405,7 +451,7 @@ void MessageHandler::TaskCallback() {
       if (ShouldPauseOnStart(status)) {
         // Still paused.
         ASSERT(oob_queue_->IsEmpty());
-        task_running_ = false;  // No task in queue.
+        EndTaskLocked();  // No task in queue.
         return;
       } else {
         PausedOnStartLocked(&ml, false);
@@ -416,7 +462,7 @@ void MessageHandler::TaskCallback() {
       if (ShouldPauseOnExit(status)) {
         // Still paused.
         ASSERT(oob_queue_->IsEmpty());
-        task_running_ = false;  // No task in queue.
+        EndTaskLocked();  // No task in queue.
         return;
       } else {
         PausedOnExitLocked(&ml, false);
@@ -461,7 +507,7 @@ void MessageHandler::TaskCallback() {
         if (ShouldPauseOnExit(status)) {
           // Still paused.
           ASSERT(oob_queue_->IsEmpty());
-          task_running_ = false;  // No task in queue.
+          EndTaskLocked();  // No task in queue.
           return;
         } else {
           PausedOnExitLocked(&ml, false);
@@ -488,13 +534,15 @@ void MessageHandler::TaskCallback() {
       end_callback = end_callback_;
       callback_data = callback_data_;
       run_end_callback = end_callback_ != NULL;
-      delete_me = delete_me_;
+      // If a direct delivery is still running on a posting thread, the last
+      // EndDirectDelivery performs the deletion instead.
+      delete_me = delete_me_ && (direct_deliveries_ == 0);
     }
 
     // Clear task_running_ last.  This allows other tasks to potentially start
     // for this message handler.
     ASSERT(oob_queue_->IsEmpty());
-    task_running_ = false;
+    EndTaskLocked();
   }
 
   // The handler may have been deleted by another thread here if it is a native
@@ -534,6 +582,7 @@ void MessageHandler::CloseAllPorts() {
         "\thandler:    %s\n",
         name());
   }
+  inbox_.Clear();
   queue_->Clear();
   oob_queue_->Clear();
 }
@@ -542,8 +591,9 @@ void MessageHandler::RequestDeletion() {
   ASSERT(OwnedByPortMap());
   {
     MonitorLocker ml(&monitor_);
-    if (task_running_) {
-      // This message handler currently has a task running on the thread pool.
+    if (task_running_ || (direct_deliveries_ > 0)) {
+      // This message handler currently has a task running on the thread pool
+      // or a direct delivery running on a posting thread.
       delete_me_ = true;
       return;
     }
@@ -553,6 +603,28 @@ void MessageHandler::RequestDeletion() {
   delete this;
 }
 
+bool MessageHandler::BeginDirectDelivery() {
+  MonitorLocker ml(&monitor_);
+  if (delete_me_) {
+    return false;
+  }
+  direct_deliveries_++;
+  return true;
+}
+
+void MessageHandler::EndDirectDelivery() {
+  bool delete_me = false;
+  {
+    MonitorLocker ml(&monitor_);
+    ASSERT(direct_deliveries_ > 0);
+    direct_deliveries_--;
+    delete_me = delete_me_ && !task_running_ && (direct_deliveries_ == 0);
+  }
+  if (delete_me) {
+    delete this;
+  }
+}
+
 void MessageHandler::increment_live_ports() {
   MonitorLocker ml(&monitor_);
 #if defined(DEBUG)
@@ -640,6 +712,7 @@ void MessageHandler::PausedOnExitLocked(MonitorLocker* ml, bool paused) {
 MessageHandler::AcquiredQueues::AcquiredQueues(MessageHandler* handler)
     : handler_(handler), ml_(&handler->monitor_) {
   ASSERT(handler != NULL);
+  handler_->DrainInboxLocked();
   handler_->oob_message_handling_allowed_ = false;
 }
 
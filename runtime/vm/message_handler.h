@@ -5,6 +5,7 @@
 #ifndef RUNTIME_VM_MESSAGE_HANDLER_H_
 #define RUNTIME_VM_MESSAGE_HANDLER_H_
 
+#include <atomic>
 #include <memory>
 
 #include "vm/isolate.h"
@@ -180,6 +181,18 @@ class MessageHandler {
   // Notifies this handler that all ports are being closed.
   void CloseAllPorts();
 
+  // Returns true if [message] should bypass the queue and be handled
+  // immediately on the posting thread. Overridden by handlers whose
+  // callbacks are reentrant-safe; see NativeMessageHandler.
+  virtual bool DeliversDirectly(Message* message) { return false; }
+
+  // Brackets a direct delivery, keeping the handler alive while its
+  // callback runs on a posting thread. BeginDirectDelivery fails if the
+  // handler has already been scheduled for deletion; EndDirectDelivery
+  // performs a pending deletion when the last direct delivery retires.
+  bool BeginDirectDelivery();
+  void EndDirectDelivery();
+
   // Returns true if the handler is owned by the PortMap.
   //
   // This is used to delete handlers when their last live port is closed.
@@ -233,6 +246,17 @@ class MessageHandler {
   void PausedOnStartLocked(MonitorLocker* ml, bool paused);
   void PausedOnExitLocked(MonitorLocker* ml, bool paused);
 
+  // Moves all messages pushed to the lock-free inbox into the FIFO queues.
+  // Requires the monitor to be held, which serializes drainers against each
+  // other; producers never take it.
+  void DrainInboxLocked();
+
+  // Clears task_running_ and schedules a new task if the inbox was raced.
+  // A producer pushes its message before checking task_running_, so either
+  // it observes the cleared flag and schedules a task itself, or the check
+  // here observes its message.
+  void EndTaskLocked();
+
   // Dequeue the next message.  Prefer messages from the oob_queue_ to
   // messages from the queue_.
   std::unique_ptr<Message> DequeueMessage(Message::Priority min_priority);
@@ -244,13 +268,18 @@ class MessageHandler {
                                bool allow_normal_messages,
                                bool allow_multiple_normal_messages);
 
-  Monitor monitor_;  // Protects all fields in MessageHandler.
+  Monitor monitor_;  // Protects all fields in MessageHandler except inbox_.
+  // Incoming messages are pushed here without taking monitor_ and drained
+  // into the queues below by whoever holds it.
+  MessageInbox inbox_;
   MessageQueue* queue_;
   MessageQueue* oob_queue_;
   // This flag is not thread safe and can only reliably be accessed on a single
   // thread.
   bool oob_message_handling_allowed_;
-  bool paused_for_messages_;
+  // Read by producers without holding monitor_ to decide whether a sleeping
+  // consumer needs a wakeup; written while holding it.
+  std::atomic<bool> paused_for_messages_;
   PortSet<PortSetEntry>
       ports_;  // Only accessed by [PortMap], protected by [PortMap]s lock.
   intptr_t live_ports_;  // The number of open ports, including control ports.
@@ -262,7 +291,11 @@ class MessageHandler {
   bool is_paused_on_exit_;
   int64_t paused_timestamp_;
 #endif
-  bool task_running_;
+  // Read by producers without holding monitor_ to decide whether a new task
+  // needs to be scheduled; written while holding it.
+  std::atomic<bool> task_running_;
+  // The number of direct deliveries currently running on posting threads.
+  intptr_t direct_deliveries_;
   bool delete_me_;
   ThreadPool* pool_;
   StartCallback start_callback_;
@@ -24,8 +24,21 @@ class MessageHandlerTestPeer {
   void increment_live_ports() { handler_->increment_live_ports(); }
   void decrement_live_ports() { handler_->decrement_live_ports(); }
 
-  MessageQueue* queue() const { return handler_->queue_; }
-  MessageQueue* oob_queue() const { return handler_->oob_queue_; }
+  MessageQueue* queue() const {
+    DrainInbox();
+    return handler_->queue_;
+  }
+  MessageQueue* oob_queue() const {
+    DrainInbox();
+    return handler_->oob_queue_;
+  }
+
+  // Posted messages land in the lock-free inbox first; move them into the
+  // queues so the tests can inspect them.
+  void DrainInbox() const {
+    MonitorLocker ml(&handler_->monitor_);
+    handler_->DrainInboxLocked();
+  }
 
  private:
   MessageHandler* handler_;
@@ -140,4 +140,41 @@ TEST_CASE(MessageQueue_Clear) {
   EXPECT(queue.IsEmpty());
 }
 
+TEST_CASE(MessageInbox_DrainPreservesOrder) {
+  MessageInbox inbox;
+  EXPECT(inbox.IsEmpty());
+
+  Dart_Port port = 1;
+
+  const char* str1 = "msg1";
+  const char* str2 = "msg2";
+  const char* str3 = "msg3";
+
+  std::unique_ptr<Message> msg =
+      Message::New(port, AllocMsg(str1), strlen(str1) + 1, nullptr,
+                   Message::kNormalPriority);
+  Message* msg1 = msg.get();
+  inbox.Push(std::move(msg));
+  msg = Message::New(port, AllocMsg(str2), strlen(str2) + 1, nullptr,
+                     Message::kOOBPriority);
+  Message* msg2 = msg.get();
+  inbox.Push(std::move(msg));
+  msg = Message::New(port, AllocMsg(str3), strlen(str3) + 1, nullptr,
+                     Message::kNormalPriority);
+  Message* msg3 = msg.get();
+  inbox.Push(std::move(msg));
+  EXPECT(!inbox.IsEmpty());
+
+  // Messages drain in push order, OOB messages into the OOB queue.
+  MessageQueue queue;
+  MessageQueue oob_queue;
+  inbox.DrainTo(&queue, &oob_queue);
+  EXPECT(inbox.IsEmpty());
+  EXPECT(queue.Length() == 2);
+  EXPECT(oob_queue.Length() == 1);
+  EXPECT(queue.Dequeue().get() == msg1);
+  EXPECT(oob_queue.Dequeue().get() == msg2);
+  EXPECT(queue.Dequeue().get() == msg3);
+}
+
 }  // namespace dart
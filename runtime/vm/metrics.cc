@@ -10,6 +10,7 @@
 #include "vm/native_entry.h"
 #include "vm/object.h"
 #include "vm/runtime_entry.h"
+#include "vm/zone.h"
 
 namespace dart {
 
@@ -156,6 +157,11 @@ int64_t MetricHeapOldExternal::Value() const {
   return isolate_group()->heap()->ExternalInWords(Heap::kOld) * kWordSize;
 }
 
+int64_t MetricHeapOldMutatorUtilization::Value() const {
+  ASSERT(isolate_group() == IsolateGroup::Current());
+  return isolate_group()->heap()->old_space()->mutator_utilization();
+}
+
 int64_t MetricHeapNewUsed::Value() const {
   ASSERT(isolate_group() == IsolateGroup::Current());
   return isolate_group()->heap()->UsedInWords(Heap::kNew) * kWordSize;
@@ -189,6 +195,14 @@ int64_t MetricCurrentRSS::Value() const {
 int64_t MetricPeakRSS::Value() const {
   return Service::MaxRSS();
 }
+
+int64_t MetricCurrentZoneMemory::Value() const {
+  return Zone::Size();
+}
+
+int64_t MetricPeakZoneMemory::Value() const {
+  return Zone::MaxSize();
+}
 #endif  // !defined(PRODUCT)
 
 #if !defined(PRODUCT)
@@ -241,4 +255,52 @@ void MinMetric::SetValue(int64_t new_value) {
   }
 }
 
+HistogramMetric::HistogramMetric() : Metric(), count_(0), sum_(0) {
+  for (intptr_t i = 0; i < kBucketCount; i++) {
+    buckets_[i] = 0;
+  }
+}
+
+void HistogramMetric::Record(int64_t value) {
+  intptr_t bucket = (value <= 1) ? 0 : Utils::BitLength(value - 1);
+  if (bucket >= kBucketCount) {
+    bucket = kBucketCount - 1;
+  }
+  buckets_[bucket] += 1;
+  count_ += 1;
+  sum_ += value;
+}
+
+int64_t HistogramMetric::BucketCountAt(intptr_t bucket) const {
+  ASSERT((bucket >= 0) && (bucket < kBucketCount));
+  return buckets_[bucket];
+}
+
+int64_t HistogramMetric::BucketUpperBound(intptr_t bucket) {
+  ASSERT((bucket >= 0) && (bucket < kBucketCount));
+  if (bucket == kBucketCount - 1) {
+    return kMaxInt64;
+  }
+  return static_cast<int64_t>(1) << bucket;
+}
+
+#if !defined(PRODUCT)
+void HistogramMetric::PrintJSON(JSONStream* stream) {
+  JSONObject obj(stream);
+  obj.AddProperty("type", "Counter");
+  obj.AddProperty("name", name());
+  obj.AddProperty("description", description());
+  obj.AddProperty("unit", UnitString(unit()));
+  obj.AddFixedServiceId("metrics/native/%s", name());
+  obj.AddProperty("value", static_cast<double>(Value()));
+  obj.AddProperty64("count", count());
+  {
+    JSONArray buckets(&obj, "buckets");
+    for (intptr_t i = 0; i < kBucketCount; i++) {
+      buckets.AddValue64(BucketCountAt(i));
+    }
+  }
+}
+#endif  // !defined(PRODUCT)
+
 }  // namespace dart
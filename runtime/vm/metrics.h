@@ -5,6 +5,7 @@
 #ifndef RUNTIME_VM_METRICS_H_
 #define RUNTIME_VM_METRICS_H_
 
+#include "platform/atomic.h"
 #include "vm/allocation.h"
 
 namespace dart {
@@ -20,23 +21,33 @@ class JSONStream;
   V(MetricHeapOldCapacity, HeapOldCapacity, "heap.old.capacity", kByte)        \
   V(MaxMetric, HeapOldCapacityMax, "heap.old.capacity.max", kByte)             \
   V(MetricHeapOldExternal, HeapOldExternal, "heap.old.external", kByte)        \
+  V(MetricHeapOldMutatorUtilization, HeapOldMutatorUtilization,                \
+    "heap.old.mutator.utilization", kCounter)                                  \
   V(MetricHeapNewUsed, HeapNewUsed, "heap.new.used", kByte)                    \
   V(MaxMetric, HeapNewUsedMax, "heap.new.used.max", kByte)                     \
   V(MetricHeapNewCapacity, HeapNewCapacity, "heap.new.capacity", kByte)        \
   V(MaxMetric, HeapNewCapacityMax, "heap.new.capacity.max", kByte)             \
   V(MetricHeapNewExternal, HeapNewExternal, "heap.new.external", kByte)        \
   V(MetricHeapUsed, HeapGlobalUsed, "heap.global.used", kByte)                 \
-  V(MaxMetric, HeapGlobalUsedMax, "heap.global.used.max", kByte)
+  V(MaxMetric, HeapGlobalUsedMax, "heap.global.used.max", kByte)               \
+  V(MaxMetric, TimeToSafepointMax, "safepoint.timeToSafepoint.max",            \
+    kMicrosecond)                                                              \
+  V(HistogramMetric, TimeToSafepoint, "safepoint.timeToSafepoint",             \
+    kMicrosecond)                                                              \
+  V(HistogramMetric, GcPauseTime, "heap.gc.pauseTime", kMicrosecond)
 
 // Metrics for each isolate.
 #define ISOLATE_METRIC_LIST(V)                                                 \
   V(Metric, RunnableLatency, "isolate.runnable.latency", kMicrosecond)         \
-  V(Metric, RunnableHeapSize, "isolate.runnable.heap", kByte)
+  V(Metric, RunnableHeapSize, "isolate.runnable.heap", kByte)                  \
+  V(HistogramMetric, CompileTime, "compile.time", kMicrosecond)
 
 #define VM_METRIC_LIST(V)                                                      \
   V(MetricIsolateCount, IsolateCount, "vm.isolate.count", kCounter)            \
   V(MetricCurrentRSS, CurrentRSS, "vm.memory.current", kByte)                  \
-  V(MetricPeakRSS, PeakRSS, "vm.memory.max", kByte)
+  V(MetricPeakRSS, PeakRSS, "vm.memory.max", kByte)                            \
+  V(MetricCurrentZoneMemory, CurrentZoneMemory, "vm.zone.current", kByte)      \
+  V(MetricPeakZoneMemory, PeakZoneMemory, "vm.zone.max", kByte)
 
 class Metric {
  public:
@@ -131,6 +142,40 @@ class MinMetric : public Metric {
   void SetValue(int64_t new_value);
 };
 
+// A Metric class that aggregates every recorded value into power-of-two
+// buckets, so distributions (e.g. of pause times) can be scraped cheaply and
+// without locks. Bucket 0 counts values of at most 1 unit; bucket i counts
+// values in (2^(i-1), 2^i]; the last bucket counts all larger values.
+// Value() reports the sum of all recorded values.
+class HistogramMetric : public Metric {
+ public:
+  static const intptr_t kBucketCount = 16;
+
+  HistogramMetric();
+
+  // Safe to call concurrently from multiple threads.
+  void Record(int64_t value);
+
+  int64_t count() const { return count_; }
+  int64_t sum() const { return sum_; }
+  int64_t BucketCountAt(intptr_t bucket) const;
+
+  // The upper bound (inclusive) of the given bucket; kMaxInt64 for the last
+  // bucket.
+  static int64_t BucketUpperBound(intptr_t bucket);
+
+  virtual int64_t Value() const { return sum(); }
+
+#ifndef PRODUCT
+  void PrintJSON(JSONStream* stream);
+#endif  // !PRODUCT
+
+ private:
+  RelaxedAtomic<int64_t> buckets_[kBucketCount];
+  RelaxedAtomic<int64_t> count_;
+  RelaxedAtomic<int64_t> sum_;
+};
+
 class MetricHeapOldUsed : public Metric {
  public:
   virtual int64_t Value() const;
@@ -146,6 +191,13 @@ class MetricHeapOldExternal : public Metric {
   virtual int64_t Value() const;
 };
 
+// Percentage of wall time spent in the mutator (as opposed to the collector)
+// over the old-space controller's sliding window of recent collections.
+class MetricHeapOldMutatorUtilization : public Metric {
+ public:
+  virtual int64_t Value() const;
+};
+
 class MetricHeapNewUsed : public Metric {
  public:
   virtual int64_t Value() const;
@@ -176,6 +228,16 @@ class MetricPeakRSS : public Metric {
  public:
   virtual int64_t Value() const;
 };
+
+class MetricCurrentZoneMemory : public Metric {
+ public:
+  virtual int64_t Value() const;
+};
+
+class MetricPeakZoneMemory : public Metric {
+ public:
+  virtual int64_t Value() const;
+};
 #endif  // !defined(PRODUCT)
 
 class MetricHeapUsed : public Metric {
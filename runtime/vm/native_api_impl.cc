@@ -7,6 +7,7 @@
 #include "include/dart_native_api.h"
 
 #include "platform/assert.h"
+#include "platform/atomic.h"
 #include "platform/utils.h"
 #include "vm/dart_api_impl.h"
 #include "vm/dart_api_message.h"
@@ -91,6 +92,29 @@ DART_EXPORT Dart_Port Dart_NewNativePort(const char* name,
   return port_id;
 }
 
+DART_EXPORT Dart_Port Dart_NewDirectNativePort(
+    const char* name,
+    Dart_NativeMessageHandler handler) {
+  if (name == NULL) {
+    name = "<UnnamedDirectNativePort>";
+  }
+  if (handler == NULL) {
+    OS::PrintErr("%s expects argument 'handler' to be non-null.\n",
+                 CURRENT_FUNC);
+    return ILLEGAL_PORT;
+  }
+  // Start the native port without a current isolate.
+  IsolateLeaveScope saver(Isolate::Current());
+
+  NativeMessageHandler* nmh =
+      new NativeMessageHandler(name, handler, /*handles_directly=*/true);
+  Dart_Port port_id = PortMap::CreatePort(nmh);
+  PortMap::SetPortState(port_id, PortMap::kLivePort);
+  // The pool still backs nested posts, which fall back to queued delivery.
+  nmh->Run(Dart::thread_pool(), NULL, NULL, 0);
+  return port_id;
+}
+
 DART_EXPORT bool Dart_CloseNativePort(Dart_Port native_port_id) {
   // Close the native port without a current isolate.
   IsolateLeaveScope saver(Isolate::Current());
@@ -99,6 +123,142 @@ DART_EXPORT bool Dart_CloseNativePort(Dart_Port native_port_id) {
   return PortMap::ClosePort(native_port_id);
 }
 
+// --- CObject arenas ---
+
+struct CObjectArenaBlock {
+  CObjectArenaBlock* next;
+  intptr_t capacity;
+  intptr_t used;
+  // The payload follows the header.
+  uint8_t* data() { return reinterpret_cast<uint8_t*>(this + 1); }
+};
+
+struct CObjectArena {
+  static const intptr_t kMinBlockCapacity = 4 * KB;
+
+  CObjectArenaBlock* head;  // Block allocations are bumped from.
+};
+
+static CObjectArenaBlock* AllocateCObjectArenaBlock(intptr_t capacity,
+                                                    CObjectArenaBlock* next) {
+  CObjectArenaBlock* block = reinterpret_cast<CObjectArenaBlock*>(
+      malloc(sizeof(CObjectArenaBlock) + capacity));
+  block->next = next;
+  block->capacity = capacity;
+  block->used = 0;
+  return block;
+}
+
+static void* CObjectArenaAllocate(CObjectArena* arena, intptr_t size) {
+  size = Utils::RoundUp(size, kDoubleSize);
+  CObjectArenaBlock* block = arena->head;
+  if (block->used + size > block->capacity) {
+    const intptr_t capacity =
+        Utils::Maximum(size, CObjectArena::kMinBlockCapacity);
+    block = AllocateCObjectArenaBlock(capacity, block);
+    arena->head = block;
+  }
+  void* result = block->data() + block->used;
+  block->used += size;
+  return result;
+}
+
+DART_EXPORT Dart_CObjectArena* Dart_CreateCObjectArena(
+    intptr_t initial_capacity) {
+  const intptr_t capacity = Utils::Maximum(
+      Utils::RoundUp(initial_capacity, kDoubleSize),
+      CObjectArena::kMinBlockCapacity);
+  CObjectArena* arena = new CObjectArena();
+  arena->head = AllocateCObjectArenaBlock(capacity, nullptr);
+  return reinterpret_cast<Dart_CObjectArena*>(arena);
+}
+
+DART_EXPORT void Dart_ResetCObjectArena(Dart_CObjectArena* opaque_arena) {
+  CObjectArena* arena = reinterpret_cast<CObjectArena*>(opaque_arena);
+  for (CObjectArenaBlock* block = arena->head; block != nullptr;
+       block = block->next) {
+    block->used = 0;
+  }
+}
+
+DART_EXPORT void Dart_DestroyCObjectArena(Dart_CObjectArena* opaque_arena) {
+  CObjectArena* arena = reinterpret_cast<CObjectArena*>(opaque_arena);
+  CObjectArenaBlock* block = arena->head;
+  while (block != nullptr) {
+    CObjectArenaBlock* next = block->next;
+    free(block);
+    block = next;
+  }
+  delete arena;
+}
+
+DART_EXPORT void* Dart_CObjectArenaAllocate(Dart_CObjectArena* opaque_arena,
+                                            intptr_t size) {
+  if (size < 0) {
+    return nullptr;
+  }
+  return CObjectArenaAllocate(reinterpret_cast<CObjectArena*>(opaque_arena),
+                              size);
+}
+
+DART_EXPORT Dart_CObject* Dart_CObjectArenaNewObject(
+    Dart_CObjectArena* opaque_arena,
+    Dart_CObject_Type type) {
+  CObjectArena* arena = reinterpret_cast<CObjectArena*>(opaque_arena);
+  Dart_CObject* object = reinterpret_cast<Dart_CObject*>(
+      CObjectArenaAllocate(arena, sizeof(Dart_CObject)));
+  memset(object, 0, sizeof(Dart_CObject));
+  object->type = type;
+  return object;
+}
+
+DART_EXPORT Dart_CObject* Dart_CObjectArenaNewArray(
+    Dart_CObjectArena* opaque_arena,
+    intptr_t length) {
+  if (length < 0) {
+    return nullptr;
+  }
+  CObjectArena* arena = reinterpret_cast<CObjectArena*>(opaque_arena);
+  // One allocation carries the array node, the values vector and all of
+  // the element nodes.
+  const intptr_t size = sizeof(Dart_CObject) +
+                        length * sizeof(Dart_CObject*) +
+                        length * sizeof(Dart_CObject);
+  Dart_CObject* array =
+      reinterpret_cast<Dart_CObject*>(CObjectArenaAllocate(arena, size));
+  memset(array, 0, size);
+  Dart_CObject** values =
+      reinterpret_cast<Dart_CObject**>(array + 1);
+  Dart_CObject* elements = reinterpret_cast<Dart_CObject*>(values + length);
+  for (intptr_t i = 0; i < length; i++) {
+    values[i] = &elements[i];  // Starts out zeroed, i.e. kNull.
+  }
+  array->type = Dart_CObject_kArray;
+  array->value.as_array.length = length;
+  array->value.as_array.values = (length > 0) ? values : nullptr;
+  return array;
+}
+
+DART_EXPORT Dart_CObject* Dart_CObjectArenaNewTypedData(
+    Dart_CObjectArena* opaque_arena,
+    Dart_TypedData_Type type,
+    intptr_t length_in_bytes) {
+  if (length_in_bytes < 0) {
+    return nullptr;
+  }
+  CObjectArena* arena = reinterpret_cast<CObjectArena*>(opaque_arena);
+  const intptr_t size = sizeof(Dart_CObject) + length_in_bytes;
+  Dart_CObject* object =
+      reinterpret_cast<Dart_CObject*>(CObjectArenaAllocate(arena, size));
+  memset(object, 0, sizeof(Dart_CObject));
+  object->type = Dart_CObject_kTypedData;
+  object->value.as_typed_data.type = type;
+  object->value.as_typed_data.length = length_in_bytes;
+  object->value.as_typed_data.values =
+      (length_in_bytes > 0) ? reinterpret_cast<uint8_t*>(object + 1) : nullptr;
+  return object;
+}
+
 static Monitor* vm_service_calls_monitor = new Monitor();
 
 DART_EXPORT bool Dart_InvokeVMServiceMethod(uint8_t* request_json,
@@ -186,6 +346,67 @@ DART_EXPORT bool Dart_InvokeVMServiceMethod(uint8_t* request_json,
 #endif  // !defined(PRODUCT)
 }
 
+// --- Shared buffer rings ---
+
+// The reference count lives outside the shared region so that Dart code
+// holding a view over the region cannot corrupt it.
+struct SharedRing {
+  AcqRelAtomic<intptr_t> ref_count;
+  intptr_t size;  // Header plus data bytes.
+  uint8_t* region;
+};
+
+static void ReleaseSharedRing(SharedRing* ring) {
+  if (ring->ref_count.fetch_sub(1) == 1) {
+    free(ring->region);
+    delete ring;
+  }
+}
+
+static void SharedRingViewFinalizer(void* isolate_callback_data, void* peer) {
+  ReleaseSharedRing(reinterpret_cast<SharedRing*>(peer));
+}
+
+DART_EXPORT Dart_SharedRing* Dart_CreateSharedRing(intptr_t capacity) {
+  if (capacity <= 0) {
+    return nullptr;
+  }
+  const intptr_t size = DART_SHARED_RING_DATA_OFFSET + capacity;
+  uint8_t* region = reinterpret_cast<uint8_t*>(malloc(size));
+  if (region == nullptr) {
+    return nullptr;
+  }
+  memset(region, 0, size);
+  SharedRing* ring = new SharedRing();
+  ring->ref_count.store(1);
+  ring->size = size;
+  ring->region = region;
+  return reinterpret_cast<Dart_SharedRing*>(ring);
+}
+
+DART_EXPORT Dart_Handle Dart_SharedRingView(Dart_SharedRing* opaque_ring) {
+  if (opaque_ring == nullptr) {
+    return Api::NewError("%s expects argument 'ring' to be non-null.",
+                         CURRENT_FUNC);
+  }
+  SharedRing* ring = reinterpret_cast<SharedRing*>(opaque_ring);
+  ring->ref_count.fetch_add(1);
+  Dart_Handle view = Dart_NewExternalTypedDataWithFinalizer(
+      Dart_TypedData_kUint8, ring->region, ring->size, ring, ring->size,
+      SharedRingViewFinalizer);
+  if (Dart_IsError(view)) {
+    ReleaseSharedRing(ring);
+  }
+  return view;
+}
+
+DART_EXPORT void Dart_ReleaseSharedRing(Dart_SharedRing* opaque_ring) {
+  if (opaque_ring == nullptr) {
+    return;
+  }
+  ReleaseSharedRing(reinterpret_cast<SharedRing*>(opaque_ring));
+}
+
 // --- Verification tools ---
 
 DART_EXPORT Dart_Handle Dart_CompileAll() {
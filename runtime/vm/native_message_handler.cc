@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "vm/dart_api_message.h"
+#include "vm/dart_api_state.h"
 #include "vm/isolate.h"
 #include "vm/message.h"
 #include "vm/snapshot.h"
@@ -14,8 +15,11 @@
 namespace dart {
 
 NativeMessageHandler::NativeMessageHandler(const char* name,
-                                           Dart_NativeMessageHandler func)
-    : name_(Utils::StrDup(name)), func_(func) {}
+                                           Dart_NativeMessageHandler func,
+                                           bool handles_directly)
+    : name_(Utils::StrDup(name)),
+      func_(func),
+      handles_directly_(handles_directly) {}
 
 NativeMessageHandler::~NativeMessageHandler() {
   free(name_);
@@ -44,4 +48,13 @@ MessageHandler::MessageStatus NativeMessageHandler::HandleMessage(
   return kOK;
 }
 
+bool NativeMessageHandler::DeliversDirectly(Message* message) {
+  // A nested post from inside a direct handler (or from any code already
+  // inside a native message scope) falls back to the thread pool:
+  // ApiNativeScope does not nest, and the fallback bounds the work a single
+  // post performs inline.
+  return handles_directly_ && !message->IsOOB() &&
+         (ApiNativeScope::Current() == nullptr);
+}
+
 }  // namespace dart
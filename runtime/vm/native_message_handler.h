@@ -15,7 +15,12 @@ namespace dart {
 // native C handlers.
 class NativeMessageHandler : public MessageHandler {
  public:
-  NativeMessageHandler(const char* name, Dart_NativeMessageHandler func);
+  // With [handles_directly] set, messages are handled on the thread that
+  // posts them instead of on the thread pool; the embedder has declared the
+  // handler reentrant-safe. See Dart_NewDirectNativePort.
+  NativeMessageHandler(const char* name,
+                       Dart_NativeMessageHandler func,
+                       bool handles_directly = false);
   ~NativeMessageHandler();
 
   const char* name() const { return name_; }
@@ -23,6 +28,8 @@ class NativeMessageHandler : public MessageHandler {
 
   MessageStatus HandleMessage(std::unique_ptr<Message> message);
 
+  virtual bool DeliversDirectly(Message* message);
+
 #if defined(DEBUG)
   // Check that it is safe to access this handler.
   void CheckAccess();
@@ -34,6 +41,7 @@ class NativeMessageHandler : public MessageHandler {
  private:
   char* name_;
   Dart_NativeMessageHandler func_;
+  bool handles_directly_;
 };
 
 }  // namespace dart
@@ -34,9 +34,11 @@
 #include "vm/exceptions.h"
 #include "vm/growable_array.h"
 #include "vm/hash.h"
+#include "vm/hash_map.h"
 #include "vm/hash_table.h"
 #include "vm/heap/become.h"
 #include "vm/heap/heap.h"
+#include "vm/heap/scavenger.h"
 #include "vm/heap/weak_code.h"
 #include "vm/image_snapshot.h"
 #include "vm/isolate_reload.h"
@@ -100,6 +102,7 @@ DECLARE_FLAG(bool, trace_reload);
 DECLARE_FLAG(bool, write_protect_code);
 DECLARE_FLAG(bool, precompiled_mode);
 DECLARE_FLAG(int, max_polymorphic_checks);
+DECLARE_FLAG(int, profile_allocation_interval);
 
 static const char* const kGetterPrefix = "get:";
 static const intptr_t kGetterPrefixLength = strlen(kGetterPrefix);
@@ -2622,6 +2625,16 @@ ObjectPtr Object::Allocate(intptr_t cls_id, intptr_t size, Heap::Space space) {
   auto class_table = thread->isolate_group()->shared_class_table();
   if (class_table->TraceAllocationFor(cls_id)) {
     Profiler::SampleAllocation(thread, cls_id);
+  } else if (FLAG_profile_allocation_interval > 0) {
+    // Interval sampling: take a stack sample approximately every N allocated
+    // bytes, which is cheap enough to stay enabled while running production
+    // workloads.
+    intptr_t budget = thread->allocation_sample_budget() - size;
+    if (budget <= 0) {
+      Profiler::SampleAllocation(thread, cls_id);
+      budget = FLAG_profile_allocation_interval;
+    }
+    thread->set_allocation_sample_budget(budget);
   }
 #endif  // !PRODUCT
   NoSafepointScope no_safepoint;
@@ -2694,9 +2707,9 @@ ObjectPtr Object::Clone(const Object& orig, Heap::Space space) {
   uword orig_addr = ObjectLayout::ToAddr(orig.raw());
   uword clone_addr = ObjectLayout::ToAddr(raw_clone);
   static const intptr_t kHeaderSizeInBytes = sizeof(ObjectLayout);
-  memmove(reinterpret_cast<uint8_t*>(clone_addr + kHeaderSizeInBytes),
-          reinterpret_cast<uint8_t*>(orig_addr + kHeaderSizeInBytes),
-          size - kHeaderSizeInBytes);
+  objcpy(reinterpret_cast<uint8_t*>(clone_addr + kHeaderSizeInBytes),
+         reinterpret_cast<uint8_t*>(orig_addr + kHeaderSizeInBytes),
+         size - kHeaderSizeInBytes);
 
   // Add clone to store buffer, if needed.
   if (!raw_clone->IsOldObject()) {
@@ -3359,66 +3372,86 @@ UnboxedFieldBitmap Class::CalculateFieldOffsets() const {
   ASSERT(target_offset > 0);
   Field& field = Field::Handle();
   const intptr_t len = flds.Length();
-  for (intptr_t i = 0; i < len; i++) {
-    field ^= flds.At(i);
-    // Offset is computed only for instance fields.
-    if (!field.is_static()) {
-      ASSERT(field.HostOffset() == 0);
-      ASSERT(field.TargetOffset() == 0);
-      field.SetOffset(host_offset, target_offset);
-
-      if (FLAG_precompiled_mode && field.is_unboxing_candidate()) {
-        intptr_t field_size;
-        switch (field.guarded_cid()) {
-          case kDoubleCid:
-            field_size = sizeof(DoubleLayout::value_);
-            break;
-          case kFloat32x4Cid:
-            field_size = sizeof(Float32x4Layout::value_);
-            break;
-          case kFloat64x2Cid:
-            field_size = sizeof(Float64x2Layout::value_);
-            break;
-          default:
-            if (field.is_non_nullable_integer()) {
-              field_size = sizeof(MintLayout::value_);
-            } else {
-              UNREACHABLE();
-              field_size = 0;
-            }
-            break;
+  // Lay out unboxing candidates before boxed fields, keeping declaration
+  // order within each group. Every field is one word except unboxed values,
+  // so grouping cannot introduce alignment holes, but clustering the unboxed
+  // fields at low offsets lets more of them fit inside the fixed-length
+  // UnboxedFieldBitmap instead of being force-boxed. All reflective and
+  // compiled accesses go through the offsets recorded on each Field, so the
+  // in-memory order need not match the declaration order.
+  for (intptr_t pass = 0; pass < 2; pass++) {
+    const bool unboxed_pass = (pass == 0);
+    for (intptr_t i = 0; i < len; i++) {
+      field ^= flds.At(i);
+      // Offset is computed only for instance fields.
+      if (!field.is_static()) {
+        const bool unboxed =
+            FLAG_precompiled_mode && field.is_unboxing_candidate();
+        if (unboxed_pass) {
+          if (!unboxed) continue;
+        } else {
+          // A candidate that exhausted the bitmap in the first pass had its
+          // candidate bit cleared after it was already assigned an offset.
+          if (field.HostOffset() != 0) continue;
         }
+        ASSERT(field.HostOffset() == 0);
+        ASSERT(field.TargetOffset() == 0);
+        field.SetOffset(host_offset, target_offset);
+
+        if (unboxed) {
+          intptr_t field_size;
+          switch (field.guarded_cid()) {
+            case kDoubleCid:
+              field_size = sizeof(DoubleLayout::value_);
+              break;
+            case kFloat32x4Cid:
+              field_size = sizeof(Float32x4Layout::value_);
+              break;
+            case kFloat64x2Cid:
+              field_size = sizeof(Float64x2Layout::value_);
+              break;
+            default:
+              if (field.is_non_nullable_integer()) {
+                field_size = sizeof(MintLayout::value_);
+              } else {
+                UNREACHABLE();
+                field_size = 0;
+              }
+              break;
+          }
+
+          const intptr_t host_num_words = field_size / kWordSize;
+          const intptr_t host_next_offset = host_offset + field_size;
+          const intptr_t host_next_position = host_next_offset / kWordSize;
+
+          const intptr_t target_next_offset = target_offset + field_size;
+          const intptr_t target_next_position =
+              target_next_offset / compiler::target::kWordSize;
+
+          // The bitmap has fixed length. Checks if the offset position is
+          // smaller than its length. If it is not, than the field should be
+          // boxed
+          if (host_next_position <= UnboxedFieldBitmap::Length() &&
+              target_next_position <= UnboxedFieldBitmap::Length()) {
+            for (intptr_t j = 0; j < host_num_words; j++) {
+              // Activate the respective bit in the bitmap, indicating that the
+              // content is not a pointer
+              host_bitmap.Set(host_offset / kWordSize);
+              host_offset += kWordSize;
+            }
 
-        const intptr_t host_num_words = field_size / kWordSize;
-        const intptr_t host_next_offset = host_offset + field_size;
-        const intptr_t host_next_position = host_next_offset / kWordSize;
-
-        const intptr_t target_next_offset = target_offset + field_size;
-        const intptr_t target_next_position =
-            target_next_offset / compiler::target::kWordSize;
-
-        // The bitmap has fixed length. Checks if the offset position is smaller
-        // than its length. If it is not, than the field should be boxed
-        if (host_next_position <= UnboxedFieldBitmap::Length() &&
-            target_next_position <= UnboxedFieldBitmap::Length()) {
-          for (intptr_t j = 0; j < host_num_words; j++) {
-            // Activate the respective bit in the bitmap, indicating that the
-            // content is not a pointer
-            host_bitmap.Set(host_offset / kWordSize);
+            ASSERT(host_offset == host_next_offset);
+            target_offset = target_next_offset;
+          } else {
+            // Make the field boxed
+            field.set_is_unboxing_candidate(false);
             host_offset += kWordSize;
+            target_offset += compiler::target::kWordSize;
           }
-
-          ASSERT(host_offset == host_next_offset);
-          target_offset = target_next_offset;
         } else {
-          // Make the field boxed
-          field.set_is_unboxing_candidate(false);
           host_offset += kWordSize;
           target_offset += compiler::target::kWordSize;
         }
-      } else {
-        host_offset += kWordSize;
-        target_offset += compiler::target::kWordSize;
       }
     }
   }
@@ -3918,7 +3951,8 @@ void Class::RegisterCHACode(const Code& code) {
   a.Register(code);
 }
 
-void Class::DisableCHAOptimizedCode(const Class& subclass) {
+void Class::DisableCHAOptimizedCode(const Class& subclass,
+                                    bool deoptimize_frames) {
   ASSERT(Thread::Current()->IsMutatorThread());
   CHACodeArray a(*this);
   if (FLAG_trace_deoptimization && a.HasCodes()) {
@@ -3928,11 +3962,11 @@ void Class::DisableCHAOptimizedCode(const Class& subclass) {
       THR_Print("Deopt for CHA (new subclass %s)\n", subclass.ToCString());
     }
   }
-  a.DisableCode();
+  a.DisableCode(deoptimize_frames);
 }
 
-void Class::DisableAllCHAOptimizedCode() {
-  DisableCHAOptimizedCode(Class::Handle());
+void Class::DisableAllCHAOptimizedCode(bool deoptimize_frames) {
+  DisableCHAOptimizedCode(Class::Handle(), deoptimize_frames);
 }
 
 bool Class::TraceAllocation(Isolate* isolate) const {
@@ -5706,6 +5740,13 @@ class CanonicalInstanceKey {
   }
   bool Matches(const Instance& obj) const {
     ASSERT(!(obj.IsString() || obj.IsInteger() || obj.IsAbstractType()));
+    // Compare the canonical hashes before doing the field-by-field
+    // comparison: almost every probe collision is on an instance with a
+    // different hash, and both hashes are memoized in the heap's canonical
+    // hash table, so this skips the expensive comparison in the common case.
+    if (key_.CanonicalizeHash() != obj.CanonicalizeHash()) {
+      return false;
+    }
     if (key_.CanonicalizeEquals(obj)) {
       ASSERT(obj.IsCanonical());
       return true;
@@ -7187,6 +7228,20 @@ bool Function::FfiCSignatureContainsHandles() const {
          kFfiHandleCid;
 }
 
+bool Function::FfiIsLeaf() const {
+  ASSERT(IsFfiTrampoline());
+  const Object& obj = Object::Handle(raw_ptr()->data_);
+  ASSERT(!obj.IsNull());
+  return FfiTrampolineData::Cast(obj).is_leaf();
+}
+
+void Function::SetFfiIsLeaf(bool is_leaf) const {
+  ASSERT(IsFfiTrampoline());
+  const Object& obj = Object::Handle(raw_ptr()->data_);
+  ASSERT(!obj.IsNull());
+  FfiTrampolineData::Cast(obj).set_is_leaf(is_leaf);
+}
+
 int32_t Function::FfiCallbackId() const {
   ASSERT(IsFfiTrampoline());
   const Object& obj = Object::Handle(raw_ptr()->data_);
@@ -9938,6 +9993,10 @@ void FfiTrampolineData::set_callback_id(int32_t callback_id) const {
   StoreNonPointer(&raw_ptr()->callback_id_, callback_id);
 }
 
+void FfiTrampolineData::set_is_leaf(bool is_leaf) const {
+  StoreNonPointer(&raw_ptr()->is_leaf_, is_leaf);
+}
+
 void FfiTrampolineData::set_callback_exceptional_return(
     const Instance& value) const {
   StorePointer(&raw_ptr()->callback_exceptional_return_, value.raw());
@@ -9950,6 +10009,7 @@ FfiTrampolineDataPtr FfiTrampolineData::New() {
                        FfiTrampolineData::InstanceSize(), Heap::kOld);
   FfiTrampolineDataPtr data = static_cast<FfiTrampolineDataPtr>(raw);
   data->ptr()->callback_id_ = 0;
+  data->ptr()->is_leaf_ = false;
   return data;
 }
 
@@ -10463,14 +10523,14 @@ void Field::RegisterDependentCode(const Code& code) const {
   a.Register(code);
 }
 
-void Field::DeoptimizeDependentCode() const {
+void Field::DeoptimizeDependentCode(bool deoptimize_frames) const {
   ASSERT(Thread::Current()->IsMutatorThread());
   ASSERT(IsOriginal());
   FieldDependentArray a(*this);
   if (FLAG_trace_deoptimization && a.HasCodes()) {
     THR_Print("Deopt for field guard (field %s)\n", ToCString());
   }
-  a.DisableCode();
+  a.DisableCode(deoptimize_frames);
 }
 
 bool Field::IsConsistentWith(const Field& other) const {
@@ -11063,6 +11123,18 @@ void Field::RecordStore(const Object& value) const {
   }
 
   if (invalidate) {
+    if (FLAG_eager_field_guard_generalization &&
+        (guarded_cid() != kDynamicCid)) {
+      // The guard was violated after real feedback had been recorded, so the
+      // field is polymorphic in practice. Skipping the intermediate guard
+      // states deoptimizes dependent code once instead of once per state the
+      // guard settles through.
+      if (FLAG_trace_field_guards) {
+        THR_Print("    => eagerly generalized to <*>\n");
+      }
+      ForceDynamicGuardedCidAndLength();
+      return;
+    }
     if (FLAG_trace_field_guards) {
       THR_Print("    => %s\n", GuardedPropertiesAsCString());
     }
@@ -17396,13 +17468,22 @@ void SubtypeTestCache::AddCheck(
              ->subtype_test_cache_mutex()
              ->IsOwnedByCurrentThread());
 
-  intptr_t old_num = NumberOfChecks();
-  Array& data = Array::Handle(cache());
-  intptr_t new_len = data.Length() + kTestEntryLength;
-  data = Array::Grow(data, new_len);
-
-  SubtypeTestCacheTable entries(data);
-  auto entry = entries[old_num];
+  const Array& data = Array::Handle(cache());
+  const intptr_t old_len = data.Length();
+  const intptr_t new_len = old_len + kTestEntryLength;
+  // The new entry goes in front: the type testing stubs scan the cache
+  // linearly from index 0, so recently recorded checks, which are the most
+  // likely to be probed again, are found first. The old entries, including
+  // the null sentinel at the end, shift back by one entry.
+  const Array& new_data = Array::Handle(Array::New(new_len, Heap::kOld));
+  Object& element = Object::Handle();
+  for (intptr_t i = 0; i < old_len; i++) {
+    element = data.At(i);
+    new_data.SetAt(kTestEntryLength + i, element);
+  }
+
+  SubtypeTestCacheTable entries(new_data);
+  auto entry = entries[0];
   ASSERT(entry.Get<kInstanceClassIdOrFunction>() == Object::null());
   entry.Set<kInstanceClassIdOrFunction>(instance_class_id_or_function);
   entry.Set<kInstanceTypeArguments>(instance_type_arguments);
@@ -17416,7 +17497,7 @@ void SubtypeTestCache::AddCheck(
 
   // We let any concurrently running mutator thread now see the new entry (the
   // `set_cache()` uses a store-release barrier).
-  set_cache(data);
+  set_cache(new_data);
 }
 
 void SubtypeTestCache::GetCheck(
@@ -21605,6 +21686,32 @@ bool String::Equals(const String& str,
     return false;  // Lengths don't match.
   }
 
+  if (CharSize() == str.CharSize()) {
+    // Both strings have the same representation width: compare the character
+    // data directly instead of going through CharAt, which repeats the
+    // representation dispatch for every character. memcmp is vectorized by
+    // the C library on all supported platforms.
+    NoSafepointScope no_safepoint;
+    if (CharSize() == kOneByteChar) {
+      const uint8_t* this_data = IsOneByteString()
+                                     ? OneByteString::DataStart(*this)
+                                     : ExternalOneByteString::DataStart(*this);
+      const uint8_t* str_data = str.IsOneByteString()
+                                    ? OneByteString::DataStart(str)
+                                    : ExternalOneByteString::DataStart(str);
+      return memcmp(this_data, str_data + begin_index, len) == 0;
+    }
+    ASSERT(CharSize() == kTwoByteChar);
+    const uint16_t* this_data = IsTwoByteString()
+                                    ? TwoByteString::DataStart(*this)
+                                    : ExternalTwoByteString::DataStart(*this);
+    const uint16_t* str_data = str.IsTwoByteString()
+                                   ? TwoByteString::DataStart(str)
+                                   : ExternalTwoByteString::DataStart(str);
+    return memcmp(this_data, str_data + begin_index,
+                  len * sizeof(uint16_t)) == 0;
+  }
+
   for (intptr_t i = 0; i < len; i++) {
     if (CharAt(i) != str.CharAt(begin_index + i)) {
       return false;
@@ -21641,6 +21748,14 @@ bool String::Equals(const uint8_t* latin1_array, intptr_t len) const {
     return false;
   }
 
+  if (CharSize() == kOneByteChar) {
+    NoSafepointScope no_safepoint;
+    const uint8_t* data = IsOneByteString()
+                              ? OneByteString::DataStart(*this)
+                              : ExternalOneByteString::DataStart(*this);
+    return memcmp(data, latin1_array, len) == 0;
+  }
+
   for (intptr_t i = 0; i < len; i++) {
     if (this->CharAt(i) != latin1_array[i]) {
       return false;
@@ -21655,6 +21770,14 @@ bool String::Equals(const uint16_t* utf16_array, intptr_t len) const {
     return false;
   }
 
+  if (CharSize() == kTwoByteChar) {
+    NoSafepointScope no_safepoint;
+    const uint16_t* data = IsTwoByteString()
+                               ? TwoByteString::DataStart(*this)
+                               : ExternalTwoByteString::DataStart(*this);
+    return memcmp(data, utf16_array, len * sizeof(uint16_t)) == 0;
+  }
+
   for (intptr_t i = 0; i < len; i++) {
     if (this->CharAt(i) != LoadUnaligned(&utf16_array[i])) {
       return false;
@@ -22190,6 +22313,61 @@ StringPtr String::SubString(const String& str,
                            space);
 }
 
+// Substrings of external strings this long or longer are returned as views
+// sharing the parent's buffer instead of copies. A view pins the parent's
+// entire buffer for as long as it lives, so short slices still copy.
+static const intptr_t kExternalSubstringViewThreshold = 64;
+
+// Finalizer of an external substring view. The view's peer is the persistent
+// handle that keeps the parent external string, and thus the shared buffer,
+// alive.
+static void FreeSubstringViewParent(void* isolate_callback_data, void* peer) {
+  auto const handle = reinterpret_cast<PersistentHandle*>(peer);
+  IsolateGroup::Current()->api_state()->FreePersistentHandle(handle);
+}
+
+// Allocates a persistent handle pinning [parent] for use as a view's peer.
+static PersistentHandle* PinSubstringViewParent(const String& parent) {
+  ApiState* state = IsolateGroup::Current()->api_state();
+  PersistentHandle* handle = state->AllocatePersistentHandle();
+  handle->set_raw(parent);
+  return handle;
+}
+
+uint16_t String::CodeUnitLimit(const String& str,
+                               intptr_t start,
+                               intptr_t end) {
+  ASSERT(str.IsTwoByteString() || str.IsExternalTwoByteString());
+  ASSERT((0 <= start) && (start <= end) && (end <= str.Length()));
+  NoSafepointScope no_safepoint;
+  const uint16_t* units = str.IsTwoByteString()
+                              ? TwoByteString::DataStart(str)
+                              : ExternalTwoByteString::DataStart(str);
+  const uint16_t* cursor = units + start;
+  const uint16_t* limit = units + end;
+  uint16_t result = 0;
+  // Align on a word boundary, then fold a word's worth of code units per
+  // iteration so long scans read each word only once.
+  while ((cursor < limit) &&
+         !Utils::IsAligned(reinterpret_cast<uword>(cursor), sizeof(uword))) {
+    result |= *cursor++;
+  }
+  const intptr_t kUnitsPerWord = sizeof(uword) / sizeof(uint16_t);
+  uword word_or = 0;
+  while ((limit - cursor) >= kUnitsPerWord) {
+    word_or |= *reinterpret_cast<const uword*>(cursor);
+    cursor += kUnitsPerWord;
+  }
+  for (intptr_t shift = kBitsPerWord / 2; shift >= 16; shift >>= 1) {
+    word_or |= word_or >> shift;
+  }
+  result |= static_cast<uint16_t>(word_or & 0xFFFF);
+  while (cursor < limit) {
+    result |= *cursor++;
+  }
+  return result;
+}
+
 StringPtr String::SubString(Thread* thread,
                             const String& str,
                             intptr_t begin_index,
@@ -22207,11 +22385,24 @@ StringPtr String::SubString(Thread* thread,
   bool is_one_byte_string = true;
   intptr_t char_size = str.CharSize();
   if (char_size == kTwoByteChar) {
-    for (intptr_t i = begin_index; i < begin_index + length; ++i) {
-      if (!Utf::IsLatin1(str.CharAt(i))) {
-        is_one_byte_string = false;
-        break;
-      }
+    is_one_byte_string =
+        Utf::IsLatin1(CodeUnitLimit(str, begin_index, begin_index + length));
+  }
+  if (length >= kExternalSubstringViewThreshold) {
+    // Long substrings of external strings become views sharing the parent's
+    // buffer instead of copies. External strings are handled everywhere in
+    // the VM, so the views never need to be materialized. The buffer cannot
+    // move, so the data pointer stays valid across the allocation below.
+    // Latin-1 slices of two-byte parents still copy so they narrow.
+    if (str.IsExternalOneByteString()) {
+      return ExternalOneByteString::New(
+          ExternalOneByteString::DataStart(str) + begin_index, length,
+          PinSubstringViewParent(str), 0, FreeSubstringViewParent, space);
+    }
+    if (str.IsExternalTwoByteString() && !is_one_byte_string) {
+      return ExternalTwoByteString::New(
+          ExternalTwoByteString::DataStart(str) + begin_index, length,
+          PinSubstringViewParent(str), 0, FreeSubstringViewParent, space);
     }
   }
   REUSABLE_STRING_HANDLESCOPE(thread);
@@ -23077,7 +23268,7 @@ ArrayPtr Array::Grow(const Array& source,
                      intptr_t new_length,
                      Heap::Space space) {
   Zone* zone = Thread::Current()->zone();
-  const Array& result = Array::Handle(zone, Array::New(new_length, space));
+  Array& result = Array::Handle(zone, Array::New(new_length, space));
   intptr_t len = 0;
   if (!source.IsNull()) {
     len = source.Length();
@@ -23086,10 +23277,8 @@ ArrayPtr Array::Grow(const Array& source,
   }
   ASSERT(new_length >= len);  // Cannot copy 'source' into new array.
   ASSERT(new_length != len);  // Unnecessary copying of array.
-  PassiveObject& obj = PassiveObject::Handle(zone);
-  for (int i = 0; i < len; i++) {
-    obj = source.At(i);
-    result.SetAt(i, obj);
+  if (len > 0) {
+    result.StoreArrayPointers(result.ObjectAddr(0), source.ObjectAddr(0), len);
   }
   return result.raw();
 }
@@ -24221,11 +24410,11 @@ static void PrintSymbolicStackFrameBody(BaseTextBuffer* buffer,
   buffer->Printf(")\n");
 }
 
-static void PrintSymbolicStackFrame(Zone* zone,
-                                    BaseTextBuffer* buffer,
-                                    const Function& function,
-                                    TokenPosition token_pos,
-                                    intptr_t frame_index) {
+// Returns the zone-allocated body of a symbolic stack frame line (everything
+// after the frame index).
+static const char* FormatSymbolicStackFrameBody(Zone* zone,
+                                                const Function& function,
+                                                TokenPosition token_pos) {
   ASSERT(!function.IsNull());
   const auto& script = Script::Handle(zone, function.script());
   const char* function_name = function.QualifiedUserVisibleNameCString();
@@ -24248,8 +24437,9 @@ static void PrintSymbolicStackFrame(Zone* zone,
     script.GetTokenLocation(token_pos.SourcePosition(), &line, &column);
   }
 
-  PrintSymbolicStackFrameIndex(buffer, frame_index);
-  PrintSymbolicStackFrameBody(buffer, function_name, url, line, column);
+  ZoneTextBuffer buffer(zone, 64);
+  PrintSymbolicStackFrameBody(&buffer, function_name, url, line, column);
+  return buffer.buffer();
 }
 
 const char* StackTrace::ToCString() const {
@@ -24265,6 +24455,16 @@ const char* StackTrace::ToCString() const {
   GrowableArray<TokenPosition> inlined_token_positions;
   ZoneTextBuffer buffer(zone, 1024);
 
+  // Expanding inlined frames and resolving source positions are the expensive
+  // parts of symbolization, and traces from deep recursion repeat the same
+  // return addresses many times, so the formatted frame bodies are memoized
+  // per pc for the duration of this call. The cache must not outlive the
+  // NoSafepointScope above: in JIT mode the collector can move Code objects,
+  // which would change the pcs.
+  DirectChainedHashMap<
+      RawPointerKeyValueTrait<void, ZoneGrowableArray<const char*>*>>
+      frame_bodies(zone);
+
 #if defined(DART_PRECOMPILED_RUNTIME)
   auto const isolate_instructions = reinterpret_cast<uword>(
       T->isolate_group()->source()->snapshot_instructions);
@@ -24375,21 +24575,29 @@ const char* StackTrace::ToCString() const {
           continue;
         }
 #endif
-        if (code.is_optimized() && stack_trace.expand_inlined()) {
-          code.GetInlinedFunctionsAtReturnAddress(pc_offset, &inlined_functions,
-                                                  &inlined_token_positions);
-          ASSERT(inlined_functions.length() >= 1);
-          for (intptr_t j = inlined_functions.length() - 1; j >= 0; j--) {
-            const auto& inlined = *inlined_functions[j];
-            auto const pos = inlined_token_positions[j];
-            if (FLAG_show_invisible_frames || function.is_visible()) {
-              PrintSymbolicStackFrame(zone, &buffer, inlined, pos, frame_index);
-              frame_index++;
+        auto* bodies = frame_bodies.LookupValue(reinterpret_cast<void*>(pc));
+        if (bodies == nullptr) {
+          bodies = new (zone) ZoneGrowableArray<const char*>(zone, 1);
+          if (code.is_optimized() && stack_trace.expand_inlined()) {
+            code.GetInlinedFunctionsAtReturnAddress(
+                pc_offset, &inlined_functions, &inlined_token_positions);
+            ASSERT(inlined_functions.length() >= 1);
+            for (intptr_t j = inlined_functions.length() - 1; j >= 0; j--) {
+              const auto& inlined = *inlined_functions[j];
+              auto const pos = inlined_token_positions[j];
+              if (FLAG_show_invisible_frames || function.is_visible()) {
+                bodies->Add(FormatSymbolicStackFrameBody(zone, inlined, pos));
+              }
             }
+          } else if (FLAG_show_invisible_frames || function.is_visible()) {
+            auto const pos = code.GetTokenIndexOfPC(pc);
+            bodies->Add(FormatSymbolicStackFrameBody(zone, function, pos));
           }
-        } else if (FLAG_show_invisible_frames || function.is_visible()) {
-          auto const pos = code.GetTokenIndexOfPC(pc);
-          PrintSymbolicStackFrame(zone, &buffer, function, pos, frame_index);
+          frame_bodies.Insert({reinterpret_cast<void*>(pc), bodies});
+        }
+        for (intptr_t j = 0; j < bodies->length(); j++) {
+          PrintSymbolicStackFrameIndex(&buffer, frame_index);
+          buffer.AddString(bodies->At(j));
           frame_index++;
         }
       }
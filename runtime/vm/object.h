@@ -1532,9 +1532,12 @@ class Class : public Object {
   // leaf method, ...).
   void RegisterCHACode(const Code& code);
 
-  void DisableCHAOptimizedCode(const Class& subclass);
+  // When deoptimize_frames is false, the caller must have already marked
+  // all optimized frames on the stack for lazy deoptimization.
+  void DisableCHAOptimizedCode(const Class& subclass,
+                               bool deoptimize_frames = true);
 
-  void DisableAllCHAOptimizedCode();
+  void DisableAllCHAOptimizedCode(bool deoptimize_frames = true);
 
   void DisableCHAImplementorUsers() { DisableAllCHAOptimizedCode(); }
 
@@ -2442,6 +2445,13 @@ class Function : public Object {
 
   bool FfiCSignatureContainsHandles() const;
 
+  // Can only be called on FFI trampolines.
+  // Leaf calls skip the runtime transition when calling into native code.
+  bool FfiIsLeaf() const;
+
+  // Can only be called on FFI trampolines.
+  void SetFfiIsLeaf(bool is_leaf) const;
+
   // Can only be called on FFI trampolines.
   // -1 for Dart -> native calls.
   int32_t FfiCallbackId() const;
@@ -3946,6 +3956,9 @@ class FfiTrampolineData : public Object {
   int32_t callback_id() const { return raw_ptr()->callback_id_; }
   void set_callback_id(int32_t value) const;
 
+  bool is_leaf() const { return raw_ptr()->is_leaf_; }
+  void set_is_leaf(bool value) const;
+
   static FfiTrampolineDataPtr New();
 
   FINAL_HEAP_OBJECT_IMPLEMENTATION(FfiTrampolineData, Object);
@@ -4318,8 +4331,10 @@ class Field : public Object {
   // Add the given code object to the list of dependent ones.
   void RegisterDependentCode(const Code& code) const;
 
-  // Deoptimize all dependent code objects.
-  void DeoptimizeDependentCode() const;
+  // Deoptimize all dependent code objects. When deoptimize_frames is false,
+  // the caller must have already marked all optimized frames on the stack
+  // for lazy deoptimization.
+  void DeoptimizeDependentCode(bool deoptimize_frames = true) const;
 
   // Used by background compiler to check consistency of field copy with its
   // original.
@@ -5431,8 +5446,11 @@ class Instructions : public Object {
     return memcmp(a->ptr(), b->ptr(), InstanceSize(Size(a))) == 0;
   }
 
-  uint32_t Hash() const {
-    return HashBytes(reinterpret_cast<const uint8_t*>(PayloadStart()), Size());
+  uint32_t Hash() const { return Hash(raw()); }
+
+  static uint32_t Hash(const InstructionsPtr instr) {
+    return HashBytes(reinterpret_cast<const uint8_t*>(PayloadStart(instr)),
+                     Size(instr));
   }
 
   CodeStatistics* stats() const;
@@ -8661,6 +8679,13 @@ class String : public Instance {
   uint16_t CharAt(intptr_t index) const { return CharAt(raw(), index); }
   static uint16_t CharAt(StringPtr str, intptr_t index);
 
+  // Returns the bitwise-or of the code units in [start, end) of a two-byte
+  // or external two-byte string, scanning a word at a time. Used to decide
+  // whether the result of an operation fits in a OneByteString.
+  static uint16_t CodeUnitLimit(const String& str,
+                                intptr_t start,
+                                intptr_t end);
+
   intptr_t CharSize() const;
 
   inline bool Equals(const String& str) const;
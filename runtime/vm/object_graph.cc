@@ -934,10 +934,9 @@ class Pass2Visitor : public ObjectVisitor,
       writer_->WriteUnsigned(kNoData);
     }
 
-    DoCount();
-    obj->ptr()->VisitPointersPrecise(isolate_, this);
-    DoWrite();
+    ASSERT(references_.length() == 0);
     obj->ptr()->VisitPointersPrecise(isolate_, this);
+    WriteReferences();
   }
 
   void ScrubAndWriteUtf8(StringPtr str) {
@@ -954,29 +953,22 @@ class Pass2Visitor : public ObjectVisitor,
 
   void set_discount_sizes(bool value) { discount_sizes_ = value; }
 
-  void DoCount() {
-    writing_ = false;
-    counted_ = 0;
-    written_ = 0;
-  }
-  void DoWrite() {
-    writing_ = true;
-    writer_->WriteUnsigned(counted_);
+  void VisitPointers(ObjectPtr* from, ObjectPtr* to) {
+    for (ObjectPtr* ptr = from; ptr <= to; ptr++) {
+      references_.Add(writer_->GetObjectId(*ptr));
+    }
   }
 
-  void VisitPointers(ObjectPtr* from, ObjectPtr* to) {
-    if (writing_) {
-      for (ObjectPtr* ptr = from; ptr <= to; ptr++) {
-        ObjectPtr target = *ptr;
-        written_++;
-        total_++;
-        writer_->WriteUnsigned(writer_->GetObjectId(target));
-      }
-    } else {
-      intptr_t count = to - from + 1;
-      ASSERT(count >= 0);
-      counted_ += count;
+  // The reference count must precede the reference ids in the stream, so the
+  // ids are gathered in a scratch buffer during visitation and copied out
+  // here. The buffer's capacity is retained across objects; its peak size is
+  // the slot count of the largest object in the heap.
+  void WriteReferences() {
+    writer_->WriteUnsigned(references_.length());
+    for (intptr_t i = 0; i < references_.length(); i++) {
+      writer_->WriteUnsigned(references_[i]);
     }
+    references_.Clear();
   }
 
   void VisitHandle(uword addr) {
@@ -1003,10 +995,7 @@ class Pass2Visitor : public ObjectVisitor,
   // descriptor), we can remove this dependency on the current isolate.
   Isolate* isolate_;
   HeapSnapshotWriter* const writer_;
-  bool writing_ = false;
-  intptr_t counted_ = 0;
-  intptr_t written_ = 0;
-  intptr_t total_ = 0;
+  MallocGrowableArray<intptr_t> references_;
   bool discount_sizes_ = false;
 
   DISALLOW_COPY_AND_ASSIGN(Pass2Visitor);
@@ -1161,12 +1150,9 @@ void HeapSnapshotWriter::Write() {
     WriteUnsigned(0);  // cid
     WriteUnsigned(0);  // shallowSize
     WriteUnsigned(kNoData);
-    visitor.DoCount();
-    isolate()->VisitObjectPointers(&visitor,
-                                   ValidationPolicy::kDontValidateFrames);
-    visitor.DoWrite();
     isolate()->VisitObjectPointers(&visitor,
                                    ValidationPolicy::kDontValidateFrames);
+    visitor.WriteReferences();
 
     // Heap objects.
     visitor.set_discount_sizes(true);
@@ -178,7 +178,7 @@ class ObjectPointerVisitor;
   RW(CompressedStackMaps, canonicalized_stack_map_entries)                     \
   RW(ObjectPool, global_object_pool)                                           \
   RW(Array, unique_dynamic_targets)                                            \
-  RW(GrowableObjectArray, megamorphic_cache_table)                             \
+  RW(Array, megamorphic_cache_table)                                           \
   RW(Code, build_method_extractor_code)                                        \
   RW(Code, dispatch_table_null_error_stub)                                     \
   RW(Code, late_initialization_error_stub_with_fpu_regs_stub)                  \
@@ -235,8 +235,9 @@ class ObjectPointerVisitor;
   RW(Code, slow_tts_stub)                                                      \
   RW(Array, dispatch_table_code_entries)                                       \
   RW(GrowableObjectArray, code_order_tables)                                   \
+  RW(GrowableObjectArray, startup_functions)                                   \
   RW(Array, obfuscation_map)                                                   \
-  RW(GrowableObjectArray, ffi_callback_functions)                              \
+  RW(Array, ffi_callback_functions)                                            \
   RW(Class, ffi_pointer_class)                                                 \
   RW(Class, ffi_native_type_class)                                             \
   RW(Class, ffi_struct_class)                                                  \
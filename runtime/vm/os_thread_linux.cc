@@ -457,6 +457,7 @@ Monitor::WaitResult Monitor::WaitMicros(int64_t micros) {
 #endif  // defined(DEBUG)
 
   Monitor::WaitResult retval = kNotified;
+  data_.waiters_++;
   if (micros == kNoTimeout) {
     // Wait forever.
     int result = pthread_cond_wait(data_.cond(), data_.mutex());
@@ -470,6 +471,7 @@ Monitor::WaitResult Monitor::WaitMicros(int64_t micros) {
       retval = kTimedOut;
     }
   }
+  data_.waiters_--;
 
 #if defined(DEBUG)
   // When running with assertions enabled we track the owner.
@@ -483,6 +485,11 @@ Monitor::WaitResult Monitor::WaitMicros(int64_t micros) {
 void Monitor::Notify() {
   // When running with assertions enabled we track the owner.
   ASSERT(IsOwnedByCurrentThread());
+  // Message-heavy isolates notify far more often than they wait, so skip the
+  // condition variable entirely when no thread can be woken.
+  if (data_.waiters_ == 0) {
+    return;
+  }
   int result = pthread_cond_signal(data_.cond());
   VALIDATE_PTHREAD_RESULT(result);
 }
@@ -490,6 +497,9 @@ void Monitor::Notify() {
 void Monitor::NotifyAll() {
   // When running with assertions enabled we track the owner.
   ASSERT(IsOwnedByCurrentThread());
+  if (data_.waiters_ == 0) {
+    return;
+  }
   int result = pthread_cond_broadcast(data_.cond());
   VALIDATE_PTHREAD_RESULT(result);
 }
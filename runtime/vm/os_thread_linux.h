@@ -64,6 +64,9 @@ class MonitorData {
 
   pthread_mutex_t mutex_;
   pthread_cond_t cond_;
+  // Number of threads blocked in Wait. Updated and read while the mutex is
+  // held, so notification can be skipped when there are no waiters.
+  intptr_t waiters_ = 0;
 
   friend class Monitor;
 
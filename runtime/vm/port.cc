@@ -17,7 +17,7 @@
 namespace dart {
 
 Mutex* PortMap::mutex_ = NULL;
-PortSet<PortMap::Entry>* PortMap::ports_ = NULL;
+PortMap::Shard* PortMap::shards_ = NULL;
 MessageHandler* PortMap::deleted_entry_ = reinterpret_cast<MessageHandler*>(1);
 Random* PortMap::prng_ = NULL;
 
@@ -38,11 +38,12 @@ const char* PortMap::PortStateString(PortState kind) {
 }
 
 Dart_Port PortMap::AllocatePort() {
+  ASSERT(mutex_->IsOwnedByCurrentThread());
   Dart_Port result;
 
   // Keep getting new values while we have an illegal port number or the port
   // number is already in use.
-  do {
+  while (true) {
     // Ensure port ids are representable in JavaScript for the benefit of
     // vm-service clients such as Observatory.
     const Dart_Port kMask1 = 0xFFFFFFFFFFFFF;
@@ -59,18 +60,26 @@ Dart_Port PortMap::AllocatePort() {
     }
 
     ASSERT(!static_cast<ObjectPtr>(static_cast<uword>(result))->IsWellFormed());
-  } while (ports_->Contains(result));
+
+    // All insertions are serialized by mutex_, which we hold, so this check
+    // remains valid until the caller inserts the port into its shard.
+    Shard* shard = ShardFor(result);
+    MutexLocker ml(&shard->mutex);
+    if (!shard->ports.Contains(result)) {
+      break;
+    }
+  }
 
   ASSERT(result != 0);
-  ASSERT(!ports_->Contains(result));
   return result;
 }
 
 void PortMap::SetPortState(Dart_Port port, PortState state) {
-  MutexLocker ml(mutex_);
+  Shard* shard = ShardFor(port);
+  MutexLocker ml(&shard->mutex);
 
-  auto it = ports_->TryLookup(port);
-  ASSERT(it != ports_->end());
+  auto it = shard->ports.TryLookup(port);
+  ASSERT(it != shard->ports.end());
 
   Entry& entry = *it;
   PortState old_state = entry.state;
@@ -109,7 +118,11 @@ Dart_Port PortMap::CreatePort(MessageHandler* handler) {
   entry.port = port;
   entry.handler = handler;
   entry.state = kNewPort;
-  ports_->Insert(entry);
+  {
+    Shard* shard = ShardFor(port);
+    MutexLocker shard_ml(&shard->mutex);
+    shard->ports.Insert(entry);
+  }
 
   if (FLAG_trace_isolates) {
     OS::PrintErr(
@@ -126,26 +139,30 @@ bool PortMap::ClosePort(Dart_Port port) {
   MessageHandler* handler = NULL;
   {
     MutexLocker ml(mutex_);
-    auto it = ports_->TryLookup(port);
-    if (it == ports_->end()) {
-      return false;
-    }
-    Entry entry = *it;
-    handler = entry.handler;
-    ASSERT(handler != nullptr);
+    Shard* shard = ShardFor(port);
+    {
+      MutexLocker shard_ml(&shard->mutex);
+      auto it = shard->ports.TryLookup(port);
+      if (it == shard->ports.end()) {
+        return false;
+      }
+      Entry entry = *it;
+      handler = entry.handler;
+      ASSERT(handler != nullptr);
 
 #if defined(DEBUG)
-    handler->CheckAccess();
+      handler->CheckAccess();
 #endif
 
-    if (entry.state == kLivePort) {
-      handler->decrement_live_ports();
-    }
+      if (entry.state == kLivePort) {
+        handler->decrement_live_ports();
+      }
 
-    // Delete the port entry before releasing the lock to avoid holding the lock
-    // while flushing the messages below.
-    it.Delete();
-    ports_->Rebalance();
+      // Delete the port entry before releasing the lock to avoid holding the
+      // lock while flushing the messages below.
+      it.Delete();
+      shard->ports.Rebalance();
+    }
 
     // The MessageHandler::ports_ is only accessed by [PortMap], it is guarded
     // by the [PortMap::mutex_] we already hold.
@@ -169,8 +186,10 @@ void PortMap::ClosePorts(MessageHandler* handler) {
     // by the [PortMap::mutex_] we already hold.
     for (auto isolate_it = handler->ports_.begin();
          isolate_it != handler->ports_.end(); ++isolate_it) {
-      auto it = ports_->TryLookup((*isolate_it).port);
-      ASSERT(it != ports_->end());
+      Shard* shard = ShardFor((*isolate_it).port);
+      MutexLocker shard_ml(&shard->mutex);
+      auto it = shard->ports.TryLookup((*isolate_it).port);
+      ASSERT(it != shard->ports.end());
       Entry entry = *it;
       ASSERT(entry.port == (*isolate_it).port);
       ASSERT(entry.handler == handler);
@@ -178,33 +197,49 @@ void PortMap::ClosePorts(MessageHandler* handler) {
         handler->decrement_live_ports();
       }
       it.Delete();
+      shard->ports.Rebalance();
       isolate_it.Delete();
     }
     ASSERT(handler->ports_.IsEmpty());
-    ports_->Rebalance();
+    handler->ports_.Rebalance();
   }
   handler->CloseAllPorts();
 }
 
 bool PortMap::PostMessage(std::unique_ptr<Message> message,
                           bool before_events) {
-  MutexLocker ml(mutex_);
-  auto it = ports_->TryLookup(message->dest_port());
-  if (it == ports_->end()) {
-    // Ownership of external data remains with the poster.
-    message->DropFinalizers();
-    return false;
+  Shard* shard = ShardFor(message->dest_port());
+  MessageHandler* direct_handler = nullptr;
+  {
+    MutexLocker ml(&shard->mutex);
+    auto it = shard->ports.TryLookup(message->dest_port());
+    if (it == shard->ports.end()) {
+      // Ownership of external data remains with the poster.
+      message->DropFinalizers();
+      return false;
+    }
+    MessageHandler* handler = (*it).handler;
+    ASSERT(handler != nullptr);
+    if (handler->DeliversDirectly(message.get()) &&
+        handler->BeginDirectDelivery()) {
+      // Handle the message outside the shard lock: the handler's callback
+      // may itself post messages whose destination hashes to this shard.
+      direct_handler = handler;
+    } else {
+      handler->PostMessage(std::move(message), before_events);
+      return true;
+    }
   }
-  MessageHandler* handler = (*it).handler;
-  ASSERT(handler != nullptr);
-  handler->PostMessage(std::move(message), before_events);
+  direct_handler->HandleMessage(std::move(message));
+  direct_handler->EndDirectDelivery();
   return true;
 }
 
 bool PortMap::IsLocalPort(Dart_Port id) {
-  MutexLocker ml(mutex_);
-  auto it = ports_->TryLookup(id);
-  if (it == ports_->end()) {
+  Shard* shard = ShardFor(id);
+  MutexLocker ml(&shard->mutex);
+  auto it = shard->ports.TryLookup(id);
+  if (it == shard->ports.end()) {
     // Port does not exist.
     return false;
   }
@@ -215,9 +250,10 @@ bool PortMap::IsLocalPort(Dart_Port id) {
 }
 
 bool PortMap::IsLivePort(Dart_Port id) {
-  MutexLocker ml(mutex_);
-  auto it = ports_->TryLookup(id);
-  if (it == ports_->end()) {
+  Shard* shard = ShardFor(id);
+  MutexLocker ml(&shard->mutex);
+  auto it = shard->ports.TryLookup(id);
+  if (it == shard->ports.end()) {
     // Port does not exist.
     return false;
   }
@@ -227,9 +263,10 @@ bool PortMap::IsLivePort(Dart_Port id) {
 }
 
 Isolate* PortMap::GetIsolate(Dart_Port id) {
-  MutexLocker ml(mutex_);
-  auto it = ports_->TryLookup(id);
-  if (it == ports_->end()) {
+  Shard* shard = ShardFor(id);
+  MutexLocker ml(&shard->mutex);
+  auto it = shard->ports.TryLookup(id);
+  if (it == shard->ports.end()) {
     // Port does not exist.
     return nullptr;
   }
@@ -240,10 +277,14 @@ Isolate* PortMap::GetIsolate(Dart_Port id) {
 
 bool PortMap::IsReceiverInThisIsolateGroup(Dart_Port receiver,
                                            IsolateGroup* group) {
-  MutexLocker ml(mutex_);
-  auto it = ports_->TryLookup(receiver);
-  if (it == ports_->end()) return false;
-  return (*it).handler->isolate()->group() == group;
+  Shard* shard = ShardFor(receiver);
+  MutexLocker ml(&shard->mutex);
+  auto it = shard->ports.TryLookup(receiver);
+  if (it == shard->ports.end()) return false;
+  Isolate* isolate = (*it).handler->isolate();
+  // Native ports are not owned by any isolate.
+  if (isolate == nullptr) return false;
+  return isolate->group() == group;
 }
 
 void PortMap::Init() {
@@ -255,30 +296,33 @@ void PortMap::Init() {
   if (prng_ == nullptr) {
     prng_ = new Random();
   }
-  if (ports_ == nullptr) {
-    ports_ = new PortSet<Entry>();
+  if (shards_ == nullptr) {
+    shards_ = new Shard[kShardCount];
   }
 }
 
 void PortMap::Cleanup() {
-  ASSERT(ports_ != nullptr);
+  ASSERT(shards_ != nullptr);
   ASSERT(prng_ != NULL);
-  for (auto it = ports_->begin(); it != ports_->end(); ++it) {
-    const auto& entry = *it;
-    ASSERT(entry.handler != nullptr);
-    if (entry.state == kLivePort) {
-      entry.handler->decrement_live_ports();
+  for (intptr_t i = 0; i < kShardCount; i++) {
+    Shard* shard = &shards_[i];
+    for (auto it = shard->ports.begin(); it != shard->ports.end(); ++it) {
+      const auto& entry = *it;
+      ASSERT(entry.handler != nullptr);
+      if (entry.state == kLivePort) {
+        entry.handler->decrement_live_ports();
+      }
+      delete entry.handler;
+      it.Delete();
     }
-    delete entry.handler;
-    it.Delete();
+    shard->ports.Rebalance();
   }
-  ports_->Rebalance();
 
   delete prng_;
   prng_ = NULL;
   // TODO(bkonyi): find out why deleting map_ sometimes causes crashes.
-  // delete ports_;
-  // ports_ = nullptr;
+  // delete shards_;
+  // shards_ = nullptr;
 }
 
 void PortMap::PrintPortsForMessageHandler(MessageHandler* handler,
@@ -289,15 +333,17 @@ void PortMap::PrintPortsForMessageHandler(MessageHandler* handler,
   Object& msg_handler = Object::Handle();
   {
     JSONArray ports(&jsobj, "ports");
-    SafepointMutexLocker ml(mutex_);
-    for (auto& entry : *ports_) {
-      if (entry.handler == handler) {
-        if (entry.state == kLivePort) {
-          JSONObject port(&ports);
-          port.AddProperty("type", "_Port");
-          port.AddPropertyF("name", "Isolate Port (%" Pd64 ")", entry.port);
-          msg_handler = DartLibraryCalls::LookupHandler(entry.port);
-          port.AddProperty("handler", msg_handler);
+    for (intptr_t i = 0; i < kShardCount; i++) {
+      SafepointMutexLocker ml(&shards_[i].mutex);
+      for (auto& entry : shards_[i].ports) {
+        if (entry.handler == handler) {
+          if (entry.state == kLivePort) {
+            JSONObject port(&ports);
+            port.AddProperty("type", "_Port");
+            port.AddPropertyF("name", "Isolate Port (%" Pd64 ")", entry.port);
+            msg_handler = DartLibraryCalls::LookupHandler(entry.port);
+            port.AddProperty("handler", msg_handler);
+          }
         }
       }
     }
@@ -306,14 +352,16 @@ void PortMap::PrintPortsForMessageHandler(MessageHandler* handler,
 }
 
 void PortMap::DebugDumpForMessageHandler(MessageHandler* handler) {
-  SafepointMutexLocker ml(mutex_);
   Object& msg_handler = Object::Handle();
-  for (auto& entry : *ports_) {
-    if (entry.handler == handler) {
-      if (entry.state == kLivePort) {
-        OS::PrintErr("Live Port = %" Pd64 "\n", entry.port);
-        msg_handler = DartLibraryCalls::LookupHandler(entry.port);
-        OS::PrintErr("Handler = %s\n", msg_handler.ToCString());
+  for (intptr_t i = 0; i < kShardCount; i++) {
+    SafepointMutexLocker ml(&shards_[i].mutex);
+    for (auto& entry : shards_[i].ports) {
+      if (entry.handler == handler) {
+        if (entry.state == kLivePort) {
+          OS::PrintErr("Live Port = %" Pd64 "\n", entry.port);
+          msg_handler = DartLibraryCalls::LookupHandler(entry.port);
+          OS::PrintErr("Handler = %s\n", msg_handler.ToCString());
+        }
       }
     }
   }
@@ -11,6 +11,7 @@
 #include "vm/allocation.h"
 #include "vm/globals.h"
 #include "vm/json_stream.h"
+#include "vm/os_thread.h"
 #include "vm/port_set.h"
 #include "vm/random.h"
 
@@ -84,15 +85,31 @@ class PortMap : public AllStatic {
     PortState state;
   };
 
+  // The port map is sharded by port id so that posting a message or looking
+  // up a port only contends on the owning shard's lock instead of a single
+  // process-wide lock.
+  struct Shard {
+    Mutex mutex;
+    PortSet<Entry> ports;
+  };
+
+  static constexpr intptr_t kShardCount = 16;  // Must be a power of two.
+
+  static Shard* ShardFor(Dart_Port port) {
+    // The low two bits of a port id are always set; shard on the bits above.
+    return &shards_[(static_cast<uint64_t>(port) >> 2) & (kShardCount - 1)];
+  }
+
   static const char* PortStateString(PortState state);
 
   // Allocate a new unique port.
   static Dart_Port AllocatePort();
 
-  // Lock protecting access to the port map.
+  // Serializes port allocation and access to the per-handler port lists.
+  // Taken before any shard lock.
   static Mutex* mutex_;
 
-  static PortSet<Entry>* ports_;
+  static Shard* shards_;
   static MessageHandler* deleted_entry_;
 
   static Random* prng_;
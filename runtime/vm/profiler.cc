@@ -50,6 +50,13 @@ DEFINE_FLAG(bool,
             false,
             "Collect native stack traces when tracing Dart allocations.");
 
+DEFINE_FLAG(int,
+            profile_allocation_interval,
+            0,
+            "Sample an allocation approximately every N bytes allocated "
+            "through the runtime, without per-class allocation tracing "
+            "enabled. 0 disables interval sampling.");
+
 DEFINE_FLAG(
     int,
     sample_buffer_duration,
@@ -614,6 +614,14 @@ class CodeLookupTable : public ZoneAllocated {
 };
 
 // Ring buffer of Samples that is (usually) shared by many isolates.
+//
+// The buffer is a fixed ring, so a session that outlives it loses the oldest
+// samples. Continuous profiling is expected to poll getCpuSamples with a
+// time window and then clearCpuSamples, so each sample is transferred once;
+// --sample_buffer_duration sizes the ring to cover the polling interval.
+// Aggregating on the VM side instead would have to happen at sampling depth
+// (the signal handler only records pcs) and would discard the per-frame
+// inlining and tag context the service reconstructs at request time.
 class SampleBuffer {
  public:
   // Up to 1 minute @ 1000Hz, less if samples are deep.
@@ -25,6 +25,84 @@ DECLARE_FLAG(bool, profile_vm);
 
 #ifndef PRODUCT
 
+// Caches the result of resolving a native pc against the OS across profile
+// builds. A profile is built from scratch for every service request, but
+// continuous profiling clients poll getCpuSamples once per time window, so
+// without a cache every poll repeats the dladdr and demangling work for each
+// distinct native pc in the sample buffer. Resolution results are stable for
+// the lifetime of the process (the VM never unloads shared objects), and the
+// cache is bounded by the number of distinct native pcs that were ever
+// sampled. Failed lookups are cached as well: pcs in anonymous mappings fail
+// resolution on every profile build otherwise.
+class NativeSymbolCache : public AllStatic {
+ public:
+  // Returns true if |pc| has been resolved before. On a hit, |*start| is set
+  // to the symbol's start address and |*name| to a malloc'd copy of its name
+  // that the caller must free, or NULL if resolution had failed.
+  static bool Lookup(uword pc, uword* start, char** name) {
+    MutexLocker ml(mutex_);
+    Entry* entry = map_->LookupValue(pc);
+    if (entry == NULL) {
+      return false;
+    }
+    *start = entry->start;
+    *name = (entry->name == NULL) ? NULL : strdup(entry->name);
+    return true;
+  }
+
+  // Records the resolution result for |pc|. Makes a copy of |name|, which may
+  // be NULL if resolution failed.
+  static void Insert(uword pc, uword start, const char* name) {
+    Entry* entry = new Entry();
+    entry->start = start;
+    entry->name = (name == NULL) ? NULL : strdup(name);
+    MutexLocker ml(mutex_);
+    if (map_->LookupValue(pc) != NULL) {
+      // Lost a race with another profile build resolving the same pc.
+      free(entry->name);
+      delete entry;
+      return;
+    }
+    map_->Insert({pc, entry});
+  }
+
+ private:
+  struct Entry {
+    uword start;
+    char* name;
+  };
+
+  // Key/value trait keyed by pc. The default pair has a zero key; pc 0 is
+  // never sampled.
+  class EntryKeyValueTrait : public AllStatic {
+   public:
+    typedef uword Key;
+    typedef Entry* Value;
+
+    struct Pair {
+      Key key;
+      Value value;
+      Pair() : key(0), value(NULL) {}
+      Pair(const Key key, const Value& value) : key(key), value(value) {}
+      Pair(const Pair& other) : key(other.key), value(other.value) {}
+      Pair& operator=(const Pair&) = default;
+    };
+
+    static Key KeyOf(Pair kv) { return kv.key; }
+    static Value ValueOf(Pair kv) { return kv.value; }
+    static intptr_t Hashcode(Key key) { return static_cast<intptr_t>(key); }
+    static bool IsKeyEqual(Pair kv, Key key) { return kv.key == key; }
+  };
+
+  static Mutex* mutex_;
+  static MallocDirectChainedHashMap<EntryKeyValueTrait>* map_;
+};
+
+Mutex* NativeSymbolCache::mutex_ = new Mutex();
+MallocDirectChainedHashMap<NativeSymbolCache::EntryKeyValueTrait>*
+    NativeSymbolCache::map_ =
+        new MallocDirectChainedHashMap<NativeSymbolCache::EntryKeyValueTrait>();
+
 class DeoptimizedCodeSet : public ZoneAllocated {
  public:
   explicit DeoptimizedCodeSet(Isolate* isolate)
@@ -891,26 +969,23 @@ bool ProfileCodeInlinedFunctionsCache::FindInCache(
     GrowableArray<const Function*>** inlined_functions,
     GrowableArray<TokenPosition>** inlined_token_positions,
     TokenPosition* token_position) {
-  // Simple linear scan.
-  for (intptr_t i = 0; i < kCacheSize; i++) {
-    intptr_t index = (last_hit_ + i) % kCacheSize;
-    if ((cache_[index].pc == pc) && (cache_[index].offset == offset)) {
-      // Hit.
-      if (cache_[index].inlined_functions.length() == 0) {
-        *inlined_functions = NULL;
-        *inlined_token_positions = NULL;
-      } else {
-        *inlined_functions = &cache_[index].inlined_functions;
-        *inlined_token_positions = &cache_[index].inlined_token_positions;
-      }
-      *token_position = cache_[index].token_position;
-      cache_hit_++;
-      last_hit_ = index;
-      return true;
-    }
+  CacheEntry probe(pc, offset);
+  CacheEntry* entry = cache_.LookupValue(&probe);
+  if (entry == NULL) {
+    cache_miss_++;
+    return false;
   }
-  cache_miss_++;
-  return false;
+  // Hit.
+  if (entry->inlined_functions.length() == 0) {
+    *inlined_functions = NULL;
+    *inlined_token_positions = NULL;
+  } else {
+    *inlined_functions = &entry->inlined_functions;
+    *inlined_token_positions = &entry->inlined_token_positions;
+  }
+  *token_position = entry->token_position;
+  cache_hit_++;
+  return true;
 }
 
 // Add to cache and fill in outputs.
@@ -924,10 +999,8 @@ void ProfileCodeInlinedFunctionsCache::Add(
     GrowableArray<TokenPosition>** inlined_token_positions,
     TokenPosition* token_position) {
   const intptr_t offset = OffsetForPC(pc, code, sample, frame_index);
-  CacheEntry* cache_entry = &cache_[NextFreeIndex()];
-  cache_entry->Reset();
-  cache_entry->pc = pc;
-  cache_entry->offset = offset;
+  CacheEntry* cache_entry = new CacheEntry(pc, offset);
+  cache_.Insert(cache_entry);
   code.GetInlinedFunctionsAtInstruction(
       offset, &(cache_entry->inlined_functions),
       &(cache_entry->inlined_token_positions));
@@ -1416,12 +1489,15 @@ class ProfileBuilder : public ValueObject {
       return profile_code;
     }
 
-    // We haven't seen this pc yet.
-
-    // Check NativeSymbolResolver for pc.
+    // We haven't seen this pc yet in this profile. Consult the process-wide
+    // cache before asking the OS, so repeated profile builds only pay for
+    // symbol resolution the first time a pc is seen.
     uword native_start = 0;
-    char* native_name =
-        NativeSymbolResolver::LookupSymbolName(pc, &native_start);
+    char* native_name = NULL;
+    if (!NativeSymbolCache::Lookup(pc, &native_start, &native_name)) {
+      native_name = NativeSymbolResolver::LookupSymbolName(pc, &native_start);
+      NativeSymbolCache::Insert(pc, native_start, native_name);
+    }
     if (native_name == NULL) {
       // Failed to find a native symbol for pc.
       native_start = pc;
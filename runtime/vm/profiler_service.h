@@ -10,6 +10,7 @@
 #include "vm/code_observers.h"
 #include "vm/globals.h"
 #include "vm/growable_array.h"
+#include "vm/hash_map.h"
 #include "vm/object.h"
 #include "vm/profiler.h"
 #include "vm/tags.h"
@@ -53,10 +54,7 @@ class ProfileFunctionSourcePosition {
 
 class ProfileCodeInlinedFunctionsCache : public ZoneAllocated {
  public:
-  ProfileCodeInlinedFunctionsCache() : cache_cursor_(0), last_hit_(0) {
-    for (intptr_t i = 0; i < kCacheSize; i++) {
-      cache_[i].Reset();
-    }
+  ProfileCodeInlinedFunctionsCache() {
     cache_hit_ = 0;
     cache_miss_ = 0;
   }
@@ -95,22 +93,12 @@ class ProfileCodeInlinedFunctionsCache : public ZoneAllocated {
            GrowableArray<TokenPosition>** inlined_token_positions,
            TokenPosition* token_position);
 
-  intptr_t NextFreeIndex() {
-    cache_cursor_ = (cache_cursor_ + 1) % kCacheSize;
-    return cache_cursor_;
-  }
-
   intptr_t OffsetForPC(uword pc,
                        const Code& code,
                        ProcessedSample* sample,
                        intptr_t frame_index);
-  struct CacheEntry {
-    void Reset() {
-      pc = 0;
-      offset = 0;
-      inlined_functions.Clear();
-      inlined_token_positions.Clear();
-    }
+  struct CacheEntry : public ZoneAllocated {
+    CacheEntry(uword pc, intptr_t offset) : pc(pc), offset(offset) {}
     uword pc;
     intptr_t offset;
     GrowableArray<const Function*> inlined_functions;
@@ -118,10 +106,28 @@ class ProfileCodeInlinedFunctionsCache : public ZoneAllocated {
     TokenPosition token_position;
   };
 
-  static const intptr_t kCacheSize = 128;
-  intptr_t cache_cursor_;
-  intptr_t last_hit_;
-  CacheEntry cache_[kCacheSize];
+  class CacheEntryKeyValueTrait {
+   public:
+    typedef CacheEntry* Value;
+    typedef CacheEntry* Key;
+    typedef CacheEntry* Pair;
+
+    static Key KeyOf(Pair kv) { return kv; }
+    static Value ValueOf(Pair kv) { return kv; }
+    static inline intptr_t Hashcode(Key key) {
+      return static_cast<intptr_t>(key->pc) ^ key->offset;
+    }
+    static inline bool IsKeyEqual(Pair pair, Key key) {
+      return (pair->pc == key->pc) && (pair->offset == key->offset);
+    }
+  };
+
+  // Decoding a code source map is a linear walk over its byte stream, so
+  // symbolizing a profile with a bounded cache re-decodes the same maps over
+  // and over. Entries live as long as the profile being built, and the
+  // number of distinct pcs is bounded by the sampled code, so the cache is
+  // simply unbounded.
+  DirectChainedHashMap<CacheEntryKeyValueTrait> cache_;
   intptr_t cache_miss_;
   intptr_t cache_hit_;
 };
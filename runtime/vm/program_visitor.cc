@@ -4,9 +4,12 @@
 
 #include "vm/program_visitor.h"
 
+#include "vm/canonical_tables.h"
 #include "vm/code_patcher.h"
 #include "vm/deopt_instructions.h"
 #include "vm/hash_map.h"
+#include "vm/hash_table.h"
+#include "vm/megamorphic_cache_table.h"
 #include "vm/object.h"
 #include "vm/object_store.h"
 #include "vm/symbols.h"
@@ -263,13 +266,16 @@ void ProgramVisitor::WalkProgram(Zone* zone,
     }
     // TODO(dartbug.com/43049): Use a more general solution and remove manual
     // tracking through object_store->ffi_callback_functions.
-    const auto& ffi_callback_entries = GrowableObjectArray::Handle(
-        zone, object_store->ffi_callback_functions());
+    const auto& ffi_callback_entries =
+        Array::Handle(zone, object_store->ffi_callback_functions());
     if (!ffi_callback_entries.IsNull()) {
-      for (intptr_t i = 0; i < ffi_callback_entries.Length(); i++) {
-        function ^= ffi_callback_entries.At(i);
+      FfiCallbackFunctionSet set(zone, ffi_callback_entries.raw());
+      FfiCallbackFunctionSet::Iterator it(&set);
+      while (it.MoveNext()) {
+        function ^= set.GetKey(it.Current());
         walker.AddToWorklist(function);
       }
+      set.Release();
     }
   }
 
@@ -430,9 +436,10 @@ DECLARE_FLAG(charp, trace_precompiler_to);
 DECLARE_FLAG(charp, write_v8_snapshot_profile_to);
 
 void ProgramVisitor::ShareMegamorphicBuckets(Zone* zone, Isolate* isolate) {
-  const GrowableObjectArray& table = GrowableObjectArray::Handle(
-      zone, isolate->object_store()->megamorphic_cache_table());
-  if (table.IsNull()) return;
+  const Array& backing =
+      Array::Handle(zone, isolate->object_store()->megamorphic_cache_table());
+  if (backing.IsNull()) return;
+  MegamorphicCacheSet table(zone, backing.raw());
   MegamorphicCache& cache = MegamorphicCache::Handle(zone);
 
   const intptr_t capacity = 1;
@@ -441,12 +448,14 @@ void ProgramVisitor::ShareMegamorphicBuckets(Zone* zone, Isolate* isolate) {
   const Function& handler = Function::Handle(zone);
   MegamorphicCache::SetEntry(buckets, 0, Object::smi_illegal_cid(), handler);
 
-  for (intptr_t i = 0; i < table.Length(); i++) {
-    cache ^= table.At(i);
+  MegamorphicCacheSet::Iterator it(&table);
+  while (it.MoveNext()) {
+    cache ^= table.GetKey(it.Current());
     cache.set_buckets(buckets);
     cache.set_mask(capacity - 1);
     cache.set_filled_entry_count(0);
   }
+  ASSERT(table.Release().raw() == backing.raw());
 }
 
 class StackMapEntry : public ZoneAllocated {
@@ -1135,7 +1144,18 @@ class CodeKeyValueTrait {
 
   static Value ValueOf(Pair kv) { return kv; }
 
-  static inline intptr_t Hashcode(Key key) { return key->Size(); }
+  static inline intptr_t Hashcode(Key key) {
+    // Getter, setter and forwarder bodies are frequently the same size, so
+    // hashing only the size collapses the hash map into a few long chains
+    // and makes deduplication quadratic in the number of such functions.
+    // Hash the instruction bytes instead. The metadata compared in
+    // IsKeyEqual is left out of the hash, since object addresses are not
+    // stable across GC.
+    uint32_t hash = Instructions::Hash(key->instructions());
+    hash = CombineHashes(hash,
+                         static_cast<uint32_t>(key->UncheckedEntryPointOffset()));
+    return FinalizeHash(hash, 30);
+  }
 
   static inline bool IsKeyEqual(Pair pair, Key key) {
     // In AOT, disabled code objects should not be considered for deduplication.
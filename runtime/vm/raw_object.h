@@ -1166,6 +1166,9 @@ class FfiTrampolineDataLayout : public ObjectLayout {
   // Will be 0 for non-callbacks. Check 'callback_target_' to determine if this
   // is a callback or not.
   uint32_t callback_id_;
+
+  // Whether this is a leaf call - i.e. one that doesn't call back into Dart.
+  bool is_leaf_;
 };
 
 class FieldLayout : public ObjectLayout {
@@ -2602,6 +2605,7 @@ class GrowableObjectArrayLayout : public InstanceLayout {
 
   friend class SnapshotReader;
   friend class ReversePc;
+  friend class CodeSerializationCluster;
 };
 
 class LinkedHashMapLayout : public InstanceLayout {
@@ -15,11 +15,15 @@
 
 namespace dart {
 
-// TODO(dartbug.com/34796): enable or remove this optimization.
+// Typed data at least this large is carried out of line in the message: the
+// bytes are copied once into a malloced buffer which the receiver adopts as
+// external typed data, instead of being written into the snapshot and copied
+// again into the receiving heap. Small arrays stay inline, where the copy is
+// cheaper than an external allocation plus finalizer.
 DEFINE_FLAG(
     uint64_t,
     externalize_typed_data_threshold,
-    kMaxUint64,
+    64 * KB,
     "Convert TypedData to ExternalTypedData when sending through a message"
     " port after it exceeds certain size in bytes.");
 
@@ -30,7 +30,11 @@ class BytecodeRegExpMacroAssembler : public RegExpMacroAssembler {
 
   // The byte-code interpreter checks on each push anyway.
   virtual intptr_t stack_limit_slack() { return 1; }
-  virtual bool CanReadUnaligned() { return false; }
+  // The interpreter assembles multi-character loads from individual
+  // character reads (see BC_LOAD_{2,4}_CURRENT_CHARS), so it never performs
+  // an unaligned memory access. Reporting true here lets the compiler emit
+  // multi-character quick checks for the interpreted path as well.
+  virtual bool CanReadUnaligned() { return true; }
   virtual void BindBlock(BlockLabel* label);
   virtual void AdvanceCurrentPosition(intptr_t by);  // Signed cp change.
   virtual void PopCurrentPosition();
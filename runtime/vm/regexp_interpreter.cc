@@ -19,6 +19,11 @@
 namespace dart {
 
 DEFINE_FLAG(bool, trace_regexp_bytecodes, false, "trace_regexp_bytecodes");
+DEFINE_FLAG(int,
+            regexp_backtrack_limit,
+            0,
+            "Fail an interpreted regexp match after this many backtracks, "
+            "bounding the runtime of pathological patterns (0 = unlimited).");
 
 typedef unibrow::Mapping<unibrow::Ecma262Canonicalize> Canonicalize;
 
@@ -184,6 +189,7 @@ static IrregexpInterpreter::IrregexpResult RawMatch(const uint8_t* code_base,
   intptr_t* backtrack_stack_base = backtrack_stack.data();
   intptr_t* backtrack_sp = backtrack_stack_base;
   intptr_t backtrack_stack_space = backtrack_stack.max_size();
+  intptr_t backtrack_count = 0;
 
   // TODO(zerny): Optimize as single instance. V8 has this as an
   // isolate member.
@@ -258,6 +264,13 @@ static IrregexpInterpreter::IrregexpResult RawMatch(const uint8_t* code_base,
       pc += BC_POP_CP_LENGTH;
       break;
       BYTECODE(POP_BT)
+      if (FLAG_regexp_backtrack_limit > 0 &&
+          ++backtrack_count > FLAG_regexp_backtrack_limit) {
+        // Pathological backtracking: give up rather than run for an
+        // effectively unbounded amount of time. The caller turns this into
+        // a catchable exception.
+        return IrregexpInterpreter::RE_EXCEPTION;
+      }
       backtrack_stack_space++;
       --backtrack_sp;
       pc = code_base + *backtrack_sp;
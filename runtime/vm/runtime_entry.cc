@@ -94,10 +94,28 @@ DEFINE_FLAG(bool,
             false,
             "Print additional details about stack overflow.");
 
+DEFINE_FLAG(bool,
+            print_runtime_entry_counters,
+            false,
+            "Print runtime entry invocation counters on VM shutdown.");
+
 DECLARE_FLAG(int, reload_every);
 DECLARE_FLAG(bool, reload_every_optimized);
 DECLARE_FLAG(bool, reload_every_back_off);
 
+const RuntimeEntry* RuntimeEntry::list_head_ = nullptr;
+
+void RuntimeEntry::PrintInvocationCounters() {
+  OS::PrintErr("Runtime entry invocation counters:\n");
+  for (const RuntimeEntry* entry = list_head_; entry != nullptr;
+       entry = entry->next_) {
+    const int64_t count = entry->invocation_count();
+    if (count != 0) {
+      OS::PrintErr("  %-40s %" Pd64 "\n", entry->name(), count);
+    }
+  }
+}
+
 #if defined(TESTING) || defined(DEBUG)
 void VerifyOnTransition() {
   Thread* thread = Thread::Current();
@@ -1109,6 +1127,18 @@ FunctionPtr InlineCacheMissHelper(const Class& receiver_class,
   return result.raw();
 }
 
+// Rewrites an unoptimized instance call site to a faster dispatch state when
+// the recorded receivers allow it:
+//
+//  - exactly one receiver class: the site is patched to call the target's
+//    monomorphic entry directly, which checks the receiver's class and jumps
+//    back to the IC miss path on mismatch;
+//  - more classes than --max_polymorphic_checks: the site is patched to the
+//    megamorphic cache stub.
+//
+// Sites in between stay on the IC stub. Either patched state falls back here
+// on a miss, so a site that turns out not to be monomorphic for the process
+// lifetime degrades gracefully instead of deoptimizing.
 static void TrySwitchInstanceCall(const ICData& ic_data,
                                   const Function& target_function) {
 #if !defined(DART_PRECOMPILED_RUNTIME)
@@ -1511,6 +1541,19 @@ static UnlinkedCallPtr LoadUnlinkedCall(Zone* zone,
 
 #endif  // defined(DART_PRECOMPILED_RUNTIME)
 
+// Handles a miss of a switchable instance call site by transitioning the site
+// to a faster dispatch state where possible. From the initial UnlinkedCall
+// state a site moves to one of:
+//
+//  - Monomorphic: the data slot next to the call holds the expected receiver
+//    cid and the call targets the callee's class-checking monomorphic entry
+//    directly (in AOT bare mode, MonomorphicSmiableCheck stands in when the
+//    entry cannot be addressed through the data slot);
+//  - SingleTarget (AOT): one target over a contiguous receiver cid range;
+//  - ICData, and past --max_polymorphic_checks, the megamorphic cache.
+//
+// Each patched state calls back here on a mismatch, so sites degrade from
+// direct dispatch to the more general states as new receivers appear.
 class SwitchableCallHandler {
  public:
   SwitchableCallHandler(Thread* thread,
@@ -2469,6 +2512,22 @@ static void HandleOSRRequest(Thread* thread) {
     uword optimized_entry = code.EntryPoint();
     frame->set_pc(optimized_entry);
     frame->set_pc_marker(code.raw());
+
+    // The OSR code only serves the activation on the stack; the function
+    // itself still runs unoptimized when called again. The tripped back-edge
+    // counter is strong evidence of a hot loop, so queue the regular
+    // optimizing compile ahead of ordinary counter-triggered work instead of
+    // waiting for the entry counter to climb past the threshold once more.
+    if (FLAG_background_compilation && !function.HasOptimizedCode() &&
+        function.is_background_optimizable() &&
+        !BackgroundCompiler::IsDisabled(isolate,
+                                        /* optimizing_compiler = */ true)) {
+      BackgroundCompiler::Start(isolate);
+      isolate->optimizing_background_compiler()->Compile(
+          function,
+          /*minimum_priority=*/2 * FLAG_optimization_counter_threshold);
+      function.SetUsageCounter(INT32_MIN);
+    }
   }
 }
 #endif  // !defined(DART_PRECOMPILED_RUNTIME)
@@ -2589,12 +2648,14 @@ DEFINE_RUNTIME_ENTRY(OptimizeInvokedFunction, 1) {
           function.is_background_optimizable()) {
         // Ensure background compiler is running, if not start it.
         BackgroundCompiler::Start(isolate);
+        // Enqueue while the usage counter still holds the accumulated count:
+        // the background compilation queue uses it to compile the hottest
+        // functions first. Note that the queue rejects duplicate entries.
+        isolate->optimizing_background_compiler()->Compile(function);
         // Reduce the chance of triggering a compilation while the function is
         // being compiled in the background. INT32_MIN should ensure that it
         // takes long time to trigger a compilation.
-        // Note that the background compilation queue rejects duplicate entries.
         function.SetUsageCounter(INT32_MIN);
-        isolate->optimizing_background_compiler()->Compile(function);
         // Continue in the same code.
         arguments.SetReturn(function);
         return;
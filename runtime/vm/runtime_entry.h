@@ -5,6 +5,7 @@
 #ifndef RUNTIME_VM_RUNTIME_ENTRY_H_
 #define RUNTIME_VM_RUNTIME_ENTRY_H_
 
+#include "platform/atomic.h"
 #include "vm/allocation.h"
 #if !defined(DART_PRECOMPILED_RUNTIME)
 #include "vm/compiler/runtime_api.h"
@@ -44,6 +45,10 @@ class RuntimeEntry : public BaseRuntimeEntry {
         argument_count_(argument_count),
         is_leaf_(is_leaf),
         is_float_(is_float) {
+    // Entries are global objects, so registration happens during static
+    // initialization and needs no locking.
+    next_ = list_head_;
+    list_head_ = this;
   }
 
   const char* name() const { return name_; }
@@ -53,6 +58,15 @@ class RuntimeEntry : public BaseRuntimeEntry {
   bool is_float() const { return is_float_; }
   uword GetEntryPoint() const;
 
+  // Always-on invocation counting. Runtime entries are slow paths by
+  // definition, so a relaxed atomic increment is noise compared to the
+  // transition they sit on; the counters tell us which slow paths actually
+  // fire in production. Dumped by --print_runtime_entry_counters.
+  void AddInvocation() const { invocation_count_.fetch_add(1); }
+  int64_t invocation_count() const { return invocation_count_.load(); }
+
+  static void PrintInvocationCounters();
+
   // Generate code to call the runtime entry.
   NOT_IN_PRECOMPILED(void Call(compiler::Assembler* assembler,
                                intptr_t argument_count) const);
@@ -68,6 +82,10 @@ class RuntimeEntry : public BaseRuntimeEntry {
   const intptr_t argument_count_;
   const bool is_leaf_;
   const bool is_float_;
+  mutable RelaxedAtomic<int64_t> invocation_count_ = 0;
+  const RuntimeEntry* next_ = nullptr;
+
+  static const RuntimeEntry* list_head_;
 
   DISALLOW_COPY_AND_ASSIGN(RuntimeEntry);
 };
@@ -106,6 +124,7 @@ class RuntimeEntry : public BaseRuntimeEntry {
     MSAN_UNPOISON(&arguments, sizeof(arguments));                              \
     ASSERT(arguments.ArgCount() == argument_count);                            \
     TRACE_RUNTIME_CALL("%s", "" #name);                                        \
+    k##name##RuntimeEntry.AddInvocation();                                     \
     {                                                                          \
       Thread* thread = arguments.thread();                                     \
       ASSERT(thread == Thread::Current());                                     \
@@ -131,6 +150,7 @@ class RuntimeEntry : public BaseRuntimeEntry {
       argument_count, true, false);                                            \
   type DLRT_##name(__VA_ARGS__) {                                              \
     CHECK_STACK_ALIGNMENT;                                                     \
+    k##name##RuntimeEntry.AddInvocation();                                     \
     NoSafepointScope no_safepoint_scope;
 
 #define END_LEAF_RUNTIME_ENTRY }
@@ -3680,6 +3680,21 @@ static bool GetIsolateMetric(Thread* thread, JSONStream* js) {
   return HandleDartMetric(thread, js, id);
 }
 
+static const MethodParameter* get_compilation_ledger_params[] = {
+    RUNNABLE_ISOLATE_PARAMETER,
+    NULL,
+};
+
+static bool GetCompilationLedger(Thread* thread, JSONStream* js) {
+  if (CheckCompilerDisabled(thread, js)) {
+    return true;
+  }
+#if !defined(DART_PRECOMPILED_RUNTIME)
+  thread->isolate()->compile_ledger()->PrintJSON(js);
+#endif
+  return true;
+}
+
 static const MethodParameter* get_vm_metric_list_params[] = {
     NO_ISOLATE_PARAMETER,
     NULL,
@@ -4232,6 +4247,16 @@ static intptr_t GetProcessMemoryUsageHelper(JSONStream* js) {
       JSONArray(&semi, "children");
     }
 
+    {
+      JSONObject old(&vm_children);
+      old.AddProperty("name", "OldPage Cache");
+      old.AddProperty("description", "Cached heap regions");
+      intptr_t size = OldPage::CachedSize();
+      vm_size += size;
+      old.AddProperty64("size", size);
+      JSONArray(&old, "children");
+    }
+
     IsolateGroup::ForEach(
         [&vm_children, &vm_size](IsolateGroup* isolate_group) {
           // Note: new_space()->CapacityInWords() includes memory that hasn't
@@ -4570,9 +4595,25 @@ static const MethodParameter* get_class_list_params[] = {
 };
 
 static bool GetClassList(Thread* thread, JSONStream* js) {
-  ClassTable* table = thread->isolate()->class_table();
-  JSONObject jsobj(js);
-  table->PrintToJSONObject(&jsobj);
+  Isolate* isolate = thread->isolate();
+  ClassTable* table = isolate->class_table();
+  // The response only changes when classes are loaded or the program is
+  // reloaded, so repeated tool polling replays the previous response.
+  const intptr_t num_cids = table->NumCids();
+  const int64_t reload_timestamp = isolate->group()->last_reload_timestamp();
+  const char* cached =
+      isolate->CachedClassListResponse(num_cids, reload_timestamp);
+  if (cached != nullptr) {
+    js->AppendSerializedObject(cached);
+    return true;
+  }
+  const intptr_t body_start = js->buffer()->length();
+  {
+    JSONObject jsobj(js);
+    table->PrintToJSONObject(&jsobj);
+  }
+  isolate->CacheClassListResponse(js->buffer()->buffer() + body_start,
+                                  num_cids, reload_timestamp);
   return true;
 }
 
@@ -5094,6 +5135,8 @@ static const ServiceMethodDescriptor service_methods_[] = {
       get_native_allocation_samples_params },
   { "getClassList", GetClassList,
     get_class_list_params },
+  { "_getCompilationLedger", GetCompilationLedger,
+    get_compilation_ledger_params },
   { "getCpuSamples", GetCpuSamples,
     get_cpu_samples_params },
   { "getFlagList", GetFlagList,
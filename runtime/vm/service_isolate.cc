@@ -29,6 +29,13 @@ namespace dart {
 #define Z (T->zone())
 
 DEFINE_FLAG(bool, trace_service, false, "Trace VM service requests.");
+DEFINE_FLAG(bool,
+            lazy_service_isolate,
+            false,
+            "Delay starting the vm-service isolate until it is first used, "
+            "saving its startup time and memory in processes no client ever "
+            "observes. The web server cannot come up at VM start when this "
+            "is set.");
 DEFINE_FLAG(bool,
             trace_service_pause_events,
             false,
@@ -85,8 +92,11 @@ Dart_Port ServiceIsolate::port_ = ILLEGAL_PORT;
 Dart_Port ServiceIsolate::origin_ = ILLEGAL_PORT;
 char* ServiceIsolate::server_address_ = NULL;
 char* ServiceIsolate::startup_failure_reason_ = nullptr;
+bool ServiceIsolate::deferred_start_ = false;
 
 void ServiceIsolate::RequestServerInfo(const SendPort& sp) {
+  EnsureStarted();
+  WaitForServiceIsolateStartup();
   const Array& message = Array::Handle(MakeServerControlMessage(
       sp, VM_SERVICE_SERVER_INFO_MESSAGE_ID, false /* ignored */,
       Bool::Handle() /* ignored */));
@@ -99,6 +109,8 @@ void ServiceIsolate::RequestServerInfo(const SendPort& sp) {
 void ServiceIsolate::ControlWebServer(const SendPort& sp,
                                       bool enable,
                                       const Bool& silenceOutput) {
+  EnsureStarted();
+  WaitForServiceIsolateStartup();
   const Array& message = Array::Handle(MakeServerControlMessage(
       sp, VM_SERVICE_WEB_SERVER_CONTROL_MESSAGE_ID, enable, silenceOutput));
   ASSERT(!message.IsNull());
@@ -185,6 +197,7 @@ bool ServiceIsolate::SendServiceRpc(uint8_t* request_json,
   request.type = Dart_CObject_kArray;
   request.value.as_array.values = request_array;
   request.value.as_array.length = ARRAY_SIZE(request_array);
+  ServiceIsolate::EnsureStarted();
   ServiceIsolate::WaitForServiceIsolateStartup();
   Dart_Port service_port = ServiceIsolate::Port();
 
@@ -482,15 +495,39 @@ class RunServiceTask : public ThreadPool::Task {
 };
 
 void ServiceIsolate::Run() {
+  // Grab the isolate create callback here to avoid race conditions with tests
+  // that change this after Dart_Initialize returns.
+  create_group_callback_ = Isolate::CreateGroupCallback();
+  if (FLAG_lazy_service_isolate) {
+    // Creation is deferred to the first use; see EnsureStarted(). When the
+    // isolate does come up, VMService_OnStart registers the isolates that
+    // are already running.
+    MonitorLocker ml(monitor_);
+    deferred_start_ = true;
+    return;
+  }
+  Start();
+}
+
+void ServiceIsolate::EnsureStarted() {
+  {
+    MonitorLocker ml(monitor_);
+    if (!deferred_start_) {
+      // Either already started (possibly eagerly) or never enabled.
+      return;
+    }
+    deferred_start_ = false;
+  }
+  Start();
+}
+
+void ServiceIsolate::Start() {
   {
     MonitorLocker ml(monitor_);
     ASSERT(state_ == kStopped);
     state_ = kStarting;
     ml.NotifyAll();
   }
-  // Grab the isolate create callback here to avoid race conditions with tests
-  // that change this after Dart_Initialize returns.
-  create_group_callback_ = Isolate::CreateGroupCallback();
   if (create_group_callback_ == NULL) {
     ServiceIsolate::InitializingFailed(
         Utils::StrDup("The 'create_group' callback was not provided"));
@@ -561,6 +598,11 @@ void ServiceIsolate::Shutdown() {
     free(startup_failure_reason_);
     startup_failure_reason_ = nullptr;
   }
+
+  {
+    MonitorLocker ml(monitor_);
+    deferred_start_ = false;
+  }
 }
 
 void ServiceIsolate::BootVmServiceLibrary() {
@@ -43,6 +43,12 @@ class ServiceIsolate : public AllStatic {
                              char** error);
 
   static void Run();
+
+  // With --lazy_service_isolate, Run() defers isolate creation; this starts
+  // the service isolate on its first actual use (a native service RPC or a
+  // dart:developer web server request). A no-op otherwise.
+  static void EnsureStarted();
+
   static bool SendIsolateStartupMessage();
   static bool SendIsolateShutdownMessage();
   static void SendServiceExitMessage();
@@ -65,8 +71,11 @@ class ServiceIsolate : public AllStatic {
   static void VisitObjectPointers(ObjectPointerVisitor* visitor);
 
  private:
+  static void Start();
   static void KillServiceIsolate();
 
+  static bool deferred_start_;
+
  protected:
   static void SetServicePort(Dart_Port port);
   static void SetServiceIsolate(Isolate* isolate);
@@ -104,6 +113,7 @@ class ServiceIsolate : public AllStatic {
   static bool IsServiceIsolate(const Isolate* isolate) { return false; }
   static bool IsServiceIsolateDescendant(Isolate* isolate) { return false; }
   static void Run() {}
+  static void EnsureStarted() {}
   static bool SendIsolateStartupMessage() { return false; }
   static bool SendIsolateShutdownMessage() { return false; }
   static void SendServiceExitMessage() {}
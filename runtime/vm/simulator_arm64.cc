@@ -3539,20 +3539,43 @@ void Simulator::InstructionDecode(Instr* instr) {
     }
   }
 
-  if (instr->IsDPImmediateOp()) {
-    DecodeDPImmediate(instr);
-  } else if (instr->IsCompareBranchOp()) {
-    DecodeCompareBranch(instr);
-  } else if (instr->IsLoadStoreOp()) {
-    DecodeLoadStore(instr);
-  } else if (instr->IsDPRegisterOp()) {
-    DecodeDPRegister(instr);
-  } else if (instr->IsDPSimd1Op()) {
-    DecodeDPSimd1(instr);
-  } else if (instr->IsDPSimd2Op()) {
-    DecodeDPSimd2(instr);
-  } else {
-    UnimplementedInstruction(instr);
+  // Dispatch on the op0 field (bits 25..28), which selects the same
+  // instruction groups as the Is*Op predicates but with a single jump table
+  // lookup instead of a cascade of mask tests.
+  switch (instr->Bits(25, 4)) {
+    case 0x8:
+    case 0x9:
+      ASSERT(instr->IsDPImmediateOp());
+      DecodeDPImmediate(instr);
+      break;
+    case 0xa:
+    case 0xb:
+      ASSERT(instr->IsCompareBranchOp());
+      DecodeCompareBranch(instr);
+      break;
+    case 0x4:
+    case 0x6:
+    case 0xc:
+    case 0xe:
+      ASSERT(instr->IsLoadStoreOp());
+      DecodeLoadStore(instr);
+      break;
+    case 0x5:
+    case 0xd:
+      ASSERT(instr->IsDPRegisterOp());
+      DecodeDPRegister(instr);
+      break;
+    case 0x7:
+      ASSERT(instr->IsDPSimd1Op());
+      DecodeDPSimd1(instr);
+      break;
+    case 0xf:
+      ASSERT(instr->IsDPSimd2Op());
+      DecodeDPSimd2(instr);
+      break;
+    default:
+      UnimplementedInstruction(instr);
+      break;
   }
 
   if (!pc_modified_) {
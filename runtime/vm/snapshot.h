@@ -88,6 +88,14 @@ enum SerializeState {
 
 // Structure capturing the raw snapshot.
 //
+// A full snapshot that includes code consists of the clustered stream,
+// followed at the next kMaxObjectAlignment boundary by a direct mapped data
+// image (see DataImage) holding the payloads of read-only objects such as
+// PcDescriptors and CodeSourceMaps. The stream is consumed only during
+// deserialization, and objects in the data image are used in place without
+// being copied into the heap (see RODataDeserializationCluster), so when the
+// embedder provides the snapshot as a read-only file mapping the kernel
+// shares its pages among all processes running the same snapshot.
 class Snapshot {
  public:
   enum Kind {
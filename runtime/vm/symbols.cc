@@ -387,10 +387,17 @@ StringPtr Symbols::NewSymbol(Thread* thread, const StringType& str) {
       // Second common case: We are not at a safepoint and the symbol is not
       // available in the symbol table: We require only exclusive access.
       if (symbol.IsNull()) {
+        // Allocate the candidate symbol before taking the write lock so that
+        // other threads interning symbols are not stalled behind a heap
+        // allocation (and a potential GC) made while holding the lock. If
+        // another thread wins the race to intern the same string the candidate
+        // simply becomes garbage.
+        String& candidate = String::Handle(thread->zone());
+        candidate ^= SymbolTraits::NewKey(str);
         auto insert_or_get = [&]() {
           data = object_store->symbol_table();
           CanonicalStringSet table(&key, &value, &data);
-          symbol ^= table.InsertNewOrGet(str);
+          symbol ^= table.InsertOrGet(candidate);
           object_store->set_symbol_table(table.Release());
         };
 
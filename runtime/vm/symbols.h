@@ -195,6 +195,7 @@ class ObjectPointerVisitor;
   V(Int8List, "Int8List")                                                      \
   V(IntegerDivisionByZeroException, "IntegerDivisionByZeroException")          \
   V(Interpolate, "_interpolate")                                               \
+  V(Interpolate2, "_interpolate2")                                             \
   V(InterpolateSingle, "_interpolateSingle")                                   \
   V(InvocationMirror, "_InvocationMirror")                                     \
   V(IsolateSpawnException, "IsolateSpawnException")                            \
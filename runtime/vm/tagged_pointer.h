@@ -205,6 +205,19 @@ inline std::ostream& operator<<(std::ostream& os, const ObjectPtr& obj) {
 }
 #endif
 
+// In-heap representation of an object pointer field. With
+// DART_COMPRESSED_POINTERS this will hold a 32-bit offset from a heap base
+// instead of a full tagged pointer, so field declarations and object size
+// computations should migrate to CompressedObjectPtr and kCompressedWordSize
+// rather than ObjectPtr and kWordSize. Decompression requires the heap base,
+// so layout accessors will take it as an argument once the compressed
+// representation lands; until then both modes share one layout.
+#if defined(DART_COMPRESSED_POINTERS)
+#error Compressed pointer fields are not implemented yet.
+#else
+typedef ObjectPtr CompressedObjectPtr;
+#endif
+
 #define DEFINE_TAGGED_POINTER(klass, base)                                     \
   class klass##Layout;                                                         \
   class klass##Ptr : public base##Ptr {                                        \
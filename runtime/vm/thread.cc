@@ -14,6 +14,7 @@
 #include "vm/message_handler.h"
 #include "vm/native_entry.h"
 #include "vm/object.h"
+#include "vm/os.h"
 #include "vm/os_thread.h"
 #include "vm/profiler.h"
 #include "vm/runtime_entry.h"
@@ -35,6 +36,13 @@ DECLARE_FLAG(bool, trace_service);
 DECLARE_FLAG(bool, trace_service_verbose);
 #endif  // !defined(PRODUCT)
 
+DEFINE_FLAG(int,
+            isolate_cpu_quota,
+            0,
+            "Maximum CPU time in milliseconds an isolate's mutator may "
+            "consume before the isolate is killed (0 means no quota). "
+            "System isolates are exempt.");
+
 Thread::~Thread() {
   // We should cleanly exit any isolate before destruction.
   ASSERT(isolate_ == NULL);
@@ -504,10 +512,40 @@ void Thread::RestoreOOBMessageInterrupts() {
 #endif  // !defined(PRODUCT)
 }
 
+void Thread::SampleIsolateCPUTime() {
+  ASSERT(task_kind_ == kMutatorTask);
+  const int64_t now = OS::GetCurrentThreadCPUMicros();
+  if ((now < 0) || (cpu_time_at_entry_micros_ < 0)) {
+    return;  // Thread CPU clocks are not supported on this OS.
+  }
+  isolate()->AccumulateCPUTimeMicros(now - cpu_time_at_entry_micros_);
+  cpu_time_at_entry_micros_ = now;
+}
+
 ErrorPtr Thread::HandleInterrupts() {
   uword interrupt_bits = GetAndClearInterrupts();
   if ((interrupt_bits & kVMInterrupt) != 0) {
     CheckForSafepoint();
+    if ((FLAG_isolate_cpu_quota > 0) && IsMutatorThread()) {
+      SampleIsolateCPUTime();
+      const int64_t quota_micros =
+          static_cast<int64_t>(FLAG_isolate_cpu_quota) *
+          kMicrosecondsPerMillisecond;
+      if ((isolate()->accumulated_cpu_time_micros() >= quota_micros) &&
+          !isolate()->cpu_quota_exceeded() &&
+          !Isolate::IsSystemIsolate(isolate())) {
+        isolate()->set_cpu_quota_exceeded();
+        if (FLAG_trace_isolates) {
+          OS::PrintErr(
+              "[!] Isolate exceeded its CPU quota:\n"
+              "\tisolate:    %s\n",
+              isolate()->name());
+        }
+        // Deliver the kill as an OOB message so the isolate unwinds at a
+        // well-defined point rather than mid-instruction.
+        Isolate::KillIfExists(isolate(), Isolate::kInternalKillMsg);
+      }
+    }
     if (isolate_group()->store_buffer()->Overflowed()) {
       if (FLAG_verbose_gc) {
         OS::PrintErr("Scavenge scheduled by store buffer overflow.\n");
@@ -1021,6 +1059,7 @@ void Thread::FinishEntering(TaskKind kind) {
   // TODO(koda): Use StoreBufferAcquire once we properly flush
   // before Scavenge.
   if (kind == kMutatorTask) {
+    cpu_time_at_entry_micros_ = OS::GetCurrentThreadCPUMicros();
     StoreBufferAcquire();
   } else {
     store_buffer_block_ = isolate_group()->store_buffer()->PopEmptyBlock();
@@ -1031,6 +1070,9 @@ void Thread::PrepareLeaving() {
   ASSERT(store_buffer_block_ != nullptr);
   ASSERT(execution_state() == Thread::kThreadInVM);
 
+  if (task_kind_ == kMutatorTask) {
+    SampleIsolateCPUTime();
+  }
   task_kind_ = kUnknownTask;
   if (is_marking()) {
     MarkingStackRelease();
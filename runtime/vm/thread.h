@@ -386,6 +386,12 @@ class Thread : public ThreadState {
   void ScheduleInterruptsLocked(uword interrupt_bits);
   ErrorPtr HandleInterrupts();
   uword GetAndClearInterrupts();
+
+  // Adds the CPU time this mutator has consumed since the last sample to the
+  // isolate's accumulated total. Called when the mutator is unscheduled and
+  // at interrupt checks, so a hot loop is charged without waiting for it to
+  // return to the message loop.
+  void SampleIsolateCPUTime();
   bool HasScheduledInterrupts() const {
     return (stack_limit_ & kInterruptsMask) != 0;
   }
@@ -511,6 +517,15 @@ class Thread : public ThreadState {
   Heap* heap() const { return heap_; }
   static intptr_t heap_offset() { return OFFSET_OF(Thread, heap_); }
 
+  // Bytes this thread may allocate before the profiler takes another
+  // allocation sample. Only used with --profile_allocation_interval.
+  intptr_t allocation_sample_budget() const {
+    return allocation_sample_budget_;
+  }
+  void set_allocation_sample_budget(intptr_t budget) {
+    allocation_sample_budget_ = budget;
+  }
+
   uword top() const { return top_; }
   uword end() const { return end_; }
   void set_top(uword top) { top_ = top; }
@@ -981,6 +996,7 @@ class Thread : public ThreadState {
   uint16_t deferred_interrupts_mask_;
   uint16_t deferred_interrupts_;
   int32_t stack_overflow_count_;
+  int64_t cpu_time_at_entry_micros_ = 0;
 
   // Compiler state:
   CompilerState* compiler_state_ = nullptr;
@@ -995,6 +1011,8 @@ class Thread : public ThreadState {
   intptr_t ffi_marshalled_arguments_size_ = 0;
   uint64_t* ffi_marshalled_arguments_;
 
+  intptr_t allocation_sample_budget_ = 0;
+
   InstancePtr* field_table_values() const { return field_table_values_; }
 
 // Reusable handles support.
@@ -52,7 +52,13 @@ void ThreadPool::Shutdown() {
       // All workers have already died.
       all_workers_dead_ = true;
     } else {
-      // Tell workers to drain remaining work and then shut down.
+      // Tell workers to drain remaining work and then shut down. Idle
+      // workers sleep on their own monitors, so wake each of them; a worker
+      // waiting in OnEnterIdleLocked sleeps on the pool monitor.
+      for (auto worker : idle_workers_) {
+        MonitorLocker wml(&worker->monitor_);
+        wml.Notify();
+      }
       ml.NotifyAll();
     }
   }
@@ -117,9 +123,14 @@ void ThreadPool::MarkCurrentWorkerAsBlocked() {
       // new thread (temporarily allow exceeding the maximum pool size) to
       // handle the pending tasks.
       if (idle_workers_.IsEmpty() && pending_tasks_ > 0) {
+        std::unique_ptr<Task> task(tasks_.RemoveFirst());
+        pending_tasks_--;
         new_worker = new Worker(this);
-        idle_workers_.Append(new_worker);
-        count_idle_++;
+        // The worker has not started yet, so its slot can be written without
+        // its monitor.
+        new_worker->task_ = std::move(task);
+        running_workers_.Append(new_worker);
+        count_running_++;
       }
     }
   }
@@ -147,27 +158,60 @@ void ThreadPool::WorkerLoop(Worker* worker) {
   WorkerList dead_workers_to_join;
 
   while (true) {
+    // Run whatever was handed to our slot without holding any pool lock.
+    std::unique_ptr<Task> task;
+    {
+      MonitorLocker wml(&worker->monitor_);
+      task = std::move(worker->task_);
+    }
+    if (task != nullptr) {
+      task->Run();
+      ASSERT(Isolate::Current() == nullptr);
+      task.reset();
+      continue;
+    }
+
     MonitorLocker ml(&pool_monitor_);
 
-    if (!tasks_.IsEmpty()) {
-      IdleToRunningLocked(worker);
-      while (!tasks_.IsEmpty()) {
-        std::unique_ptr<Task> task(tasks_.RemoveFirst());
-        pending_tasks_--;
-        MonitorLeaveScope mls(&ml);
-        task->Run();
-        ASSERT(Isolate::Current() == nullptr);
-        task.reset();
+    // The slot is written under the pool monitor, so check it once more now
+    // that we hold it.
+    {
+      MonitorLocker wml(&worker->monitor_);
+      if (worker->task_ != nullptr) {
+        continue;
       }
-      RunningToIdleLocked(worker);
     }
 
-    if (running_workers_.IsEmpty()) {
-      ASSERT(tasks_.IsEmpty());
-      OnEnterIdleLocked(&ml);
+    if (!worker->is_idle_) {
+      // Take overflowed tasks, if any, before going idle.
       if (!tasks_.IsEmpty()) {
+        MonitorLocker wml(&worker->monitor_);
+        worker->task_ = std::unique_ptr<Task>(tasks_.RemoveFirst());
+        pending_tasks_--;
         continue;
       }
+      RunningToIdleLocked(worker);
+      if (running_workers_.IsEmpty()) {
+        OnEnterIdleLocked(&ml);
+        // Work may have arrived while the pool monitor was released; it is
+        // either in our slot (re-checked above) or in the overflow list.
+        if (!tasks_.IsEmpty()) {
+          continue;
+        }
+        {
+          MonitorLocker wml(&worker->monitor_);
+          if (worker->task_ != nullptr) {
+            continue;
+          }
+        }
+      }
+    } else if (!tasks_.IsEmpty()) {
+      // Woken up to take overflowed tasks.
+      IdleToRunningLocked(worker);
+      MonitorLocker wml(&worker->monitor_);
+      worker->task_ = std::unique_ptr<Task>(tasks_.RemoveFirst());
+      pending_tasks_--;
+      continue;
     }
 
     if (shutting_down_) {
@@ -176,21 +220,29 @@ void ThreadPool::WorkerLoop(Worker* worker) {
       break;
     }
 
-    // Sleep until we get a new task, we time out or we're shutdown.
+    // Sleep on our own monitor until a task is handed to us, we time out or
+    // we're shutdown. Releasing the pool monitor first means neither the
+    // handoff nor other workers contend with us while we sleep.
     const int64_t idle_start = OS::GetCurrentMonotonicMicros();
-    bool done = false;
-    while (!done) {
-      const auto result = ml.WaitMicros(ComputeTimeout(idle_start));
-
-      // We have to drain all pending tasks.
-      if (!tasks_.IsEmpty()) break;
-
-      if (shutting_down_ || result == Monitor::kTimedOut) {
-        done = true;
-        break;
+    bool timed_out = false;
+    {
+      MonitorLeaveScope mls(&ml);
+      MonitorLocker wml(&worker->monitor_);
+      if (worker->task_ == nullptr) {
+        const auto result = wml.WaitMicros(ComputeTimeout(idle_start));
+        timed_out =
+            (worker->task_ == nullptr) && (result == Monitor::kTimedOut);
       }
     }
-    if (done) {
+    // Otherwise loop around to pick up the task, overflow work or shutdown.
+    if (timed_out) {
+      // A task may have been handed to us while we held neither monitor.
+      {
+        MonitorLocker wml(&worker->monitor_);
+        if (worker->task_ != nullptr) {
+          continue;
+        }
+      }
       ObtainDeadWorkersLocked(&dead_workers_to_join);
       IdleToDeadLocked(worker);
       break;
@@ -210,6 +262,7 @@ void ThreadPool::IdleToRunningLocked(Worker* worker) {
   running_workers_.Append(worker);
   count_idle_--;
   count_running_++;
+  worker->is_idle_ = false;
 }
 
 void ThreadPool::RunningToIdleLocked(Worker* worker) {
@@ -220,6 +273,7 @@ void ThreadPool::RunningToIdleLocked(Worker* worker) {
   idle_workers_.Append(worker);
   count_running_--;
   count_idle_++;
+  worker->is_idle_ = true;
 }
 
 void ThreadPool::IdleToDeadLocked(Worker* worker) {
@@ -261,31 +315,43 @@ void ThreadPool::JoinDeadWorkersLocked(WorkerList* dead_workers_to_join) {
 
 ThreadPool::Worker* ThreadPool::ScheduleTaskLocked(MonitorLocker* ml,
                                                    std::unique_ptr<Task> task) {
-  // Enqueue the new task.
-  tasks_.Append(task.release());
-  pending_tasks_++;
-  ASSERT(pending_tasks_ >= 1);
-
-  // Notify existing idle worker (if available).
-  if (count_idle_ >= pending_tasks_) {
-    ASSERT(!idle_workers_.IsEmpty());
-    ml->Notify();
+  const bool pool_was_idle = running_workers_.IsEmpty();
+
+  // Hand the task directly to an idle worker (if available) and wake only
+  // that worker up on its own monitor.
+  if (!idle_workers_.IsEmpty()) {
+    Worker* worker = idle_workers_.Last();
+    IdleToRunningLocked(worker);
+    {
+      MonitorLocker wml(&worker->monitor_);
+      ASSERT(worker->task_ == nullptr);
+      worker->task_ = std::move(task);
+      wml.Notify();
+    }
+    // A worker waiting in OnEnterIdleLocked sleeps on the pool monitor
+    // instead of its own; let it re-evaluate.
+    if (pool_was_idle) {
+      ml->NotifyAll();
+    }
     return nullptr;
   }
 
-  // If we have maxed out the number of threads running, we will not start a
-  // new one.
+  // If we have maxed out the number of threads running, overflow the task
+  // until a running worker finishes its current task.
   if (max_pool_size_ > 0 && (count_idle_ + count_running_) >= max_pool_size_) {
-    if (!idle_workers_.IsEmpty()) {
-      ml->Notify();
-    }
+    tasks_.Append(task.release());
+    pending_tasks_++;
+    ASSERT(pending_tasks_ >= 1);
     return nullptr;
   }
 
-  // Otherwise start a new worker.
+  // Otherwise start a new worker with the task already in its slot.
   auto new_worker = new Worker(this);
-  idle_workers_.Append(new_worker);
-  count_idle_++;
+  // The worker has not started yet, so its slot can be written without its
+  // monitor.
+  new_worker->task_ = std::move(task);
+  running_workers_.Append(new_worker);
+  count_running_++;
   return new_worker;
 }
 
@@ -316,7 +382,8 @@ void ThreadPool::Worker::Main(uword args) {
 #if defined(DEBUG)
   {
     MonitorLocker ml(&pool->pool_monitor_);
-    ASSERT(pool->idle_workers_.ContainsForDebugging(worker));
+    // New workers are born running, with their first task in the slot.
+    ASSERT(pool->running_workers_.ContainsForDebugging(worker));
   }
 #endif
 
@@ -72,7 +72,7 @@ class ThreadPool {
     explicit Worker(ThreadPool* pool);
 
     // Starts the thread for the worker.  This should only be called
-    // after a task has been set by the initial call to SetTask().
+    // after the initial task has been placed in the worker's slot.
     void StartThread();
 
    private:
@@ -88,6 +88,17 @@ class ThreadPool {
     OSThread* os_thread_ = nullptr;
     bool is_blocked_ = false;
 
+    // Tasks are handed directly to a worker and only its own monitor is
+    // used for sleeping and waking it up, so scheduling a task does not
+    // disturb the other workers. The slot is written while holding both the
+    // pool monitor and monitor_, so either one is enough to read it.
+    Monitor monitor_;
+    std::unique_ptr<Task> task_;
+
+    // Whether the worker is in [ThreadPool::idle_workers_]; workers in that
+    // list have an empty task slot. Guarded by the pool monitor.
+    bool is_idle_ = false;
+
     DISALLOW_COPY_AND_ASSIGN(Worker);
   };
 
@@ -53,6 +53,15 @@ class ThreadRegistry {
 
   // This monitor protects the threads list for an isolate, it is used whenever
   // we need to iterate over threads (both active and free) in an isolate.
+  //
+  // Iterating over an epoch/RCU-style snapshot instead, so that helper-thread
+  // enter/exit does not contend with iteration, is not sound here: a Thread
+  // that exits during iteration is returned to the free list and may be
+  // handed to another thread, so a visitor could read a structure that is
+  // being reinitialized. The iterations themselves run at safepoints or on
+  // rare service requests and only do O(1) work per thread, while enter/exit
+  // holds the lock for a couple of pointer updates, so hold times stay short
+  // on both sides.
   mutable Monitor threads_lock_;
   Thread* active_list_;  // List of active threads in the isolate.
   Thread* free_list_;    // Free list of Thread objects that can be reused.
@@ -55,7 +55,8 @@ DEFINE_FLAG(charp,
             timeline_recorder,
             "ring",
             "Select the timeline recorder used. "
-            "Valid values: ring, endless, startup, and systrace.")
+            "Valid values: ring, ringlockfree, endless, startup, systrace, "
+            "and file[=trace.json].")
 
 // Implementation notes:
 //
@@ -140,6 +141,25 @@ static TimelineEventRecorder* CreateTimelineRecorder() {
     }
   }
 
+#if !defined(PRODUCT)
+  if ((flag != NULL) && (strncmp("file", flag, 4) == 0) &&
+      ((flag[4] == '\0') || (flag[4] == ':') || (flag[4] == '='))) {
+    const char* filename =
+        (flag[4] == '\0') ? "dart-timeline.json" : &flag[5];
+    if (FLAG_trace_timeline) {
+      THR_Print("Using the file timeline recorder (%s).\n", filename);
+    }
+    return new TimelineEventFileRecorder(filename);
+  }
+#endif
+
+  if ((flag != NULL) && (strcmp("ringlockfree", flag) == 0)) {
+    if (FLAG_trace_timeline) {
+      THR_Print("Using the lock-free ring timeline recorder.\n");
+    }
+    return new TimelineEventLockFreeRingRecorder();
+  }
+
   if (use_startup_recorder || (flag != NULL)) {
     if (use_startup_recorder || (strcmp("startup", flag) == 0)) {
       if (FLAG_trace_timeline) {
@@ -1252,6 +1272,168 @@ TimelineEventBlock* TimelineEventRingRecorder::GetNewBlockLocked() {
   return block;
 }
 
+TimelineEventLockFreeRingRecorder::TimelineEventLockFreeRingRecorder(
+    intptr_t capacity)
+    : memory_(NULL),
+      events_(NULL),
+      slot_states_(NULL),
+      capacity_(capacity),
+      cursor_(0),
+      active_writers_(0),
+      paused_(false) {
+  intptr_t size = Utils::RoundUp(capacity * sizeof(TimelineEvent),
+                                 VirtualMemory::PageSize());
+  const bool kNotExecutable = false;
+  memory_ = VirtualMemory::Allocate(size, kNotExecutable, "dart-timeline");
+  if (memory_ == NULL) {
+    OUT_OF_MEMORY();
+  }
+  events_ = reinterpret_cast<TimelineEvent*>(memory_->address());
+  slot_states_ = new std::atomic<uint32_t>[capacity];
+  for (intptr_t i = 0; i < capacity; i++) {
+    slot_states_[i] = kSlotEmpty;
+  }
+}
+
+TimelineEventLockFreeRingRecorder::~TimelineEventLockFreeRingRecorder() {
+  // Delete all events.
+  for (intptr_t i = 0; i < capacity_; i++) {
+    events_[i].Reset();
+  }
+  delete[] slot_states_;
+  delete memory_;
+}
+
+intptr_t TimelineEventLockFreeRingRecorder::Size() {
+  return memory_->size();
+}
+
+bool TimelineEventLockFreeRingRecorder::StartWrite() {
+  active_writers_.fetch_add(1);
+  if (paused_.load()) {
+    // A reader is consuming the ring.
+    active_writers_.fetch_sub(1);
+    return false;
+  }
+  return true;
+}
+
+void TimelineEventLockFreeRingRecorder::EndWrite() {
+  active_writers_.fetch_sub(1);
+}
+
+void TimelineEventLockFreeRingRecorder::PauseRecording() {
+  ASSERT(lock_.IsOwnedByCurrentThread());
+  paused_.store(true);
+  // Wait for in-flight writers to complete their events. A writer only holds
+  // its reservation while populating a single event, so this window is short.
+  while (active_writers_.load() > 0) {
+    OS::SleepMicros(10);
+  }
+}
+
+void TimelineEventLockFreeRingRecorder::ResumeRecording() {
+  ASSERT(lock_.IsOwnedByCurrentThread());
+  paused_.store(false);
+}
+
+TimelineEvent* TimelineEventLockFreeRingRecorder::StartEvent() {
+  if (!StartWrite()) {
+    return NULL;
+  }
+  // Claim sequence numbers until an empty or completed slot is won. A slot
+  // can be skipped past its turn only while a straggling writer is still
+  // populating the event it holds.
+  for (intptr_t attempt = 0; attempt < capacity_; attempt++) {
+    const uintptr_t seq = cursor_.fetch_add(1);
+    std::atomic<uint32_t>* slot = &slot_states_[seq % capacity_];
+    uint32_t state = slot->load();
+    if (state == kSlotReserved) {
+      continue;
+    }
+    if (slot->compare_exchange_strong(state, kSlotReserved)) {
+      TimelineEvent* event = &events_[seq % capacity_];
+      event->Reset();
+      return event;
+    }
+  }
+  EndWrite();
+  return NULL;
+}
+
+void TimelineEventLockFreeRingRecorder::CompleteEvent(TimelineEvent* event) {
+  if (event == NULL) {
+    return;
+  }
+  const intptr_t index = event - events_;
+  ASSERT(index >= 0);
+  ASSERT(index < capacity_);
+  ASSERT(slot_states_[index].load() == kSlotReserved);
+  slot_states_[index].store(kSlotCompleted);
+  EndWrite();
+}
+
+void TimelineEventLockFreeRingRecorder::Clear() {
+  MutexLocker ml(&lock_);
+  PauseRecording();
+  for (intptr_t i = 0; i < capacity_; i++) {
+    ASSERT(slot_states_[i].load() != kSlotReserved);
+    events_[i].Reset();
+    slot_states_[i].store(kSlotEmpty);
+  }
+  cursor_ = 0;
+  ResumeRecording();
+}
+
+#ifndef PRODUCT
+void TimelineEventLockFreeRingRecorder::PrintJSONEvents(
+    JSONArray* events,
+    TimelineEventFilter* filter) {
+  MutexLocker ml(&lock_);
+  PauseRecording();
+  ResetTimeTracking();
+  const uintptr_t cursor = cursor_.load();
+  uintptr_t seq =
+      (cursor > static_cast<uintptr_t>(capacity_)) ? cursor - capacity_ : 0;
+  for (; seq < cursor; seq++) {
+    const intptr_t index = seq % capacity_;
+    if (slot_states_[index].load() != kSlotCompleted) {
+      continue;
+    }
+    TimelineEvent* event = &events_[index];
+    if (filter->IncludeEvent(event) &&
+        event->Within(filter->time_origin_micros(),
+                      filter->time_extent_micros())) {
+      ReportTime(event->LowTime());
+      ReportTime(event->HighTime());
+      events->AddValue(event);
+    }
+  }
+  ResumeRecording();
+}
+
+void TimelineEventLockFreeRingRecorder::PrintJSON(JSONStream* js,
+                                                  TimelineEventFilter* filter) {
+  JSONObject topLevel(js);
+  topLevel.AddProperty("type", "Timeline");
+  {
+    JSONArray events(&topLevel, "traceEvents");
+    PrintJSONMeta(&events);
+    PrintJSONEvents(&events, filter);
+  }
+  topLevel.AddPropertyTimeMicros("timeOriginMicros", TimeOriginMicros());
+  topLevel.AddPropertyTimeMicros("timeExtentMicros", TimeExtentMicros());
+}
+
+void TimelineEventLockFreeRingRecorder::PrintTraceEvent(
+    JSONStream* js,
+    TimelineEventFilter* filter) {
+  JSONArray events(js);
+  PrintJSONMeta(&events);
+  PrintJSONEvents(&events, filter);
+}
+#endif
+
 TimelineEventBlock* TimelineEventStartupRecorder::GetNewBlockLocked() {
   if (block_cursor_ == num_blocks_) {
     return NULL;
@@ -1330,6 +1512,132 @@ void TimelineEventPlatformRecorder::CompleteEvent(TimelineEvent* event) {
   delete event;
 }
 
+#ifndef PRODUCT
+static void TimelineEventFileRecorderStart(uword parameter) {
+  reinterpret_cast<TimelineEventFileRecorder*>(parameter)->Drain();
+}
+
+TimelineEventFileRecorder::TimelineEventFileRecorder(const char* path)
+    : TimelineEventPlatformRecorder(),
+      monitor_(),
+      head_(nullptr),
+      tail_(nullptr),
+      file_(nullptr),
+      first_(true),
+      shutting_down_(false),
+      thread_id_(OSThread::kInvalidThreadJoinId) {
+  Dart_FileOpenCallback file_open = Dart::file_open_callback();
+  Dart_FileWriteCallback file_write = Dart::file_write_callback();
+  Dart_FileCloseCallback file_close = Dart::file_close_callback();
+  if ((file_open == nullptr) || (file_write == nullptr) ||
+      (file_close == nullptr)) {
+    OS::PrintErr("warning: Could not access file callbacks.");
+    return;
+  }
+  void* file = (*file_open)(path, /*write=*/true);
+  if (file == nullptr) {
+    OS::PrintErr("warning: Failed to open timeline file: %s\n", path);
+    return;
+  }
+  file_ = file;
+  Write("{\"traceEvents\":[");
+  OSThread::Start("TimelineEventFileRecorder", TimelineEventFileRecorderStart,
+                  reinterpret_cast<uword>(this));
+}
+
+TimelineEventFileRecorder::~TimelineEventFileRecorder() {
+  if (file_ == nullptr) {
+    return;
+  }
+  {
+    MonitorLocker ml(&monitor_);
+    // Wait for the writer thread to record its join id before asking it to
+    // shut down, in case it has not started running yet.
+    while (thread_id_ == OSThread::kInvalidThreadJoinId) {
+      ml.Wait();
+    }
+    shutting_down_ = true;
+    ml.NotifyAll();
+  }
+  OSThread::Join(thread_id_);
+  ASSERT(head_ == nullptr);
+  Write("]}\n");
+  Dart_FileCloseCallback file_close = Dart::file_close_callback();
+  (*file_close)(file_);
+  file_ = nullptr;
+}
+
+void TimelineEventFileRecorder::CompleteEvent(TimelineEvent* event) {
+  if (event == nullptr) {
+    return;
+  }
+  if (file_ == nullptr) {
+    delete event;
+    return;
+  }
+  MonitorLocker ml(&monitor_);
+  ASSERT(!shutting_down_);
+  event->next_ = nullptr;
+  if (tail_ == nullptr) {
+    head_ = tail_ = event;
+  } else {
+    tail_->next_ = event;
+    tail_ = event;
+  }
+  ml.Notify();
+}
+
+void TimelineEventFileRecorder::Drain() {
+  {
+    MonitorLocker ml(&monitor_);
+    thread_id_ = OSThread::GetCurrentThreadJoinId(OSThread::Current());
+    ml.NotifyAll();
+  }
+  for (;;) {
+    TimelineEvent* event = nullptr;
+    {
+      MonitorLocker ml(&monitor_);
+      while ((head_ == nullptr) && !shutting_down_) {
+        ml.Wait();
+      }
+      if (head_ == nullptr) {
+        ASSERT(shutting_down_);
+        return;  // Drained; the file is finished by the destructor.
+      }
+      event = head_;
+      head_ = event->next_;
+      if (head_ == nullptr) {
+        tail_ = nullptr;
+      }
+    }
+    // Serialize and write without holding the monitor so event completion is
+    // never blocked on I/O.
+    WriteCompletedEvent(event);
+    delete event;
+  }
+}
+
+void TimelineEventFileRecorder::WriteCompletedEvent(TimelineEvent* event) {
+  JSONStream js;
+  event->PrintJSON(&js);
+  if (first_) {
+    first_ = false;
+  } else {
+    Write(",", 1);
+  }
+  Write(js.buffer()->buffer(), js.buffer()->length());
+}
+
+void TimelineEventFileRecorder::Write(const char* buffer, intptr_t len) {
+  Dart_FileWriteCallback file_write = Dart::file_write_callback();
+  (*file_write)(buffer, len, file_);
+}
+
+void TimelineEventFileRecorder::Write(const char* buffer) {
+  Write(buffer, strlen(buffer));
+}
+#endif  // !PRODUCT
+
 TimelineEventEndlessRecorder::TimelineEventEndlessRecorder()
     : head_(nullptr), tail_(nullptr), block_index_(0) {}
 
@@ -49,9 +49,11 @@ class Zone;
 
 #define CALLBACK_RECORDER_NAME "Callback"
 #define ENDLESS_RECORDER_NAME "Endless"
+#define FILE_RECORDER_NAME "File"
 #define FUCHSIA_RECORDER_NAME "Fuchsia"
 #define MACOS_RECORDER_NAME "Macos"
 #define RING_RECORDER_NAME "Ring"
+#define RING_LOCK_FREE_RECORDER_NAME "RingLockFree"
 #define STARTUP_RECORDER_NAME "Startup"
 #define SYSTRACE_RECORDER_NAME "Systrace"
 
@@ -473,9 +475,12 @@ class TimelineEvent {
   ThreadId thread_;
   Dart_Port isolate_id_;
   uint64_t isolate_group_id_;
+  // Link used by the file recorder's queue of completed events.
+  TimelineEvent* next_ = nullptr;
 
   friend class TimelineEventRecorder;
   friend class TimelineEventEndlessRecorder;
+  friend class TimelineEventFileRecorder;
   friend class TimelineEventRingRecorder;
   friend class TimelineEventStartupRecorder;
   friend class TimelineEventPlatformRecorder;
@@ -812,6 +817,69 @@ class TimelineEventRingRecorder : public TimelineEventFixedBufferRecorder {
   TimelineEventBlock* GetNewBlockLocked();
 };
 
+// A recorder that stores events in a fixed capacity ring of events. Slots in
+// the ring are reserved from a single atomic sequence counter, so recording an
+// event takes no locks and threads never contend with each other on the fast
+// path. Readers briefly pause event reservation and then merge the surviving
+// events in sequence order. When the ring is full, new events overwrite old
+// events.
+class TimelineEventLockFreeRingRecorder : public TimelineEventRecorder {
+ public:
+  static const intptr_t kDefaultCapacity = 32 * KB;  // Number of events.
+
+  explicit TimelineEventLockFreeRingRecorder(
+      intptr_t capacity = kDefaultCapacity);
+  virtual ~TimelineEventLockFreeRingRecorder();
+
+#ifndef PRODUCT
+  void PrintJSON(JSONStream* js, TimelineEventFilter* filter);
+  void PrintTraceEvent(JSONStream* js, TimelineEventFilter* filter);
+#endif
+
+  const char* name() const { return RING_LOCK_FREE_RECORDER_NAME; }
+  intptr_t Size();
+
+ protected:
+  TimelineEvent* StartEvent();
+  void CompleteEvent(TimelineEvent* event);
+  TimelineEventBlock* GetHeadBlockLocked() { return NULL; }
+  TimelineEventBlock* GetNewBlockLocked() { return NULL; }
+  void Clear();
+
+#ifndef PRODUCT
+  void PrintJSONEvents(JSONArray* array, TimelineEventFilter* filter);
+#endif
+
+ private:
+  // Lifecycle of a slot in the ring. A writer may reclaim a slot in any state
+  // except kSlotReserved, which marks a writer still populating the event.
+  enum SlotState : uint32_t {
+    kSlotEmpty = 0,
+    kSlotReserved = 1,
+    kSlotCompleted = 2,
+  };
+
+  // Returns false while a reader has paused event reservation; the caller
+  // must drop the event in that case.
+  bool StartWrite();
+  void EndWrite();
+
+  // Blocks until all in-flight writers have completed their events. Must be
+  // called while holding [lock_], which serializes readers.
+  void PauseRecording();
+  void ResumeRecording();
+
+  VirtualMemory* memory_;
+  TimelineEvent* events_;
+  std::atomic<uint32_t>* slot_states_;
+  intptr_t capacity_;
+
+  // Sequence number of the next event reservation.
+  std::atomic<uintptr_t> cursor_;
+  std::atomic<intptr_t> active_writers_;
+  std::atomic<bool> paused_;
+};
+
 // A recorder that stores events in a buffer of fixed capacity. When the buffer
 // is full, new events are dropped.
 class TimelineEventStartupRecorder : public TimelineEventFixedBufferRecorder {
@@ -986,6 +1054,40 @@ class TimelineEventMacosRecorder : public TimelineEventPlatformRecorder {
 };
 #endif  // defined(HOST_OS_MACOS)
 
+#ifndef PRODUCT
+// A recorder that writes completed events to a file as Chrome trace-format
+// JSON. Events are queued at completion time and serialized and written by a
+// background thread, so completing an event never blocks on I/O.
+class TimelineEventFileRecorder : public TimelineEventPlatformRecorder {
+ public:
+  explicit TimelineEventFileRecorder(const char* path);
+  virtual ~TimelineEventFileRecorder();
+
+  const char* name() const { return FILE_RECORDER_NAME; }
+  intptr_t Size() { return 0; }
+
+  void Drain();
+
+ private:
+  void WriteCompletedEvent(TimelineEvent* event);
+  void Write(const char* buffer, intptr_t len);
+  void Write(const char* buffer);
+
+  void OnEvent(TimelineEvent* event) { UNREACHABLE(); }
+  void CompleteEvent(TimelineEvent* event);
+
+  Monitor monitor_;
+  // A linked list of completed events waiting to be written, in completion
+  // order. Protected by |monitor_|.
+  TimelineEvent* head_;
+  TimelineEvent* tail_;
+  void* file_;
+  bool first_;
+  bool shutting_down_;
+  ThreadJoinId thread_id_;
+};
+#endif  // !PRODUCT
+
 class DartTimelineEventHelpers : public AllStatic {
  public:
   static void ReportTaskEvent(Thread* thread,
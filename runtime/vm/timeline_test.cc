@@ -338,6 +338,40 @@ TEST_CASE(TimelineEventCallbackRecorderBasic) {
   delete recorder;
 }
 
+TEST_CASE(TimelineEventLockFreeRingRecorderBasic) {
+  TimelineEventLockFreeRingRecorder* recorder =
+      new TimelineEventLockFreeRingRecorder(64);
+  TimelineRecorderOverride override(recorder);
+
+  // Create a test stream.
+  TimelineStream stream("testStream", "testStream", true);
+
+  TimelineEvent* event = stream.StartEvent();
+  EXPECT(event != NULL);
+  event->Instant("lockFreeCabbage");
+  event->Complete();
+
+  JSONStream js;
+  TimelineEventFilter filter;
+  recorder->PrintJSON(&js, &filter);
+  EXPECT_SUBSTRING("\"type\":\"Timeline\"", js.ToCString());
+  EXPECT_SUBSTRING("lockFreeCabbage", js.ToCString());
+
+  // Events survive overwrites of the ring as long as they are not stale.
+  for (intptr_t i = 0; i < 256; i++) {
+    event = stream.StartEvent();
+    EXPECT(event != NULL);
+    event->Instant("filler");
+    event->Complete();
+  }
+  JSONStream js2;
+  recorder->PrintJSON(&js2, &filter);
+  EXPECT_SUBSTRING("filler", js2.ToCString());
+  EXPECT_NOTSUBSTRING("lockFreeCabbage", js2.ToCString());
+
+  delete recorder;
+}
+
 static bool LabelMatch(TimelineEvent* event, const char* label) {
   ASSERT(event != NULL);
   return strcmp(event->label(), label) == 0;
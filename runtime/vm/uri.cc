@@ -78,14 +78,59 @@ static int GetEscapedValue(const char* str, intptr_t pos, intptr_t len) {
   return HexValue(digit1) * 16 + HexValue(digit2);
 }
 
+static bool IsLowerHexDigit(char value) {
+  return (value >= 'a' && value <= 'f');
+}
+
+// Computes the length of [str] after escape normalization and records
+// whether normalization changes the string at all.
+static intptr_t NormalizedLength(const char* str, intptr_t len, bool* changed) {
+  intptr_t normalized_len = 0;
+  intptr_t pos = 0;
+  while (pos < len) {
+    int escaped_value = GetEscapedValue(str, pos, len);
+    if (escaped_value >= 0) {
+      if (IsUnreservedChar(escaped_value)) {
+        // The escaping is reverted: three characters become one.
+        normalized_len += 1;
+        *changed = true;
+      } else {
+        // The escape is preserved, but its hex digits are uppercased.
+        normalized_len += 3;
+        if (IsLowerHexDigit(str[pos + 1]) || IsLowerHexDigit(str[pos + 2])) {
+          *changed = true;
+        }
+      }
+      pos += 3;
+    } else {
+      char c = str[pos];
+      if (c == '%' || IsDelimiter(c) || IsUnreservedChar(c)) {
+        normalized_len += 1;
+      } else {
+        // Funky characters get escaped: one character becomes three.
+        normalized_len += 3;
+        *changed = true;
+      }
+      pos++;
+    }
+  }
+  return normalized_len;
+}
+
 static char* NormalizeEscapes(const char* str, intptr_t len) {
-  // Allocate the buffer.
   Zone* zone = ThreadState::Current()->zone();
-  // We multiply len by three because a percent-escape sequence is
-  // three characters long (e.g. ' ' -> '%20).  +1 for '\0'.  We could
-  // take two passes through the string and avoid the excess
-  // allocation, but it's zone-memory so it doesn't seem necessary.
-  char* buffer = zone->Alloc<char>(len * 3 + 1);
+
+  // Most uris the VM parses (library and script resolution) are already in
+  // normalized form, so take a cheap counting pass first. If nothing changes
+  // the component is copied wholesale, and otherwise the buffer is allocated
+  // at its exact size instead of three times the input length.
+  bool changed = false;
+  const intptr_t normalized_len = NormalizedLength(str, len, &changed);
+  if (!changed) {
+    ASSERT(normalized_len == len);
+    return zone->MakeCopyOfStringN(str, len);
+  }
+  char* buffer = zone->Alloc<char>(normalized_len + 1);  // +1 for '\0'
 
   // Copy the string, normalizing as we go.
   intptr_t buffer_pos = 0;
@@ -120,6 +165,7 @@ static char* NormalizeEscapes(const char* str, intptr_t len) {
       pos++;
     }
   }
+  ASSERT(buffer_pos == normalized_len);
   buffer[buffer_pos] = '\0';
   return buffer;
 }
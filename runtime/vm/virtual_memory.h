@@ -65,6 +65,20 @@ class VirtualMemory {
 
   static bool InSamePage(uword address0, uword address1);
 
+  // Returns the physical memory backing [address, address + size) to the
+  // OS while keeping the reservation and its protection intact. The contents
+  // of the range become undefined.
+  static void DontNeed(void* address, intptr_t size);
+
+  // Hints that [address, address + size) will be accessed soon, so the OS
+  // should start reading it in now. Best effort.
+  static void WillNeed(void* address, intptr_t size);
+
+  // Hints that [address, address + size) will be accessed sparsely, so the
+  // OS should only fault in the pages actually touched instead of reading
+  // ahead around each access. Best effort.
+  static void WillAccessRandomly(void* address, intptr_t size);
+
   // Truncate this virtual memory segment.
   void Truncate(intptr_t new_size);
 
@@ -180,6 +180,19 @@ void VirtualMemory::FreeSubSegment(void* address, intptr_t size) {
   LOG_INFO("zx_vmar_unmap(0x%p, 0x%lx) success\n", address, size);
 }
 
+void VirtualMemory::DontNeed(void* address, intptr_t size) {
+  // Nothing to do: the backing VMO handle is closed after mapping, so the
+  // committed pages cannot be decommitted here.
+}
+
+void VirtualMemory::WillNeed(void* address, intptr_t size) {
+  // Nothing to do: anonymous VMO pages are already committed when mapped.
+}
+
+void VirtualMemory::WillAccessRandomly(void* address, intptr_t size) {
+  // Nothing to do: there is no per-range access pattern advice on Fuchsia.
+}
+
 void VirtualMemory::Protect(void* address, intptr_t size, Protection mode) {
 #if defined(DEBUG)
   Thread* thread = Thread::Current();
@@ -35,6 +35,19 @@ namespace dart {
 DECLARE_FLAG(bool, dual_map_code);
 DECLARE_FLAG(bool, write_protect_code);
 
+#if defined(HOST_OS_LINUX)
+DEFINE_FLAG(bool,
+            madvise_huge_pages,
+            false,
+            "Advise the kernel to back non-executable heap regions with "
+            "transparent huge pages to reduce TLB pressure.");
+DEFINE_FLAG(int,
+            numa_node,
+            -1,
+            "Bind non-executable heap regions to the given NUMA node "
+            "(-1: use the kernel's default placement).");
+#endif
+
 #if defined(TARGET_OS_LINUX)
 DECLARE_FLAG(bool, generate_perf_events_symbols);
 DECLARE_FLAG(bool, generate_perf_jitdump);
@@ -115,6 +128,48 @@ static void unmap(uword start, uword end) {
   }
 }
 
+#if defined(HOST_OS_LINUX)
+#if !defined(MADV_HUGEPAGE)
+#define MADV_HUGEPAGE 14
+#endif
+
+// Linux memory policy mode from <numaif.h>, redefined here to avoid a
+// dependency on the libnuma headers.
+static const int kMPolBind = 2;
+
+// Wrapper to call mbind syscall.
+static inline int mbind(void* start,
+                        unsigned long len,  // NOLINT
+                        int mode,
+                        const unsigned long* nodemask,  // NOLINT
+                        unsigned long maxnode) {  // NOLINT
+#if !defined(__NR_mbind)
+  errno = ENOSYS;
+  return -1;
+#else
+  return syscall(__NR_mbind, start, len, mode, nodemask, maxnode, 0);
+#endif
+}
+
+// Best-effort placement advice for non-executable (heap) regions. Failures
+// only cost the potential TLB or locality win, so they are not fatal.
+static void ApplyAllocationPolicy(void* address, intptr_t size) {
+  if (FLAG_madvise_huge_pages) {
+    if (madvise(address, size, MADV_HUGEPAGE) != 0) {
+      LOG_INFO("madvise(%p, 0x%" Px ", MADV_HUGEPAGE) failed: %d\n", address,
+               size, errno);
+    }
+  }
+  if ((FLAG_numa_node >= 0) && (FLAG_numa_node < kBitsPerWord)) {
+    const unsigned long nodemask = 1UL << FLAG_numa_node;  // NOLINT
+    if (mbind(address, size, kMPolBind, &nodemask, kBitsPerWord) != 0) {
+      LOG_INFO("mbind(%p, 0x%" Px ", node %d) failed: %d\n", address, size,
+               FLAG_numa_node, errno);
+    }
+  }
+}
+#endif  // defined(HOST_OS_LINUX)
+
 #if defined(DUAL_MAPPING_SUPPORTED)
 // Do not leak file descriptors to child processes.
 #if !defined(MFD_CLOEXEC)
@@ -241,6 +296,11 @@ VirtualMemory* VirtualMemory::AllocateAligned(intptr_t size,
     if (region_ptr == NULL) {
       return NULL;
     }
+#if defined(HOST_OS_LINUX)
+    if (!is_executable) {
+      ApplyAllocationPolicy(region_ptr, size);
+    }
+#endif
     MemoryRegion region(region_ptr, size);
     return new VirtualMemory(region, region);
   }
@@ -265,6 +325,12 @@ VirtualMemory* VirtualMemory::AllocateAligned(intptr_t size,
   unmap(base, aligned_base);
   unmap(aligned_base + size, base + allocated_size);
 
+#if defined(HOST_OS_LINUX)
+  if (!is_executable) {
+    ApplyAllocationPolicy(reinterpret_cast<void*>(aligned_base), size);
+  }
+#endif
+
   MemoryRegion region(reinterpret_cast<void*>(aligned_base), size);
   return new VirtualMemory(region, region);
 }
@@ -285,6 +351,49 @@ void VirtualMemory::FreeSubSegment(void* address,
   unmap(start, start + size);
 }
 
+void VirtualMemory::DontNeed(void* address, intptr_t size) {
+  uword start_address = reinterpret_cast<uword>(address);
+  uword end_address = start_address + size;
+  uword page_address = Utils::RoundDown(start_address, PageSize());
+#if defined(HOST_OS_MACOS)
+  const int advice = MADV_FREE;
+#else
+  const int advice = MADV_DONTNEED;
+#endif
+  if (madvise(reinterpret_cast<void*>(page_address),
+              end_address - page_address, advice) != 0) {
+    int error = errno;
+    const int kBufferSize = 1024;
+    char error_buf[kBufferSize];
+    FATAL2("madvise error: %d (%s)", error,
+           Utils::StrError(error, error_buf, kBufferSize));
+  }
+}
+
+void VirtualMemory::WillNeed(void* address, intptr_t size) {
+  uword start_address = reinterpret_cast<uword>(address);
+  uword end_address = start_address + size;
+  uword page_address = Utils::RoundDown(start_address, PageSize());
+  // Best effort: the range may span mappings with different backing, some of
+  // which reject the advice.
+  if (madvise(reinterpret_cast<void*>(page_address),
+              end_address - page_address, MADV_WILLNEED) != 0) {
+    LOG_INFO("madvise(0x%" Px ", 0x%" Px ", MADV_WILLNEED) failed: %d\n",
+             page_address, end_address - page_address, errno);
+  }
+}
+
+void VirtualMemory::WillAccessRandomly(void* address, intptr_t size) {
+  uword start_address = reinterpret_cast<uword>(address);
+  uword end_address = start_address + size;
+  uword page_address = Utils::RoundDown(start_address, PageSize());
+  if (madvise(reinterpret_cast<void*>(page_address),
+              end_address - page_address, MADV_RANDOM) != 0) {
+    LOG_INFO("madvise(0x%" Px ", 0x%" Px ", MADV_RANDOM) failed: %d\n",
+             page_address, end_address - page_address, errno);
+  }
+}
+
 void VirtualMemory::Protect(void* address, intptr_t size, Protection mode) {
 #if defined(DEBUG)
   Thread* thread = Thread::Current();
@@ -87,6 +87,23 @@ void VirtualMemory::FreeSubSegment(void* address,
   }
 }
 
+void VirtualMemory::DontNeed(void* address, intptr_t size) {
+  // MEM_RESET marks the pages as not backed by the pagefile; they keep their
+  // protection and are lazily rezeroed if touched again.
+  if (VirtualAlloc(address, size, MEM_RESET, PAGE_READWRITE) == NULL) {
+    FATAL1("VirtualAlloc failed: Error code %d\n", GetLastError());
+  }
+}
+
+void VirtualMemory::WillNeed(void* address, intptr_t size) {
+  // Nothing to do: PrefetchVirtualMemory is not available on all supported
+  // Windows versions.
+}
+
+void VirtualMemory::WillAccessRandomly(void* address, intptr_t size) {
+  // Nothing to do: there is no per-range access pattern advice on Windows.
+}
+
 void VirtualMemory::Protect(void* address, intptr_t size, Protection mode) {
 #if defined(DEBUG)
   Thread* thread = Thread::Current();
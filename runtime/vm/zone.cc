@@ -5,6 +5,7 @@
 #include "vm/zone.h"
 
 #include "platform/assert.h"
+#include "platform/atomic.h"
 #include "platform/leak_sanitizer.h"
 #include "platform/utils.h"
 #include "vm/dart_api_state.h"
@@ -17,6 +18,7 @@
 namespace dart {
 
 RelaxedAtomic<intptr_t> Zone::total_size_ = {0};
+RelaxedAtomic<intptr_t> Zone::max_size_ = {0};
 
 // Zone segments represent chunks of memory: They have starting
 // address encoded in the this pointer and a size in bytes. They are
@@ -52,43 +54,70 @@ class Zone::Segment {
 // zone segments (jemalloc to the point of causing OOM), so instead of using
 // malloc to allocate segments, we allocate directly from mmap/zx_vmo_create/
 // VirtualAlloc, and cache a small number of the normal sized segments.
+//
+// The cache is an array of independent slots so it can be accessed without
+// a lock: a thread claims a cached segment by swapping a slot's pointer for
+// nullptr with a single compare-and-swap, and returns one the same way in
+// the opposite direction, so threads entering and leaving zone scopes never
+// serialize behind each other on a cache mutex.
 static constexpr intptr_t kSegmentCacheCapacity = 16;  // 1 MB of Segments
-static Mutex* segment_cache_mutex = nullptr;
-static VirtualMemory* segment_cache[kSegmentCacheCapacity] = {nullptr};
-static intptr_t segment_cache_size = 0;
+static AcqRelAtomic<VirtualMemory*> segment_cache[kSegmentCacheCapacity];
 
 void Zone::Init() {
-  ASSERT(segment_cache_mutex == nullptr);
-  segment_cache_mutex = new Mutex(NOT_IN_PRODUCT("segment_cache_mutex"));
+#if defined(DEBUG)
+  for (intptr_t i = 0; i < kSegmentCacheCapacity; i++) {
+    ASSERT(segment_cache[i].load() == nullptr);
+  }
+#endif
 }
 
 void Zone::Cleanup() {
-  {
-    MutexLocker ml(segment_cache_mutex);
-    ASSERT(segment_cache_size >= 0);
-    ASSERT(segment_cache_size <= kSegmentCacheCapacity);
-    while (segment_cache_size > 0) {
-      delete segment_cache[--segment_cache_size];
+  // All threads using zones have shut down; drain the cache single-threaded.
+  for (intptr_t i = 0; i < kSegmentCacheCapacity; i++) {
+    VirtualMemory* memory = segment_cache[i].load();
+    if (memory != nullptr) {
+      segment_cache[i].store(nullptr);
+      delete memory;
+    }
+  }
+}
+
+static VirtualMemory* TryRemoveFromSegmentCache() {
+  for (intptr_t i = 0; i < kSegmentCacheCapacity; i++) {
+    VirtualMemory* memory = segment_cache[i].load();
+    if ((memory != nullptr) &&
+        segment_cache[i].compare_exchange_strong(memory, nullptr)) {
+      return memory;
     }
   }
-  delete segment_cache_mutex;
-  segment_cache_mutex = nullptr;
+  return nullptr;
+}
+
+// Returns true if the cache took ownership of [memory].
+static bool TryAddToSegmentCache(VirtualMemory* memory) {
+  for (intptr_t i = 0; i < kSegmentCacheCapacity; i++) {
+    VirtualMemory* expected = nullptr;
+    if ((segment_cache[i].load() == nullptr) &&
+        segment_cache[i].compare_exchange_strong(expected, memory)) {
+      return true;
+    }
+  }
+  return false;
 }
 
 Zone::Segment* Zone::Segment::New(intptr_t size, Zone::Segment* next) {
   size = Utils::RoundUp(size, VirtualMemory::PageSize());
   VirtualMemory* memory = nullptr;
   if (size == kSegmentSize) {
-    MutexLocker ml(segment_cache_mutex);
-    ASSERT(segment_cache_size >= 0);
-    ASSERT(segment_cache_size <= kSegmentCacheCapacity);
-    if (segment_cache_size > 0) {
-      memory = segment_cache[--segment_cache_size];
-    }
+    memory = TryRemoveFromSegmentCache();
   }
   if (memory == nullptr) {
     memory = VirtualMemory::Allocate(size, false, "dart-zone");
-    total_size_.fetch_add(size);
+    const intptr_t new_total = total_size_.fetch_add(size) + size;
+    // Racy updates can lose a watermark, which is acceptable for a metric.
+    if (new_total > max_size_.load()) {
+      max_size_.store(new_total);
+    }
   }
   if (memory == nullptr) {
     OUT_OF_MEMORY();
@@ -122,14 +151,8 @@ void Zone::Segment::DeleteSegmentList(Segment* head) {
 #endif
     LSAN_UNREGISTER_ROOT_REGION(current, sizeof(*current));
 
-    if (size == kSegmentSize) {
-      MutexLocker ml(segment_cache_mutex);
-      ASSERT(segment_cache_size >= 0);
-      ASSERT(segment_cache_size <= kSegmentCacheCapacity);
-      if (segment_cache_size < kSegmentCacheCapacity) {
-        segment_cache[segment_cache_size++] = memory;
-        memory = nullptr;
-      }
+    if ((size == kSegmentSize) && TryAddToSegmentCache(memory)) {
+      memory = nullptr;
     }
     if (memory != nullptr) {
       total_size_.fetch_sub(size);
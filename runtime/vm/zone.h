@@ -90,6 +90,9 @@ class Zone {
 
   static intptr_t Size() { return total_size_; }
 
+  // High watermark of [Size] over the lifetime of the VM.
+  static intptr_t MaxSize() { return max_size_; }
+
  private:
   Zone();
   ~Zone();  // Delete all memory associated with the zone.
@@ -109,6 +112,9 @@ class Zone {
   // Total size of current zone segments.
   static RelaxedAtomic<intptr_t> total_size_;
 
+  // High watermark of total_size_.
+  static RelaxedAtomic<intptr_t> max_size_;
+
   // Expand the zone to accommodate an allocation of 'size' bytes.
   uword AllocateExpand(intptr_t size);
 
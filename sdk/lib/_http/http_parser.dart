@@ -648,6 +648,19 @@ class _HttpParser extends Stream<_HttpIncoming> {
               throw HttpException("Invalid header field name, with $byte");
             }
             _addWithValidation(_headerField, _toLowerCaseByte(byte));
+            // Consume the rest of the field name in a run instead of one
+            // switch dispatch per byte; the terminating byte is left for the
+            // next iteration so state handling is unchanged.
+            var buffer = _buffer!;
+            int end = buffer.length;
+            int i = _index;
+            while (i < end) {
+              int next = buffer[i];
+              if (next == _CharCode.COLON || !_isTokenChar(next)) break;
+              _addWithValidation(_headerField, _toLowerCaseByte(next));
+              i++;
+            }
+            _index = i;
           }
           break;
 
@@ -670,6 +683,18 @@ class _HttpParser extends Stream<_HttpIncoming> {
             _state = _State.HEADER_VALUE_FOLD_OR_END;
           } else {
             _addWithValidation(_headerValue, byte);
+            // Consume the rest of the value in a run; values end only at CR
+            // or LF, which is left for the next iteration.
+            var buffer = _buffer!;
+            int end = buffer.length;
+            int i = _index;
+            while (i < end) {
+              int next = buffer[i];
+              if (next == _CharCode.CR || next == _CharCode.LF) break;
+              _addWithValidation(_headerValue, next);
+              i++;
+            }
+            _index = i;
           }
           break;
 
@@ -51,6 +51,14 @@ class _File {
       native "File_Open";
   @patch
   static int _openStdio(int fd) native "File_OpenStdio";
+
+  /// Returns a read-only [Uint8List] over a memory mapping of the file that
+  /// is shared with every other isolate reading the same path, or `null` if
+  /// the file cannot be mapped. Intended for large immutable assets, where
+  /// copying the contents into each isolate would be wasteful. The returned
+  /// view must not be mutated.
+  static _readFileShared(_Namespace namespace, Uint8List rawPath)
+      native "File_ReadFileShared";
 }
 
 @patch
@@ -953,13 +953,21 @@ class _NativeSocket extends _NativeSocketNativeWrapper with _ServiceObject {
     }
   }
 
-  _NativeSocket? accept() {
+  // When `notified` is false the accept is issued without a pending
+  // readiness message from the event handler; the call simply fails when the
+  // kernel backlog is empty. A readiness message arriving later for a
+  // connection that was already drained this way makes one notified accept
+  // fail in the same harmless manner, keeping the token accounting in
+  // balance.
+  _NativeSocket? accept({bool notified = true}) {
     // Don't issue accept if we're closing.
     if (isClosing || isClosed) return null;
-    assert(connections > 0);
-    connections--;
-    tokens++;
-    returnTokens(listeningTokenBatchSize);
+    if (notified) {
+      assert(connections > 0);
+      connections--;
+      tokens++;
+      returnTokens(listeningTokenBatchSize);
+    }
     var socket = new _NativeSocket.normal(address);
     if (nativeAccept(socket) != true) return null;
     socket.localPort = localPort;
@@ -1400,8 +1408,13 @@ class _RawServerSocket extends Stream<RawSocket> implements RawServerSocket {
         onResume: _onPauseStateChange);
     _socket.setHandlers(
         read: zone.bindCallbackGuarded(() {
-          while (_socket.connections > 0) {
-            var socket = _socket.accept();
+          // Accept the connections the event handler has signalled, then
+          // keep draining until the kernel backlog is empty. During a
+          // connection storm the backlog grows faster than readiness
+          // messages arrive, and every drained accept saves a message round
+          // trip through the event handler.
+          while (true) {
+            var socket = _socket.accept(notified: _socket.connections > 0);
             if (socket == null) return;
             if (!const bool.fromEnvironment("dart.vm.product")) {
               _SocketProfile.collectNewSocket(socket.nativeGetSocketId(),
@@ -1209,6 +1209,40 @@ class _BigIntImpl implements BigInt {
     return _isIntrinsified ? 2 : 1;
   }
 
+  /// Karatsuba multiplication threshold in digits.
+  ///
+  /// Below this size the schoolbook loop wins: [_mulAdd] is intrinsified to
+  /// process two digits per call with full-width hardware multiplies, so the
+  /// extra additions and allocations of Karatsuba only pay off for large
+  /// operands.
+  static const int _karatsubaThreshold = 64;
+
+  /// Returns the value of the digits in the range [from] to [to-1] as a
+  /// non-negative big integer.
+  _BigIntImpl _rangeAbs(int from, int to) {
+    if (to > _used) to = _used;
+    if (from >= to) return zero;
+    final used = to - from;
+    return new _BigIntImpl._(false, used, _cloneDigits(_digits, from, to, used));
+  }
+
+  /// Multiplies this and [other] by splitting both at [half] digits:
+  /// with `b = 2^(half*_digitBits)`, `x*y = z2*b^2 + z1*b + z0` where
+  /// `z2 = x1*y1`, `z0 = x0*y0` and `z1 = (x0+x1)*(y0+y1) - z2 - z0`,
+  /// requiring three recursive multiplications instead of four.
+  _BigIntImpl _mulKaratsuba(_BigIntImpl other) {
+    final int half = ((_used < other._used) ? _used : other._used) >> 1;
+    final x0 = _rangeAbs(0, half);
+    final x1 = _rangeAbs(half, _used);
+    final y0 = other._rangeAbs(0, half);
+    final y1 = other._rangeAbs(half, other._used);
+    final z2 = x1 * y1;
+    final z0 = x0 * y0;
+    final z1 = (x0 + x1) * (y0 + y1) - z2 - z0;
+    final product = z2._dlShift(2 * half) + z1._dlShift(half) + z0;
+    return (_isNegative != other._isNegative) ? -product : product;
+  }
+
   /// Multiplication operator.
   _BigIntImpl operator *(BigInt bigInt) {
     final other = _ensureSystemBigInt(bigInt, 'bigInt');
@@ -1217,6 +1251,9 @@ class _BigIntImpl implements BigInt {
     if (used == 0 || otherUsed == 0) {
       return zero;
     }
+    if (used >= _karatsubaThreshold && otherUsed >= _karatsubaThreshold) {
+      return _mulKaratsuba(other);
+    }
     var resultUsed = used + otherUsed;
     var digits = _digits;
     var otherDigits = other._digits;
@@ -1237,6 +1274,19 @@ class _BigIntImpl implements BigInt {
     var resultUsed = xUsed + otherUsed;
     var i = resultUsed + (resultUsed & 1);
     assert(resultDigits.length >= i);
+    if (xUsed >= _karatsubaThreshold && otherUsed >= _karatsubaThreshold) {
+      final x = new _BigIntImpl._(
+          false, xUsed, _cloneDigits(xDigits, 0, xUsed, xUsed));
+      final y = new _BigIntImpl._(
+          false, otherUsed, _cloneDigits(otherDigits, 0, otherUsed, otherUsed));
+      final product = x._mulKaratsuba(y);
+      final productDigits = product._digits;
+      final productUsed = product._used;
+      while (--i >= 0) {
+        resultDigits[i] = (i < productUsed) ? productDigits[i] : 0;
+      }
+      return resultUsed;
+    }
     while (--i >= 0) {
       resultDigits[i] = 0;
     }
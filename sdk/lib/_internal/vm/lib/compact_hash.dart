@@ -204,7 +204,7 @@ abstract class _LinkedHashMapMixin<K, V> implements _HashBase {
         var key = oldData[i];
         if (!_HashBase._isDeleted(oldData, key)) {
           // TODO(koda): While there are enough hash bits, avoid hashCode calls.
-          this[key] = oldData[i + 1];
+          _insertUnique(key, oldData[i + 1]);
         }
       }
     }
@@ -218,10 +218,30 @@ abstract class _LinkedHashMapMixin<K, V> implements _HashBase {
     final int tmpUsed = _usedData;
     _usedData = 0;
     for (int i = 0; i < tmpUsed; i += 2) {
-      this[_data[i]] = _data[i + 1];
+      _insertUnique(_data[i], _data[i + 1]);
     }
   }
 
+  // Inserts a key known not to be present, probing only for an unused slot.
+  // Used when rebuilding the index, where the keys are already distinct and
+  // equality checks against existing entries would be wasted work.
+  void _insertUnique(K key, V value) {
+    final int size = _index.length;
+    final int sizeMask = size - 1;
+    final int fullHash = _hashCode(key);
+    final int hashPattern = _HashBase._hashPattern(fullHash, _hashMask, size);
+    int i = _HashBase._firstProbe(fullHash, sizeMask);
+    while (_index[i] != _HashBase._UNUSED_PAIR) {
+      i = _HashBase._nextProbe(i, sizeMask);
+    }
+    assert(1 <= hashPattern && hashPattern < (1 << 32));
+    final int index = _usedData >> 1;
+    assert((index & hashPattern) == 0);
+    _index[i] = hashPattern | index;
+    _data[_usedData++] = key;
+    _data[_usedData++] = value;
+  }
+
   void _insert(K key, V value, int hashPattern, int i) {
     if (_usedData == _data.length) {
       _rehash();
@@ -528,12 +548,30 @@ class _CompactLinkedHashSet<E> extends _HashFieldBase
       for (int i = 0; i < oldUsed; i += 1) {
         var key = oldData[i];
         if (!_HashBase._isDeleted(oldData, key)) {
-          add(key);
+          _addUnique(key);
         }
       }
     }
   }
 
+  // Adds a key known not to be present, probing only for an unused slot.
+  // Used when rebuilding the index, where the keys are already distinct and
+  // equality checks against existing entries would be wasted work.
+  void _addUnique(E key) {
+    final int size = _index.length;
+    final int sizeMask = size - 1;
+    final int fullHash = _hashCode(key);
+    final int hashPattern = _HashBase._hashPattern(fullHash, _hashMask, size);
+    int i = _HashBase._firstProbe(fullHash, sizeMask);
+    while (_index[i] != _HashBase._UNUSED_PAIR) {
+      i = _HashBase._nextProbe(i, sizeMask);
+    }
+    assert(1 <= hashPattern && hashPattern < (1 << 32));
+    assert((hashPattern & _usedData) == 0);
+    _index[i] = hashPattern | _usedData;
+    _data[_usedData++] = key;
+  }
+
   bool add(E key) {
     final int size = _index.length;
     final int sizeMask = size - 1;
@@ -416,12 +416,30 @@ abstract class _ChunkedJsonParser<T> {
   // Mask used to mask off two lower bits.
   static const int TWO_BIT_MASK = 3;
 
+  // Property key cache configuration.
+  static const int KEY_CACHE_SIZE = 64;
+  static const int MAX_CACHED_KEY_LENGTH = 32;
+
   final _JsonListener listener;
 
   // The current parsing state.
   int state = STATE_INITIAL;
   List<int> states = <int>[];
 
+  /**
+   * Cache of recently seen property keys, indexed by a hash of their
+   * code units.
+   *
+   * JSON input typically repeats the same small set of keys for every
+   * object, so reusing an existing string avoids allocating a fresh key
+   * per object. Only short ASCII keys are cached, and the cache lives
+   * no longer than the parser itself.
+   */
+  final List<String?> keyCache = new List<String?>.filled(KEY_CACHE_SIZE, null);
+
+  /** Whether the string currently being parsed is a property key. */
+  bool parsingKey = false;
+
   /**
    * Stores tokenizer state between chunks.
    *
@@ -855,6 +873,9 @@ abstract class _ChunkedJsonParser<T> {
           break;
         case QUOTE:
           if ((state & ALLOW_STRING_MASK) != 0) fail(position);
+          // In the string-only states the string being parsed is an object
+          // property key.
+          parsingKey = (state & ALLOW_VALUE_MASK) != 0;
           state |= VALUE_READ_BITS;
           position = parseString(position + 1);
           break;
@@ -1038,7 +1059,10 @@ abstract class _ChunkedJsonParser<T> {
         return parseStringToBuffer(sliceEnd);
       }
       if (char == QUOTE) {
-        listener.handleString(getString(start, position - 1, bits));
+        int sliceEnd = position - 1;
+        listener.handleString(parsingKey
+            ? getKeyString(start, sliceEnd, bits)
+            : getString(start, sliceEnd, bits));
         return position;
       }
       if (char < SPACE) {
@@ -1089,6 +1113,40 @@ abstract class _ChunkedJsonParser<T> {
    * This function scans through the string literal for escapes, and copies
    * slices of non-escape characters using [addSliceToString].
    */
+  /**
+   * Returns the string for a property key, reusing a recently created
+   * string when the same key was seen before.
+   *
+   * Falls back to [getString] for long or non-ASCII keys, which are
+   * unlikely to repeat often enough to be worth hashing.
+   */
+  String getKeyString(int start, int end, int bits) {
+    const int maxAsciiChar = 0x7f;
+    int length = end - start;
+    if (bits > maxAsciiChar || length > MAX_CACHED_KEY_LENGTH) {
+      return getString(start, end, bits);
+    }
+    int hash = length;
+    for (int i = start; i < end; i++) {
+      hash = 0x1fffffff & ((hash * 31) + getChar(i));
+    }
+    int index = hash & (KEY_CACHE_SIZE - 1);
+    String? cached = keyCache[index];
+    if (cached != null && cached.length == length) {
+      bool equal = true;
+      for (int i = 0; i < length; i++) {
+        if (cached.codeUnitAt(i) != getChar(start + i)) {
+          equal = false;
+          break;
+        }
+      }
+      if (equal) return cached;
+    }
+    String result = getString(start, end, bits);
+    keyCache[index] = result;
+    return result;
+  }
+
   int parseStringToBuffer(int position) {
     int end = chunkEnd;
     int start = position;
@@ -46,7 +46,8 @@ Pointer<T> _fromAddress<T extends NativeType>(int ptr) native "Ffi_fromAddress";
 // BuildFfiAsFunctionCall in the Kernel frontend. No calls can actually reach
 // this function.
 DS _asFunctionInternal<DS extends Function, NS extends Function>(
-    Pointer<NativeFunction<NS>> ptr) native "Ffi_asFunctionInternal";
+    Pointer<NativeFunction<NS>> ptr,
+    bool isLeaf) native "Ffi_asFunctionInternal";
 
 dynamic _asExternalTypedData(Pointer ptr, int count)
     native "Ffi_asExternalTypedData";
@@ -226,7 +227,7 @@ Pointer<Pointer<S>> _elementAtPointer<S extends NativeType>(
 extension NativeFunctionPointer<NF extends Function>
     on Pointer<NativeFunction<NF>> {
   @patch
-  DF asFunction<DF extends Function>() =>
+  DF asFunction<DF extends Function>({bool isLeaf: false}) =>
       throw UnsupportedError("The body is inlined in the frontend.");
 }
 
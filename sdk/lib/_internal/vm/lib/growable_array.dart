@@ -278,6 +278,13 @@ class _GrowableList<T> extends ListBase<T> {
   int _nextCapacity(int old_capacity) => (old_capacity * 2) | 3;
 
   void _grow(int new_capacity) {
+    if (length > 64) {
+      // A single runtime entry that bulk-copies the elements is cheaper than
+      // a long loop of barriered stores. Round up to an odd capacity like
+      // _allocateData does.
+      _growInternal(new_capacity | 1);
+      return;
+    }
     var newData = _allocateData(new_capacity);
     // This is a work-around for dartbug.com/30090: array-bound-check
     // generalization causes excessive deoptimizations because it
@@ -293,6 +300,8 @@ class _GrowableList<T> extends ListBase<T> {
     _setData(newData);
   }
 
+  void _growInternal(int new_capacity) native "GrowableList_grow";
+
   void _shrink(int new_capacity, int new_length) {
     var newData = _allocateData(new_capacity);
     // This is a work-around for dartbug.com/30090. See the comment in _grow.
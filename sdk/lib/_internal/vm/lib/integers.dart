@@ -732,4 +732,43 @@ class _Mint extends _IntegerImplementation {
   int get bitLength native "Mint_bitLength";
 
   int _bitAndFromSmi(_Smi other) => _bitAndFromInteger(other);
+
+  /**
+   * Converts the mint to a string, writing digits two at a time into a
+   * pre-sized string like [_Smi.toString] does. Without this override the
+   * conversion goes through the generic Object.toString runtime entry.
+   */
+  String toString() {
+    // Character code for '-'.
+    const int MINUS_SIGN = 0x2d;
+    // Character code for '0'.
+    const int DIGIT_ZERO = 0x30;
+    // Work on the negative magnitude so that the most negative value, whose
+    // positive magnitude is not representable, needs no special casing.
+    final bool negative = this < 0;
+    int negValue = negative ? this : -this;
+    final int digitCount = _Smi._negativeBase10Length(negValue);
+    final int length = negative ? digitCount + 1 : digitCount;
+    _OneByteString result = _OneByteString._allocate(length);
+    if (negative) result._setAt(0, MINUS_SIGN);
+    int index = length - 1;
+    do {
+      // Two digits at a time.
+      final int twoDigits = negValue.remainder(100);
+      negValue = negValue ~/ 100;
+      final int digitIndex = -twoDigits * 2;
+      result._setAt(index, _Smi._digitTable[digitIndex + 1]);
+      result._setAt(index - 1, _Smi._digitTable[digitIndex]);
+      index -= 2;
+    } while (negValue <= -100);
+    if (negValue > -10) {
+      result._setAt(index, DIGIT_ZERO - negValue);
+    } else {
+      // No remainder necessary for this case.
+      final int digitIndex = -negValue * 2;
+      result._setAt(index, _Smi._digitTable[digitIndex + 1]);
+      result._setAt(index - 1, _Smi._digitTable[digitIndex]);
+    }
+    return result;
+  }
 }
@@ -869,6 +869,19 @@ abstract class _StringBase implements String {
     return _OneByteString._concatAll(values, totalLength);
   }
 
+  /**
+   * Convert [a] and [b] to strings and concat them into a result string.
+   *
+   * Used by the compiler for two-piece interpolations (e.g. `"log: $x"`),
+   * which skip the argument list that [_interpolate] requires. String
+   * concatenation measures both operands and copies into a single
+   * allocation of the exact size.
+   */
+  @pragma("vm:entry-point", "call")
+  static String _interpolate2(Object? a, Object? b) {
+    return _interpolateSingle(a) + _interpolateSingle(b);
+  }
+
   Iterable<Match> allMatches(String string, [int start = 0]) {
     if (start < 0 || start > string.length) {
       throw new RangeError.range(start, 0, string.length, "start");
@@ -109,12 +109,116 @@ abstract class _TypedListBase {
   // Element size of toCid and fromCid must match (test at caller).
   bool _setRange(int startInBytes, int lengthInBytes, _TypedListBase from,
       int startFromInBytes, int toCid, int fromCid) native "TypedData_setRange";
+
+  // Fills [lengthInBytes] bytes starting at byte [startInBytes] with [value]
+  // (0..255). The range must be within the bounds of this list.
+  void _fillRange(int startInBytes, int lengthInBytes, int value)
+      native "TypedData_fillRange";
+
+  // Copies [count] elements from [from] starting at element [skipCount] into
+  // this list starting at element [start]. The element sizes of this list and
+  // [from] must match and the lists must be backed by different buffers, so
+  // that the ranges cannot overlap. Returns true if the copy was performed.
+  @pragma("vm:prefer-inline")
+  bool _fastSetRange(int start, int count, _TypedListBase from, int skipCount) {
+    if (this is Uint8ClampedList &&
+        from is! Uint8List &&
+        from is! Uint8ClampedList) {
+      // Only the element-wise stores clamp the written values.
+      return false;
+    }
+    switch (this.elementSizeInBytes) {
+      case 1:
+        _memMove1(from, this, skipCount, start, count);
+        return true;
+      case 2:
+        _memMove2(from, this, skipCount, start, count);
+        return true;
+      case 4:
+        _memMove4(from, this, skipCount, start, count);
+        return true;
+      case 8:
+        _memMove8(from, this, skipCount, start, count);
+        return true;
+      case 16:
+        _memMove16(from, this, skipCount, start, count);
+        return true;
+    }
+    return false;
+  }
+}
+
+/// These functions are recognized by the VM and compiled into an inline copy
+/// sequence. [from] and [to] may be any (internal, view or external) typed
+/// data objects whose element size matches the size in the function name.
+/// The [fromStart] and [toStart] element offsets together with [count] must
+/// specify ranges within the bounds of [from] and [to], and the underlying
+/// memory must not overlap.
+@pragma("vm:prefer-inline")
+void _memMove1(_TypedListBase from, _TypedListBase to, int fromStart,
+    int toStart, int count) {
+  to.buffer._data._setRange(
+      toStart + to.offsetInBytes,
+      count,
+      from.buffer._data,
+      fromStart + from.offsetInBytes,
+      ClassID.getID(to),
+      ClassID.getID(from));
+}
+
+@pragma("vm:prefer-inline")
+void _memMove2(_TypedListBase from, _TypedListBase to, int fromStart,
+    int toStart, int count) {
+  to.buffer._data._setRange(
+      toStart * 2 + to.offsetInBytes,
+      count * 2,
+      from.buffer._data,
+      fromStart * 2 + from.offsetInBytes,
+      ClassID.getID(to),
+      ClassID.getID(from));
+}
+
+@pragma("vm:prefer-inline")
+void _memMove4(_TypedListBase from, _TypedListBase to, int fromStart,
+    int toStart, int count) {
+  to.buffer._data._setRange(
+      toStart * 4 + to.offsetInBytes,
+      count * 4,
+      from.buffer._data,
+      fromStart * 4 + from.offsetInBytes,
+      ClassID.getID(to),
+      ClassID.getID(from));
+}
+
+@pragma("vm:prefer-inline")
+void _memMove8(_TypedListBase from, _TypedListBase to, int fromStart,
+    int toStart, int count) {
+  to.buffer._data._setRange(
+      toStart * 8 + to.offsetInBytes,
+      count * 8,
+      from.buffer._data,
+      fromStart * 8 + from.offsetInBytes,
+      ClassID.getID(to),
+      ClassID.getID(from));
+}
+
+@pragma("vm:prefer-inline")
+void _memMove16(_TypedListBase from, _TypedListBase to, int fromStart,
+    int toStart, int count) {
+  to.buffer._data._setRange(
+      toStart * 16 + to.offsetInBytes,
+      count * 16,
+      from.buffer._data,
+      fromStart * 16 + from.offsetInBytes,
+      ClassID.getID(to),
+      ClassID.getID(from));
 }
 
 mixin _IntListMixin implements List<int> {
   int get elementSizeInBytes;
   int get offsetInBytes;
   _ByteBuffer get buffer;
+  bool _fastSetRange(int start, int count, _TypedListBase from, int skipCount);
 
   Iterable<T> whereType<T>() => new WhereTypeIterable<T>(this);
 
@@ -383,6 +487,15 @@ mixin _IntListMixin implements List<int> {
     if (fillValue == null) {
       throw ArgumentError.notNull("fillValue");
     }
+    final count = end - start;
+    if (count >= 64 && this.elementSizeInBytes == 1) {
+      // One runtime entry doing a memset beats a long loop of stores.
+      final byte = this is Uint8ClampedList
+          ? (fillValue < 0 ? 0 : (fillValue > 255 ? 255 : fillValue))
+          : fillValue & 0xff;
+      buffer._data._fillRange(start + this.offsetInBytes, count, byte);
+      return;
+    }
     for (var i = start; i < end; ++i) {
       this[i] = fillValue;
     }
@@ -415,10 +528,16 @@ mixin _TypedIntListMixin<SpawnedType extends List<int>> on _IntListMixin
       // no promotion here.
       final fromAsTypedList = from as _TypedListBase;
       if (this.elementSizeInBytes == fromAsTypedList.elementSizeInBytes) {
-        if ((count < 10) && (fromAsTypedList.buffer != this.buffer)) {
-          Lists.copy(from as List<int>, skipCount, this, start, count);
-          return;
-        } else if (this.buffer._data._setRange(
+        if (fromAsTypedList.buffer != this.buffer) {
+          if (_fastSetRange(start, count, fromAsTypedList, skipCount)) {
+            return;
+          }
+          if (count < 10) {
+            Lists.copy(from as List<int>, skipCount, this, start, count);
+            return;
+          }
+        }
+        if (this.buffer._data._setRange(
             start * elementSizeInBytes + this.offsetInBytes,
             count * elementSizeInBytes,
             fromAsTypedList.buffer._data,
@@ -471,6 +590,7 @@ mixin _DoubleListMixin implements List<double> {
   int get elementSizeInBytes;
   int get offsetInBytes;
   _ByteBuffer get buffer;
+  bool _fastSetRange(int start, int count, _TypedListBase from, int skipCount);
 
   Iterable<T> whereType<T>() => new WhereTypeIterable<T>(this);
 
@@ -775,10 +895,16 @@ mixin _TypedDoubleListMixin<SpawnedType extends List<double>>
       // no promotion here.
       final fromAsTypedList = from as _TypedListBase;
       if (this.elementSizeInBytes == fromAsTypedList.elementSizeInBytes) {
-        if ((count < 10) && (fromAsTypedList.buffer != this.buffer)) {
-          Lists.copy(from as List<double>, skipCount, this, start, count);
-          return;
-        } else if (this.buffer._data._setRange(
+        if (fromAsTypedList.buffer != this.buffer) {
+          if (_fastSetRange(start, count, fromAsTypedList, skipCount)) {
+            return;
+          }
+          if (count < 10) {
+            Lists.copy(from as List<double>, skipCount, this, start, count);
+            return;
+          }
+        }
+        if (this.buffer._data._setRange(
             start * elementSizeInBytes + this.offsetInBytes,
             count * elementSizeInBytes,
             fromAsTypedList.buffer._data,
@@ -831,6 +957,7 @@ abstract class _Float32x4ListMixin implements List<Float32x4> {
   int get elementSizeInBytes;
   int get offsetInBytes;
   _ByteBuffer get buffer;
+  bool _fastSetRange(int start, int count, _TypedListBase from, int skipCount);
 
   Float32x4List _createList(int length);
 
@@ -918,10 +1045,16 @@ abstract class _Float32x4ListMixin implements List<Float32x4> {
       // no promotion here.
       final fromAsTypedList = from as _TypedListBase;
       if (this.elementSizeInBytes == fromAsTypedList.elementSizeInBytes) {
-        if ((count < 10) && (fromAsTypedList.buffer != this.buffer)) {
-          Lists.copy(from as List<Float32x4>, skipCount, this, start, count);
-          return;
-        } else if (this.buffer._data._setRange(
+        if (fromAsTypedList.buffer != this.buffer) {
+          if (_fastSetRange(start, count, fromAsTypedList, skipCount)) {
+            return;
+          }
+          if (count < 10) {
+            Lists.copy(from as List<Float32x4>, skipCount, this, start, count);
+            return;
+          }
+        }
+        if (this.buffer._data._setRange(
             start * elementSizeInBytes + this.offsetInBytes,
             count * elementSizeInBytes,
             fromAsTypedList.buffer._data,
@@ -1191,6 +1324,7 @@ abstract class _Int32x4ListMixin implements List<Int32x4> {
   int get elementSizeInBytes;
   int get offsetInBytes;
   _ByteBuffer get buffer;
+  bool _fastSetRange(int start, int count, _TypedListBase from, int skipCount);
 
   Int32x4List _createList(int length);
 
@@ -1278,10 +1412,16 @@ abstract class _Int32x4ListMixin implements List<Int32x4> {
       // no promotion here.
       final fromAsTypedList = from as _TypedListBase;
       if (this.elementSizeInBytes == fromAsTypedList.elementSizeInBytes) {
-        if ((count < 10) && (fromAsTypedList.buffer != this.buffer)) {
-          Lists.copy(from as List<Int32x4>, skipCount, this, start, count);
-          return;
-        } else if (this.buffer._data._setRange(
+        if (fromAsTypedList.buffer != this.buffer) {
+          if (_fastSetRange(start, count, fromAsTypedList, skipCount)) {
+            return;
+          }
+          if (count < 10) {
+            Lists.copy(from as List<Int32x4>, skipCount, this, start, count);
+            return;
+          }
+        }
+        if (this.buffer._data._setRange(
             start * elementSizeInBytes + this.offsetInBytes,
             count * elementSizeInBytes,
             fromAsTypedList.buffer._data,
@@ -1550,6 +1690,7 @@ abstract class _Float64x2ListMixin implements List<Float64x2> {
   int get elementSizeInBytes;
   int get offsetInBytes;
   _ByteBuffer get buffer;
+  bool _fastSetRange(int start, int count, _TypedListBase from, int skipCount);
 
   Float64x2List _createList(int length);
 
@@ -1637,10 +1778,16 @@ abstract class _Float64x2ListMixin implements List<Float64x2> {
       // no promotion here.
       final fromAsTypedList = from as _TypedListBase;
       if (this.elementSizeInBytes == fromAsTypedList.elementSizeInBytes) {
-        if ((count < 10) && (fromAsTypedList.buffer != this.buffer)) {
-          Lists.copy(from as List<Float64x2>, skipCount, this, start, count);
-          return;
-        } else if (this.buffer._data._setRange(
+        if (fromAsTypedList.buffer != this.buffer) {
+          if (_fastSetRange(start, count, fromAsTypedList, skipCount)) {
+            return;
+          }
+          if (count < 10) {
+            Lists.copy(from as List<Float64x2>, skipCount, this, start, count);
+            return;
+          }
+        }
+        if (this.buffer._data._setRange(
             start * elementSizeInBytes + this.offsetInBytes,
             count * elementSizeInBytes,
             fromAsTypedList.buffer._data,
@@ -45,6 +45,11 @@ class DynamicLibrary {
 /// Methods which cannot be invoked dynamically.
 extension DynamicLibraryExtension on DynamicLibrary {
   /// Helper that combines lookup and cast to a Dart function.
+  ///
+  /// If [isLeaf] is `true`, the function is invoked as a leaf call, see
+  /// [NativeFunctionPointer.asFunction] for the restrictions that apply.
+  /// [isLeaf] must be a constant expression.
   external F lookupFunction<T extends Function, F extends Function>(
-      String symbolName);
+      String symbolName,
+      {bool isLeaf: false});
 }
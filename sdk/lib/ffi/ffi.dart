@@ -84,7 +84,16 @@ extension NativeFunctionPointer<NF extends Function>
     on Pointer<NativeFunction<NF>> {
   /// Convert to Dart function, automatically marshalling the arguments
   /// and return value.
-  external DF asFunction<@DartRepresentationOf("NF") DF extends Function>();
+  ///
+  /// If [isLeaf] is `true`, the function is invoked as a leaf call: the
+  /// calling thread does not perform the transition to "native" execution
+  /// state, which makes the invocation considerably faster. Only use this for
+  /// short-running functions which do not call back into Dart, do not use the
+  /// Dart API and do not block, as the thread cannot reach a safepoint for
+  /// the duration of the call. [isLeaf] must be a constant expression, and
+  /// the native signature must not contain [Handle]s.
+  external DF asFunction<@DartRepresentationOf("NF") DF extends Function>(
+      {bool isLeaf: false});
 }
 
 //
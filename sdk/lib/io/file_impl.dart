@@ -166,27 +166,62 @@ class _FileStreamConsumer extends StreamConsumer<List<int>> {
   _FileStreamConsumer.fromStdio(int fd)
       : _openFuture = new Future.value(_File._openStdioSync(fd));
 
+  // Data events arriving while a write is in flight are coalesced and
+  // written as one batch, so a slow consumer costs one write request per
+  // drained batch instead of one per event. The source is only paused once
+  // the pending bytes pass [_maxBufferedBytes], which keeps backpressure
+  // working for large pipes while letting small writes pipeline.
+  static const int _maxBufferedBytes = 64 * 1024;
+
   Future<File?> addStream(Stream<List<int>> stream) {
     Completer<File?> completer = new Completer<File?>.sync();
     _openFuture.then((openedFile) {
       late StreamSubscription<List<int>> _subscription;
+      var buffered = new BytesBuilder(copy: false);
+      bool writing = false;
+      bool paused = false;
+      bool done = false;
+
       void error(e, StackTrace stackTrace) {
         _subscription.cancel();
         openedFile.close();
         completer.completeError(e, stackTrace);
       }
 
-      _subscription = stream.listen((d) {
-        _subscription.pause();
+      void write() {
+        if (writing) return;
+        if (buffered.isEmpty) {
+          if (done) {
+            completer.complete(_file);
+          }
+          return;
+        }
+        writing = true;
+        var data = buffered.takeBytes();
+        if (paused) {
+          paused = false;
+          _subscription.resume();
+        }
         try {
-          openedFile
-              .writeFrom(d, 0, d.length)
-              .then((_) => _subscription.resume(), onError: error);
+          openedFile.writeFrom(data, 0, data.length).then((_) {
+            writing = false;
+            write();
+          }, onError: error);
         } catch (e, stackTrace) {
           error(e, stackTrace);
         }
+      }
+
+      _subscription = stream.listen((d) {
+        buffered.add(d);
+        if (!paused && buffered.length >= _maxBufferedBytes) {
+          _subscription.pause();
+          paused = true;
+        }
+        write();
       }, onDone: () {
-        completer.complete(_file);
+        done = true;
+        write();
       }, onError: error, cancelOnError: true);
     }).catchError(completer.completeError);
     return completer.future;
@@ -524,14 +559,22 @@ class _File extends FileSystemEntity implements File {
       return completer.future;
     }
 
-    return open().then((file) {
-      return file.length().then((length) {
-        if (length == 0) {
-          // May be character device, try to read it in chunks.
-          return readDataChunked(file);
-        }
-        return file.read(length);
-      }).whenComplete(file.close);
+    // Read the whole file in a single IO service round trip instead of
+    // separate open, length, read and close requests.
+    return _dispatchWithNamespace(
+        _IOService.fileReadEntireFile, [null, _rawPath]).then((response) {
+      if (_isErrorResponse(response)) {
+        throw _exceptionFromResponse(response, "Cannot open file", path);
+      }
+      var data = response[1];
+      if (data != null) {
+        return data as Uint8List;
+      }
+      // The file reported a zero length; it may be a character device, so
+      // fall back to reading it in chunks.
+      return open().then((file) {
+        return readDataChunked(file).whenComplete(file.close);
+      });
     });
   }
 
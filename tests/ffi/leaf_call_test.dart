@@ -0,0 +1,54 @@
+// Copyright (c) 2021, the Dart project authors.  Please see the AUTHORS file
+// for details. All rights reserved. Use of this source code is governed by a
+// BSD-style license that can be found in the LICENSE file.
+//
+// Dart test program for testing leaf calls to native functions, which skip
+// the generated-to-native thread transition.
+//
+// VMOptions=
+// VMOptions=--deterministic --optimization-counter-threshold=10
+// VMOptions=--use-slow-path
+// VMOptions=--write-protect-code --no-dual-map-code
+// SharedObjects=ffi_test_functions
+
+import 'dart:ffi';
+
+import 'dylib_utils.dart';
+
+import "package:expect/expect.dart";
+
+void main() {
+  for (int i = 0; i < 100; ++i) {
+    testLeafCallFromCast();
+    testLeafCallFromLookup();
+    testLeafCallDoubles();
+  }
+}
+
+final ffiTestFunctions = dlopenPlatformSpecific("ffi_test_functions");
+
+typedef NativeBinaryOp = Int32 Function(Int32, Int32);
+typedef BinaryOp = int Function(int, int);
+
+void testLeafCallFromCast() {
+  final sumPlus42 = ffiTestFunctions
+      .lookup<NativeFunction<NativeBinaryOp>>("SumPlus42")
+      .asFunction<BinaryOp>(isLeaf: true);
+  Expect.equals(49, sumPlus42(3, 4));
+}
+
+void testLeafCallFromLookup() {
+  final sumPlus42 = ffiTestFunctions.lookupFunction<NativeBinaryOp, BinaryOp>(
+      "SumPlus42",
+      isLeaf: true);
+  Expect.equals(49, sumPlus42(3, 4));
+}
+
+typedef NativeDoubleUnaryOp = Double Function(Double);
+typedef DoubleUnaryOp = double Function(double);
+
+void testLeafCallDoubles() {
+  final times1_337 = ffiTestFunctions.lookupFunction<NativeDoubleUnaryOp,
+      DoubleUnaryOp>("Times1_337Double", isLeaf: true);
+  Expect.approxEquals(2.674, times1_337(2.0));
+}